@@ -78,5 +78,59 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        public void VerifyAutoSuggestBoxCornerRadiusAfterTemplateReapplied()
+        {
+            if (PlatformConfiguration.IsOSVersionLessThan(OSVersion.Redstone5))
+            {
+                Log.Warning("AutoSuggestBox CornerRadius property is not available pre-rs5");
+                return;
+            }
+
+            AutoSuggestBox autoSuggestBox = null;
+            RunOnUIThread.Execute(() =>
+            {
+                autoSuggestBox = new AutoSuggestBox();
+                List<string> suggestions = new List<string>
+                {
+                    "Item 1", "Item 2", "Item 3"
+                };
+                autoSuggestBox.ItemsSource = suggestions;
+            });
+            IdleSynchronizer.Wait();
+            Verify.IsNotNull(autoSuggestBox);
+            TestUtilities.SetAsVisualTreeRoot(autoSuggestBox);
+
+            ControlTemplate template = null;
+            RunOnUIThread.Execute(() =>
+            {
+                template = autoSuggestBox.Template;
+                autoSuggestBox.Template = null;
+            });
+            IdleSynchronizer.Wait();
+
+            // The new template's popup is hooked up when the box is loaded again.
+            TestUtilities.ClearVisualTreeRoot();
+            RunOnUIThread.Execute(() =>
+            {
+                autoSuggestBox.Template = template;
+            });
+            TestUtilities.SetAsVisualTreeRoot(autoSuggestBox);
+
+            RunOnUIThread.Execute(() =>
+            {
+                autoSuggestBox.CornerRadius = new CornerRadius(2);
+                autoSuggestBox.Focus(FocusState.Keyboard);
+                autoSuggestBox.Text = "123";
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                var textBox = TestUtilities.FindDescendents<TextBox>(autoSuggestBox).Where(e => e.Name == "TextBox").Single();
+                Verify.AreEqual(new CornerRadius(2, 2, 0, 0), textBox.CornerRadius);
+            });
+        }
+
     }
 }
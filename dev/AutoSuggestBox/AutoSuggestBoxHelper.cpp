@@ -15,6 +15,15 @@ static constexpr auto c_controlCornerRadiusKey = L"ControlCornerRadius"sv;
 static constexpr auto c_overlayCornerRadiusKey = L"OverlayCornerRadius"sv;
 GlobalDependencyProperty AutoSuggestBoxHelper::s_AutoSuggestEventRevokersProperty{ nullptr };
 
+template <typename T>
+static void SetCornerRadiusIfChanged(const T& element, const winrt::CornerRadius& cornerRadius)
+{
+    if (element.CornerRadius() != cornerRadius)
+    {
+        element.CornerRadius(cornerRadius);
+    }
+}
+
 AutoSuggestBoxHelper::AutoSuggestBoxHelper()
 {
     EnsureProperties();
@@ -74,8 +83,12 @@ void AutoSuggestBoxHelper::OnAutoSuggestBoxLoaded(const winrt::IInspectable& sen
     auto autoSuggestBox = sender.as<winrt::AutoSuggestBox>();
     auto revokers = autoSuggestBox.GetValue(AutoSuggestEventRevokersProperty()).as<AutoSuggestEventRevokers>();
 
-    if (!revokers->m_popupOpenedRevoker || !revokers->m_popupClosedRevoker)
+    // A template applied since the last time the box was loaded comes with a new popup.
+    if (EnsureTemplateParts(autoSuggestBox, *revokers) || !revokers->m_popupOpenedRevoker || !revokers->m_popupClosedRevoker)
     {
+        revokers->m_popupOpenedRevoker.revoke();
+        revokers->m_popupClosedRevoker.revoke();
+
         if (auto popup = GetTemplateChildT<winrt::Popup>(c_popupName, autoSuggestBox))
         {
             auto autoSuggestBoxWeakRef = winrt::make_weak(autoSuggestBox);
@@ -101,6 +114,58 @@ void AutoSuggestBoxHelper::OnAutoSuggestBoxLoaded(const winrt::IInspectable& sen
     }
 }
 
+// Looking the parts up by name walks the template, so they are cached in the per-instance side table
+// and looked up again only when the template root changes, which is the case whenever a new template
+// has been applied. Returns true if the parts had to be looked up again.
+bool AutoSuggestBoxHelper::EnsureTemplateParts(const winrt::AutoSuggestBox& autoSuggestBox, AutoSuggestEventRevokers& revokers)
+{
+    winrt::UIElement templateRoot{ nullptr };
+    if (winrt::VisualTreeHelper::GetChildrenCount(autoSuggestBox) > 0)
+    {
+        templateRoot = winrt::VisualTreeHelper::GetChild(autoSuggestBox, 0).try_as<winrt::UIElement>();
+    }
+
+    if (revokers.m_templateRoot.get() != templateRoot)
+    {
+        revokers.m_templateRoot = templateRoot;
+        revokers.m_popupBorder = GetTemplateChildT<winrt::Border>(c_popupBorderName, autoSuggestBox);
+        revokers.m_textBox = GetTemplateChildT<winrt::TextBox>(c_textBoxName, autoSuggestBox);
+        revokers.m_textBoxBorder = nullptr;
+        return true;
+    }
+    return false;
+}
+
+AutoSuggestBoxTemplateParts AutoSuggestBoxHelper::GetTemplateParts(const winrt::AutoSuggestBox& autoSuggestBox)
+{
+    AutoSuggestBoxTemplateParts parts;
+
+    auto revokersInspectable = autoSuggestBox.GetValue(AutoSuggestEventRevokersProperty());
+    if (!revokersInspectable)
+    {
+        return parts;
+    }
+
+    auto revokers = revokersInspectable.as<AutoSuggestEventRevokers>();
+    EnsureTemplateParts(autoSuggestBox, *revokers);
+
+    parts.popupBorder = revokers->m_popupBorder.get();
+    parts.textBox = revokers->m_textBox.get();
+
+    if (parts.textBox && !parts.textBox.try_as<winrt::IControl7>())
+    {
+        // The TextBox applies its own template later than the AutoSuggestBox, so keep trying until its border is found.
+        parts.textBoxBorder = revokers->m_textBoxBorder.get();
+        if (!parts.textBoxBorder)
+        {
+            parts.textBoxBorder = GetTemplateChildT<winrt::Border>(c_textBoxBorderName, parts.textBox);
+            revokers->m_textBoxBorder = parts.textBoxBorder;
+        }
+    }
+
+    return parts;
+}
+
 void AutoSuggestBoxHelper::UpdateCornerRadius(const winrt::AutoSuggestBox& autoSuggestBox, bool isPopupOpen)
 {
     auto textBoxRadius = unbox_value<winrt::CornerRadius>(ResourceLookup(autoSuggestBox, box_value(c_controlCornerRadiusKey)));
@@ -111,9 +176,11 @@ void AutoSuggestBoxHelper::UpdateCornerRadius(const winrt::AutoSuggestBox& autoS
         textBoxRadius = autoSuggextBoxControl7.CornerRadius();
     }
 
+    auto const parts = GetTemplateParts(autoSuggestBox);
+
     if (isPopupOpen)
     {
-        auto const isOpenDown = IsPopupOpenDown(autoSuggestBox);
+        auto const isOpenDown = IsPopupOpenDown(parts);
         auto cornerRadiusConverter = winrt::make_self<CornerRadiusFilterConverter>();
 
         auto popupRadiusFilter = isOpenDown ? winrt::CornerRadiusFilterKind::Bottom : winrt::CornerRadiusFilterKind::Top;
@@ -123,38 +190,32 @@ void AutoSuggestBoxHelper::UpdateCornerRadius(const winrt::AutoSuggestBox& autoS
         textBoxRadius = cornerRadiusConverter->Convert(textBoxRadius, textBoxRadiusFilter);
     }
 
-    if (auto popupBorder = GetTemplateChildT<winrt::Border>(c_popupBorderName, autoSuggestBox))
+    if (parts.popupBorder)
     {
-        popupBorder.CornerRadius(popupRadius);
+        SetCornerRadiusIfChanged(parts.popupBorder, popupRadius);
     }
 
-    if (auto textBox = GetTemplateChildT<winrt::TextBox>(c_textBoxName, autoSuggestBox))
+    if (parts.textBox)
     {
-        if (winrt::IControl7 textBoxControl7 = textBox)
+        if (winrt::IControl7 textBoxControl7 = parts.textBox)
         {
-            textBoxControl7.CornerRadius(textBoxRadius);
+            SetCornerRadiusIfChanged(textBoxControl7, textBoxRadius);
         }
-        else
+        else if (parts.textBoxBorder)
         {
-            if (auto textBoxBorder = GetTemplateChildT<winrt::Border>(c_textBoxBorderName, textBox))
-            {
-                textBoxBorder.CornerRadius(textBoxRadius);
-            }
+            SetCornerRadiusIfChanged(parts.textBoxBorder, textBoxRadius);
         }
     }
 }
 
-bool AutoSuggestBoxHelper::IsPopupOpenDown(const winrt::AutoSuggestBox& autoSuggestBox)
+bool AutoSuggestBoxHelper::IsPopupOpenDown(const AutoSuggestBoxTemplateParts& parts)
 {
     double verticalOffset = 0;
-    if (auto popupBorder = GetTemplateChildT<winrt::Border>(c_popupBorderName, autoSuggestBox))
+    if (parts.popupBorder && parts.textBox)
     {
-        if (auto textBox = GetTemplateChildT<winrt::TextBox>(c_textBoxName, autoSuggestBox))
-        {
-            auto transform = popupBorder.TransformToVisual(textBox);
-            auto popupTop = transform.TransformPoint(winrt::Point(0, 0));
-            verticalOffset = popupTop.Y;
-        }
+        auto transform = parts.popupBorder.TransformToVisual(parts.textBox);
+        auto popupTop = transform.TransformPoint(winrt::Point(0, 0));
+        verticalOffset = popupTop.Y;
     }
     return verticalOffset >= 0;
 }
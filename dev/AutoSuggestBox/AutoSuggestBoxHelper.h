@@ -5,6 +5,16 @@
 #include "AutoSuggestBoxHelper.g.h"
 #include "AutoSuggestBoxHelper.properties.h"
 
+struct AutoSuggestBoxTemplateParts
+{
+    winrt::Border popupBorder{ nullptr };
+    winrt::TextBox textBox{ nullptr };
+    // Only resolved when the TextBox doesn't expose CornerRadius itself.
+    winrt::Border textBoxBorder{ nullptr };
+};
+
+class AutoSuggestEventRevokers;
+
 class AutoSuggestBoxHelper
     : public winrt::implementation::AutoSuggestBoxHelperT<AutoSuggestBoxHelper>
     , public AutoSuggestBoxHelperProperties
@@ -23,8 +33,10 @@ public:
 private:
     static void OnAutoSuggestBoxLoaded(const winrt::IInspectable& sender, const winrt::IInspectable& args);
 
+    static bool EnsureTemplateParts(const winrt::AutoSuggestBox& autoSuggestBox, AutoSuggestEventRevokers& revokers);
+    static AutoSuggestBoxTemplateParts GetTemplateParts(const winrt::AutoSuggestBox& autoSuggestBox);
     static void UpdateCornerRadius(const winrt::AutoSuggestBox& autoSuggestBox, bool isPopupOpen);
-    static bool IsPopupOpenDown(const winrt::AutoSuggestBox& autoSuggestBox);
+    static bool IsPopupOpenDown(const AutoSuggestBoxTemplateParts& parts);
     static winrt::IInspectable ResourceLookup(const winrt::Control& control, const winrt::IInspectable& key);
 };
 
@@ -35,4 +47,11 @@ public:
     winrt::AutoSuggestBox::Loaded_revoker m_autoSuggestBoxLoadedRevoker;
     winrt::Popup::Opened_revoker m_popupOpenedRevoker;
     winrt::Popup::Closed_revoker m_popupClosedRevoker;
+
+    // Template parts looked up for the template whose root is m_templateRoot. Weak references
+    // so that this side table, which the AutoSuggestBox owns, doesn't keep an old template alive.
+    winrt::weak_ref<winrt::UIElement> m_templateRoot;
+    winrt::weak_ref<winrt::Border> m_popupBorder;
+    winrt::weak_ref<winrt::TextBox> m_textBox;
+    winrt::weak_ref<winrt::Border> m_textBoxBorder;
 };
@@ -6,6 +6,7 @@ using MUXControlsTestApp.Utilities;
 using System;
 using System.Numerics;
 using System.Collections;
+using System.Collections.Generic;
 using System.Linq;
 using System.Threading;
 using Windows.Foundation;
@@ -32,6 +33,9 @@ using ColorPicker = Microsoft.UI.Xaml.Controls.ColorPicker;
 using ColorChangedEventArgs = Microsoft.UI.Xaml.Controls.ColorChangedEventArgs;
 using ColorSpectrum = Microsoft.UI.Xaml.Controls.Primitives.ColorSpectrum;
 using XamlControlsXamlMetaDataProvider = Microsoft.UI.Xaml.XamlTypeInfo.XamlControlsXamlMetaDataProvider;
+using ColorPickerTestHooks = Microsoft.UI.Private.Controls.ColorPickerTestHooks;
+using ColorPickerUpdateReason = Microsoft.UI.Private.Controls.ColorPickerUpdateReason;
+using ColorPickerUpdateParts = Microsoft.UI.Private.Controls.ColorPickerUpdateParts;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
 {
@@ -264,6 +268,137 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             SetAsRootAndWaitForColorSpectrumFill(colorSpectrum);
         }
 
+        [TestMethod]
+        public void ValidateColorChangesReuseBrushesAndGradientStops()
+        {
+            ColorPicker colorPicker = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                colorPicker = new ColorPicker();
+            });
+
+            SetAsRootAndWaitForColorSpectrumFill(colorPicker);
+
+            RunOnUIThread.Execute(() =>
+            {
+                var previewRectangle = VisualTreeUtils.FindVisualChildByName(colorPicker, "ColorPreviewRectangle") as Rectangle;
+                var thirdDimensionSliderGrid = VisualTreeUtils.FindVisualChildByName(colorPicker, "ThirdDimensionSliderGrid") as Grid;
+                var redTextBox = VisualTreeUtils.FindVisualChildByName(colorPicker, "RedTextBox") as TextBox;
+                var hexTextBox = VisualTreeUtils.FindVisualChildByName(colorPicker, "HexTextBox") as TextBox;
+                Verify.IsNotNull(previewRectangle);
+                Verify.IsNotNull(thirdDimensionSliderGrid);
+                Verify.IsNotNull(redTextBox);
+                Verify.IsNotNull(hexTextBox);
+
+                var previewBrush = previewRectangle.Fill as SolidColorBrush;
+                var sliderBrush = (thirdDimensionSliderGrid.Children[0] as Rectangle).Fill as LinearGradientBrush;
+                Verify.IsNotNull(previewBrush);
+                Verify.IsNotNull(sliderBrush);
+
+                var gradientStops = sliderBrush.GradientStops.ToArray();
+
+                Log.Comment("Changing the color updates the existing brush and gradient stops in place");
+                colorPicker.Color = Colors.Green;
+                colorPicker.Color = Colors.Blue;
+                colorPicker.Color = Color.FromArgb(255, 16, 32, 64);
+
+                Verify.AreSame(previewBrush, previewRectangle.Fill);
+                Verify.AreEqual(Color.FromArgb(255, 16, 32, 64), previewBrush.Color);
+                Verify.AreEqual(gradientStops.Length, sliderBrush.GradientStops.Count);
+                for (int i = 0; i < gradientStops.Length; i++)
+                {
+                    Verify.AreSame(gradientStops[i], sliderBrush.GradientStops[i]);
+                }
+
+                Verify.AreEqual("16", redTextBox.Text);
+                Verify.AreEqual("#102040", hexTextBox.Text);
+            });
+        }
+
+        [TestMethod]
+        public void ValidateColorPickerUpdatePlans()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment("Only changes from the spectrum and the sliders are coalesced");
+                Verify.IsTrue(ColorPickerTestHooks.ShouldCoalesceUpdate(ColorPickerUpdateReason.ColorSpectrumColorChanged));
+                Verify.IsTrue(ColorPickerTestHooks.ShouldCoalesceUpdate(ColorPickerUpdateReason.ThirdDimensionSliderChanged));
+                Verify.IsTrue(ColorPickerTestHooks.ShouldCoalesceUpdate(ColorPickerUpdateReason.AlphaSliderChanged));
+                Verify.IsFalse(ColorPickerTestHooks.ShouldCoalesceUpdate(ColorPickerUpdateReason.ColorPropertyChanged));
+                Verify.IsFalse(ColorPickerTestHooks.ShouldCoalesceUpdate(ColorPickerUpdateReason.RgbTextBoxChanged));
+                Verify.IsFalse(ColorPickerTestHooks.ShouldCoalesceUpdate(ColorPickerUpdateReason.HexTextBoxChanged));
+
+                Log.Comment("The part that caused a change is left alone");
+                Verify.AreEqual(AllColorPickerUpdateParts, ColorPickerTestHooks.GetPartsToUpdate(new[] { ColorPickerUpdateReason.ColorPropertyChanged }));
+                Verify.AreEqual(AllColorPickerUpdateParts & ~ColorPickerUpdateParts.ColorSpectrum,
+                    ColorPickerTestHooks.GetPartsToUpdate(new[] { ColorPickerUpdateReason.ColorSpectrumColorChanged }));
+                Verify.AreEqual(AllColorPickerUpdateParts & ~ColorPickerUpdateParts.RgbTextBoxes,
+                    ColorPickerTestHooks.GetPartsToUpdate(new[] { ColorPickerUpdateReason.RgbTextBoxChanged }));
+
+                Log.Comment("A part is left alone only if it caused every coalesced change");
+                Verify.AreEqual(AllColorPickerUpdateParts & ~ColorPickerUpdateParts.AlphaSlider,
+                    ColorPickerTestHooks.GetPartsToUpdate(new[] { ColorPickerUpdateReason.AlphaSliderChanged, ColorPickerUpdateReason.AlphaSliderChanged }));
+                Verify.AreEqual(AllColorPickerUpdateParts,
+                    ColorPickerTestHooks.GetPartsToUpdate(new[] { ColorPickerUpdateReason.ColorSpectrumColorChanged, ColorPickerUpdateReason.AlphaSliderChanged }));
+
+                Log.Comment("Nothing is refreshed without a change");
+                Verify.AreEqual(ColorPickerUpdateParts.None, ColorPickerTestHooks.GetPartsToUpdate(new ColorPickerUpdateReason[0]));
+            });
+        }
+
+        [TestMethod]
+        public void ValidateSpectrumChangesCoalesceIntoOneUpdatePerFrame()
+        {
+            ColorPicker colorPicker = null;
+            var updates = new List<ColorPickerUpdateParts>();
+            TypedEventHandler<ColorPicker, object> colorControlsUpdatedHandler = (sender, args) =>
+            {
+                if (sender == colorPicker)
+                {
+                    updates.Add((ColorPickerUpdateParts)args);
+                }
+            };
+
+            RunOnUIThread.Execute(() =>
+            {
+                colorPicker = new ColorPicker();
+            });
+
+            SetAsRootAndWaitForColorSpectrumFill(colorPicker);
+
+            RunOnUIThread.Execute(() =>
+            {
+                ColorPickerTestHooks.ColorControlsUpdated += colorControlsUpdatedHandler;
+
+                var colorSpectrum = VisualTreeUtils.FindVisualChildByName(colorPicker, "ColorSpectrum") as ColorSpectrum;
+                Verify.IsNotNull(colorSpectrum);
+
+                Log.Comment("Several spectrum changes within a frame are not applied right away");
+                colorSpectrum.HsvColor = new Vector4(0.0f, 1.0f, 1.0f, 1.0f);
+                colorSpectrum.HsvColor = new Vector4(120.0f, 1.0f, 1.0f, 1.0f);
+                colorSpectrum.HsvColor = new Vector4(240.0f, 1.0f, 1.0f, 1.0f);
+                Verify.AreEqual(0, updates.Count);
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment("They were applied together on the next frame, leaving the spectrum alone");
+                Verify.AreEqual(1, updates.Count);
+                Verify.AreEqual(AllColorPickerUpdateParts & ~ColorPickerUpdateParts.ColorSpectrum, updates[0]);
+                Verify.AreEqual(Colors.Blue, colorPicker.Color);
+
+                Log.Comment("Color property changes are still applied synchronously");
+                colorPicker.Color = Colors.Green;
+                Verify.AreEqual(2, updates.Count);
+                Verify.AreEqual(AllColorPickerUpdateParts, updates[1]);
+
+                ColorPickerTestHooks.ColorControlsUpdated -= colorControlsUpdatedHandler;
+            });
+        }
+
         // XamlControlsXamlMetaDataProvider does not exist in the OS repo,
         // so we can't execute this test as authored there.
         [TestMethod]
@@ -279,6 +414,16 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        private const ColorPickerUpdateParts AllColorPickerUpdateParts =
+            ColorPickerUpdateParts.ColorSpectrum |
+            ColorPickerUpdateParts.ColorPreview |
+            ColorPickerUpdateParts.ThirdDimensionSlider |
+            ColorPickerUpdateParts.AlphaSlider |
+            ColorPickerUpdateParts.RgbTextBoxes |
+            ColorPickerUpdateParts.HsvTextBoxes |
+            ColorPickerUpdateParts.AlphaTextBox |
+            ColorPickerUpdateParts.HexTextBox;
+
         // This takes a FrameworkElement parameter so you can pass in either a ColorPicker or a ColorSpectrum.
         private void SetAsRootAndWaitForColorSpectrumFill(FrameworkElement element)
         {
@@ -6,6 +6,7 @@
 #include "SharedHelpers.h"
 #include "ColorPicker.h"
 #include "ColorSpectrum.h"
+#include "ColorPickerTestHooks.h"
 
 #include "ResourceAccessor.h"
 #include "RuntimeProfiler.h"
@@ -29,6 +30,7 @@ void ColorPicker::OnApplyTemplate()
 
     m_colorPreviewRectangleGrid = GetTemplateChildT<winrt::Grid>(L"ColorPreviewRectangleGrid", thisAsControlProtected);
     m_colorPreviewRectangle = GetTemplateChildT<winrt::Rectangle>(L"ColorPreviewRectangle", thisAsControlProtected);
+    m_colorPreviewRectangleBrush = nullptr;
     m_previousColorRectangle = GetTemplateChildT<winrt::Rectangle>(L"PreviousColorRectangle", thisAsControlProtected);
     m_colorPreviewRectangleCheckeredBackgroundImageBrush = GetTemplateChildT<winrt::ImageBrush>(L"ColorPreviewRectangleCheckeredBackgroundImageBrush", thisAsControlProtected);
 
@@ -353,6 +355,9 @@ void ColorPicker::OnIsAlphaEnabledChanged(winrt::DependencyPropertyChangedEventA
         m_updatingControls = false;
     }
 
+    // The hex text box no longer displays what the planner last wrote to it.
+    m_updatePlanner.InvalidateDisplayedText();
+
     OnPartVisibilityChanged(args);
 }
 
@@ -532,84 +537,119 @@ void ColorPicker::UpdatePreviousColorRectangle()
 
 void ColorPicker::UpdateColorControls(ColorUpdateReason reason)
 {
+    m_updatePlanner.AddChange(reason);
+
+    // While the user drags on the ColorSpectrum or on a slider, we can get many color changes per frame.
+    // Nothing would be rendered in between them, so we only refresh the other controls once per frame.
+    if (ColorPickerUpdatePlanner::ShouldCoalesce(reason) && !SharedHelpers::IsInDesignMode())
+    {
+        if (!m_isColorControlUpdateQueued)
+        {
+            m_isColorControlUpdateQueued = true;
+
+            SharedHelpers::QueueCallbackForCompositionRendering([strongThis = get_strong()]()
+            {
+                strongThis->m_isColorControlUpdateQueued = false;
+                strongThis->FlushColorControlUpdates();
+            });
+        }
+    }
+    else
+    {
+        FlushColorControlUpdates();
+    }
+}
+
+void ColorPicker::FlushColorControlUpdates()
+{
+    if (!m_updatePlanner.HasPendingChanges())
+    {
+        return;
+    }
+
+    // The plan does not include the controls that caused the pending changes, since they already
+    // display the new color. For example, if a user selected a color on the ColorSpectrum, then we
+    // don't want to update the ColorSpectrum's color based on this change.
+    const auto plan = m_updatePlanner.TakePlan(ColorPickerTextValues(m_currentRgb, m_currentHsv, m_currentAlpha, m_currentHex));
+
     // If we're updating the controls internally, we don't want to execute any of the controls'
     // event handlers, because that would then update the color, which would update the color controls,
     // and then we'd be in an infinite loop.
     m_updatingControls = true;
 
-    // We pass in the reason why we're updating the color controls because
-    // we don't want to re-update any control that was the cause of this update.
-    // For example, if a user selected a color on the ColorSpectrum, then we
-    // don't want to update the ColorSpectrum's color based on this change.
-    if (reason != ColorUpdateReason::ColorSpectrumColorChanged && m_colorSpectrum)
+    if (plan.parts.colorSpectrum && m_colorSpectrum)
     {
         m_colorSpectrum.get().HsvColor(winrt::float4{ static_cast<float>(m_currentHsv.h), static_cast<float>(m_currentHsv.s), static_cast<float>(m_currentHsv.v), static_cast<float>(m_currentAlpha) });
     }
 
-    if (m_colorPreviewRectangle)
+    if (plan.parts.colorPreview && m_colorPreviewRectangle)
     {
         auto color = Color();
 
-        m_colorPreviewRectangle.Fill(winrt::SolidColorBrush(color));
+        if (m_colorPreviewRectangleBrush)
+        {
+            m_colorPreviewRectangleBrush.Color(color);
+        }
+        else
+        {
+            m_colorPreviewRectangleBrush = winrt::SolidColorBrush(color);
+            m_colorPreviewRectangle.Fill(m_colorPreviewRectangleBrush);
+        }
     }
 
-    if (reason != ColorUpdateReason::ThirdDimensionSliderChanged && m_thirdDimensionSlider)
+    if (plan.parts.thirdDimensionSlider && m_thirdDimensionSlider)
     {
         UpdateThirdDimensionSlider();
     }
 
-    if (reason != ColorUpdateReason::AlphaSliderChanged && m_alphaSlider)
+    if (plan.parts.alphaSlider && m_alphaSlider)
     {
         UpdateAlphaSlider();
     }
 
     auto strongThis = get_strong();
-    auto updateTextBoxes = [strongThis, reason]()
+    auto updateTextBoxes = [strongThis, plan]()
     {
-        if (reason != ColorUpdateReason::RgbTextBoxChanged)
+        auto const& text = plan.text;
+
+        if (plan.writeRed && strongThis->m_redTextBox)
         {
-            if (strongThis->m_redTextBox)
-            {
-                strongThis->m_redTextBox.Text(to_wstring(static_cast<::byte>(round(strongThis->m_currentRgb.r * 255))));
-            }
+            strongThis->m_redTextBox.Text(to_wstring(text.red));
+        }
 
-            if (strongThis->m_greenTextBox)
-            {
-                strongThis->m_greenTextBox.Text(to_wstring(static_cast<::byte>(round(strongThis->m_currentRgb.g * 255))));
-            }
+        if (plan.writeGreen && strongThis->m_greenTextBox)
+        {
+            strongThis->m_greenTextBox.Text(to_wstring(text.green));
+        }
 
-            if (strongThis->m_blueTextBox)
-            {
-                strongThis->m_blueTextBox.Text(to_wstring(static_cast<::byte>(round(strongThis->m_currentRgb.b * 255))));
-            }
+        if (plan.writeBlue && strongThis->m_blueTextBox)
+        {
+            strongThis->m_blueTextBox.Text(to_wstring(text.blue));
         }
 
-        if (reason != ColorUpdateReason::HsvTextBoxChanged)
+        if (plan.writeHue && strongThis->m_hueTextBox)
         {
-            if (strongThis->m_hueTextBox)
-            {
-                strongThis->m_hueTextBox.Text(to_wstring(static_cast<int>(round(strongThis->m_currentHsv.h))));
-            }
+            strongThis->m_hueTextBox.Text(to_wstring(text.hue));
+        }
 
-            if (strongThis->m_saturationTextBox)
-            {
-                strongThis->m_saturationTextBox.Text(to_wstring(static_cast<int>(round(strongThis->m_currentHsv.s * 100))));
-            }
+        if (plan.writeSaturation && strongThis->m_saturationTextBox)
+        {
+            strongThis->m_saturationTextBox.Text(to_wstring(text.saturation));
+        }
 
-            if (strongThis->m_valueTextBox)
-            {
-                strongThis->m_valueTextBox.Text(to_wstring(static_cast<int>(round(strongThis->m_currentHsv.v * 100))));
-            }
+        if (plan.writeValue && strongThis->m_valueTextBox)
+        {
+            strongThis->m_valueTextBox.Text(to_wstring(text.value));
         }
 
-        if (reason != ColorUpdateReason::AlphaTextBoxChanged && strongThis->m_alphaTextBox)
+        if (plan.writeAlpha && strongThis->m_alphaTextBox)
         {
-            strongThis->m_alphaTextBox.Text(to_wstring(static_cast<int>(round(strongThis->m_currentAlpha * 100))) + wstring(L"%"));
+            strongThis->m_alphaTextBox.Text(to_wstring(text.alpha) + wstring(L"%"));
         }
 
-        if (reason != ColorUpdateReason::HexTextBoxChanged && strongThis->m_hexTextBox)
+        if (plan.writeHex && strongThis->m_hexTextBox)
         {
-            strongThis->m_hexTextBox.Text(strongThis->m_currentHex);
+            strongThis->m_hexTextBox.Text(text.hex);
         }
     };
 
@@ -631,6 +671,8 @@ void ColorPicker::UpdateColorControls(ColorUpdateReason reason)
     }
 
     m_updatingControls = false;
+
+    ColorPickerTestHooks::NotifyColorControlsUpdated(*this, plan.parts);
 }
 
 void ColorPicker::OnColorSpectrumColorChanged(const winrt::ColorSpectrum& sender, const winrt::ColorChangedEventArgs& /*args*/)
@@ -790,6 +832,7 @@ void ColorPicker::OnTextBoxLostFocus(winrt::IInspectable const& sender, winrt::R
 
     // Now that we know that no text box is currently being edited, we'll update all of the color controls
     // in order to clear away any invalid values currently in any text box.
+    m_updatePlanner.InvalidateDisplayedText();
     UpdateColorControls(ColorUpdateReason::ColorPropertyChanged);
 }
 
@@ -1013,100 +1056,18 @@ void ColorPicker::UpdateThirdDimensionSlider()
         return;
     }
 
-    // Since the slider changes only one color dimension, we can use a LinearGradientBrush
-    // for its background instead of needing to manually set pixels ourselves.
-    // We'll have the gradient go between the minimum and maximum values in the case where
-    // the slider handles saturation or value, or in the case where it handles hue,
-    // we'll have it go between red, yellow, green, cyan, blue, and purple, in that order.
-    m_thirdDimensionSliderGradientBrush.GradientStops().Clear();
-
-    switch (ColorSpectrumComponents())
-    {
-    case winrt::ColorSpectrumComponents::HueValue:
-    case winrt::ColorSpectrumComponents::ValueHue:
-    {
-        int minSaturation = MinSaturation();
-        int maxSaturation = MaxSaturation();
-
-        m_thirdDimensionSlider.Minimum(minSaturation);
-        m_thirdDimensionSlider.Maximum(maxSaturation);
-        m_thirdDimensionSlider.Value(m_currentHsv.s * 100);
-
-        // If MinSaturation >= MaxSaturation, then by convention MinSaturation is the only value
-        // that the slider can take.
-        if (minSaturation >= maxSaturation)
-        {
-            maxSaturation = minSaturation;
-        }
-
-        AddGradientStop(m_thirdDimensionSliderGradientBrush, 0.0, { m_currentHsv.h, minSaturation / 100.0, 1.0 }, 1.0);
-        AddGradientStop(m_thirdDimensionSliderGradientBrush, 1.0, { m_currentHsv.h, maxSaturation / 100.0, 1.0 }, 1.0);
-    }
-    break;
-
-    case winrt::ColorSpectrumComponents::HueSaturation:
-    case winrt::ColorSpectrumComponents::SaturationHue:
-    {
-        int minValue = MinValue();
-        int maxValue = MaxValue();
-
-        m_thirdDimensionSlider.Minimum(minValue);
-        m_thirdDimensionSlider.Maximum(maxValue);
-        m_thirdDimensionSlider.Value(m_currentHsv.v * 100);
-
-        // If MinValue >= MaxValue, then by convention MinValue is the only value
-        // that the slider can take.
-        if (minValue >= maxValue)
-        {
-            maxValue = minValue;
-        }
-
-        AddGradientStop(m_thirdDimensionSliderGradientBrush, 0.0, { m_currentHsv.h, m_currentHsv.s, minValue / 100.0 }, 1.0);
-        AddGradientStop(m_thirdDimensionSliderGradientBrush, 1.0, { m_currentHsv.h, m_currentHsv.s, maxValue / 100.0 }, 1.0);
-    }
-    break;
-
-    case winrt::ColorSpectrumComponents::ValueSaturation:
-    case winrt::ColorSpectrumComponents::SaturationValue:
-    {
-        int minHue = MinHue();
-        int maxHue = MaxHue();
-
-        m_thirdDimensionSlider.Minimum(minHue);
-        m_thirdDimensionSlider.Maximum(maxHue);
-        m_thirdDimensionSlider.Value(m_currentHsv.h);
-
-        // If MinHue >= MaxHue, then by convention MinHue is the only value
-        // that the slider can take.
-        if (minHue >= maxHue)
-        {
-            maxHue = minHue;
-        }
-
-        double minOffset = minHue / 359.0;
-        double maxOffset = maxHue / 359.0;
-
-        // With unclamped hue values, we have six different gradient stops, corresponding to red, yellow, green, cyan, blue, and purple.
-        // However, with clamped hue values, we may not need all of those gradient stops.
-        // We know we need a gradient stop at the start and end corresponding to the min and max values for hue,
-        // and then in the middle, we'll add any gradient stops corresponding to the hue of those six pure colors that exist
-        // between the min and max hue.
-        AddGradientStop(m_thirdDimensionSliderGradientBrush, 0.0, { static_cast<double>(minHue), 1.0, 1.0 }, 1.0);
-
-        for (int sextant = 1; sextant <= 5; sextant++)
-        {
-            double offset = sextant / 6.0;
-
-            if (minOffset < offset && maxOffset > offset)
-            {
-                AddGradientStop(m_thirdDimensionSliderGradientBrush, (offset - minOffset) / (maxOffset - minOffset), { 60.0 * sextant, 1.0, 1.0 }, 1.0);
-            }
-        }
-
-        AddGradientStop(m_thirdDimensionSliderGradientBrush, 1.0, { static_cast<double>(maxHue), 1.0, 1.0 }, 1.0);
-    }
-    break;
-    }
+    ApplySliderPlan(
+        m_thirdDimensionSlider,
+        m_thirdDimensionSliderGradientBrush,
+        ColorPickerUpdatePlanner::GetThirdDimensionSliderPlan(
+            ColorSpectrumComponents(),
+            m_currentHsv,
+            MinHue(),
+            MaxHue(),
+            MinSaturation(),
+            MaxSaturation(),
+            MinValue(),
+            MaxValue()));
 }
 
 void ColorPicker::SetThirdDimensionSliderChannel()
@@ -1145,19 +1106,7 @@ void ColorPicker::UpdateAlphaSlider()
         return;
     }
 
-    // Since the slider changes only one color dimension, we can use a LinearGradientBrush
-    // for its background instead of needing to manually set pixels ourselves.
-    // We'll have the gradient go between the minimum and maximum values in the case where
-    // the slider handles saturation or value, or in the case where it handles hue,
-    // we'll have it go between red, yellow, green, cyan, blue, and purple, in that order.
-    m_alphaSliderGradientBrush.GradientStops().Clear();
-
-    m_alphaSlider.Minimum(0);
-    m_alphaSlider.Maximum(100);
-    m_alphaSlider.Value(m_currentAlpha * 100);
-
-    AddGradientStop(m_alphaSliderGradientBrush, 0.0, m_currentHsv, 0.0);
-    AddGradientStop(m_alphaSliderGradientBrush, 1.0, m_currentHsv, 1.0);
+    ApplySliderPlan(m_alphaSlider, m_alphaSliderGradientBrush, ColorPickerUpdatePlanner::GetAlphaSliderPlan(m_currentHsv, m_currentAlpha));
 }
 
 void ColorPicker::CreateColorPreviewCheckeredBackground()
@@ -1212,20 +1161,37 @@ void ColorPicker::CreateAlphaSliderCheckeredBackground()
     }
 }
 
-void ColorPicker::AddGradientStop(const winrt::LinearGradientBrush& brush, double offset, Hsv hsvColor, double alpha)
+void ColorPicker::ApplySliderPlan(const winrt::ColorPickerSlider& slider, const winrt::LinearGradientBrush& brush, const ColorPickerSliderPlan& plan)
 {
-    winrt::GradientStop stop;
+    slider.Minimum(plan.minimum);
+    slider.Maximum(plan.maximum);
+    slider.Value(plan.value);
 
-    Rgb rgbColor = HsvToRgb(hsvColor);
+    auto gradientStops = brush.GradientStops();
 
-    stop.Color(winrt::ColorHelper::FromArgb(
-        static_cast<unsigned char>(round(alpha * 255)),
-        static_cast<unsigned char>(round(rgbColor.r * 255)),
-        static_cast<unsigned char>(round(rgbColor.g * 255)),
-        static_cast<unsigned char>(round(rgbColor.b * 255))));
-    stop.Offset(offset);
+    // The number of stops only changes along with the slider's channel or range, so most of the time
+    // we can update the existing stops in place instead of replacing them.
+    if (gradientStops.Size() != static_cast<uint32_t>(plan.gradientStopCount))
+    {
+        gradientStops.Clear();
 
-    brush.GradientStops().Append(stop);
+        for (int i = 0; i < plan.gradientStopCount; i++)
+        {
+            winrt::GradientStop stop;
+            stop.Color(plan.gradientStops[i].color);
+            stop.Offset(plan.gradientStops[i].offset);
+            gradientStops.Append(stop);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < plan.gradientStopCount; i++)
+        {
+            auto stop = gradientStops.GetAt(i);
+            stop.Color(plan.gradientStops[i].color);
+            stop.Offset(plan.gradientStops[i].offset);
+        }
+    }
 }
 
 winrt::Color ColorPicker::GetCheckerColor()
@@ -5,6 +5,7 @@
 
 #include "ColorHelpers.h"
 #include "ColorChangedEventArgs.h"
+#include "ColorPickerUpdatePlanner.h"
 #include "DispatcherHelper.h"
 
 #include "ColorPicker.g.h"
@@ -82,23 +83,10 @@ private:
     // Helper functions
     void UpdateVisualState(bool useTransitions);
 
-    static void AddGradientStop(const winrt::LinearGradientBrush& brush, double offset, Hsv hsvColor, double alpha);
+    static void ApplySliderPlan(const winrt::ColorPickerSlider& slider, const winrt::LinearGradientBrush& brush, const ColorPickerSliderPlan& plan);
 
     winrt::Color GetCheckerColor();
 
-    enum class ColorUpdateReason
-    {
-        InitializingColor,
-        ColorPropertyChanged,
-        ColorSpectrumColorChanged,
-        ThirdDimensionSliderChanged,
-        AlphaSliderChanged,
-        RgbTextBoxChanged,
-        HsvTextBoxChanged,
-        AlphaTextBoxChanged,
-        HexTextBoxChanged,
-    };
-
     void InitializeColor();
     void UpdateColor(const Rgb &rgb, ColorUpdateReason reason);
     void UpdateColor(const Hsv &hsv, ColorUpdateReason reason);
@@ -108,6 +96,7 @@ private:
     void UpdatePreviousColorRectangle();
 
     void UpdateColorControls(ColorUpdateReason reason);
+    void FlushColorControlUpdates();
 
     void UpdateThirdDimensionSlider();
     void SetThirdDimensionSliderChannel();
@@ -126,6 +115,8 @@ private:
 
     bool m_updatingColor{ false };
     bool m_updatingControls{ false };
+    bool m_isColorControlUpdateQueued{ false };
+    ColorPickerUpdatePlanner m_updatePlanner{};
     Rgb m_currentRgb{ 1.0, 1.0, 1.0 };
     Hsv m_currentHsv{ 0.0, 1.0, 1.0 };
     winrt::hstring m_currentHex{ L"#FFFFFFFF" };
@@ -141,6 +132,7 @@ private:
 
     winrt::Grid m_colorPreviewRectangleGrid{ nullptr };
     winrt::Rectangle m_colorPreviewRectangle{ nullptr };
+    winrt::SolidColorBrush m_colorPreviewRectangleBrush{ nullptr };
     winrt::Rectangle m_previousColorRectangle{ nullptr };
     winrt::ImageBrush m_colorPreviewRectangleCheckeredBackgroundImageBrush{ nullptr };
     winrt::IAsyncAction m_createColorPreviewRectangleCheckeredBackgroundBitmapAction{ nullptr };
@@ -0,0 +1,95 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "ColorPickerTestHooks.h"
+
+com_ptr<ColorPickerTestHooks> ColorPickerTestHooks::s_testHooks{};
+
+namespace
+{
+    ColorUpdateReason ToColorUpdateReason(winrt::ColorPickerUpdateReason reason)
+    {
+        switch (reason)
+        {
+        case winrt::ColorPickerUpdateReason::InitializingColor: return ColorUpdateReason::InitializingColor;
+        case winrt::ColorPickerUpdateReason::ColorPropertyChanged: return ColorUpdateReason::ColorPropertyChanged;
+        case winrt::ColorPickerUpdateReason::ColorSpectrumColorChanged: return ColorUpdateReason::ColorSpectrumColorChanged;
+        case winrt::ColorPickerUpdateReason::ThirdDimensionSliderChanged: return ColorUpdateReason::ThirdDimensionSliderChanged;
+        case winrt::ColorPickerUpdateReason::AlphaSliderChanged: return ColorUpdateReason::AlphaSliderChanged;
+        case winrt::ColorPickerUpdateReason::RgbTextBoxChanged: return ColorUpdateReason::RgbTextBoxChanged;
+        case winrt::ColorPickerUpdateReason::HsvTextBoxChanged: return ColorUpdateReason::HsvTextBoxChanged;
+        case winrt::ColorPickerUpdateReason::AlphaTextBoxChanged: return ColorUpdateReason::AlphaTextBoxChanged;
+        case winrt::ColorPickerUpdateReason::HexTextBoxChanged: return ColorUpdateReason::HexTextBoxChanged;
+        }
+
+        throw winrt::hresult_invalid_argument();
+    }
+
+    winrt::ColorPickerUpdateParts ToColorPickerUpdateParts(const ColorPickerParts& parts)
+    {
+        auto result = winrt::ColorPickerUpdateParts::None;
+
+        if (parts.colorSpectrum) result |= winrt::ColorPickerUpdateParts::ColorSpectrum;
+        if (parts.colorPreview) result |= winrt::ColorPickerUpdateParts::ColorPreview;
+        if (parts.thirdDimensionSlider) result |= winrt::ColorPickerUpdateParts::ThirdDimensionSlider;
+        if (parts.alphaSlider) result |= winrt::ColorPickerUpdateParts::AlphaSlider;
+        if (parts.rgbTextBoxes) result |= winrt::ColorPickerUpdateParts::RgbTextBoxes;
+        if (parts.hsvTextBoxes) result |= winrt::ColorPickerUpdateParts::HsvTextBoxes;
+        if (parts.alphaTextBox) result |= winrt::ColorPickerUpdateParts::AlphaTextBox;
+        if (parts.hexTextBox) result |= winrt::ColorPickerUpdateParts::HexTextBox;
+
+        return result;
+    }
+}
+
+com_ptr<ColorPickerTestHooks> ColorPickerTestHooks::EnsureGlobalTestHooks()
+{
+    static bool s_initialized = []() {
+        s_testHooks = winrt::make_self<ColorPickerTestHooks>();
+        return true;
+    }();
+    return s_testHooks;
+}
+
+bool ColorPickerTestHooks::ShouldCoalesceUpdate(winrt::ColorPickerUpdateReason const& reason)
+{
+    return ColorPickerUpdatePlanner::ShouldCoalesce(ToColorUpdateReason(reason));
+}
+
+winrt::ColorPickerUpdateParts ColorPickerTestHooks::GetPartsToUpdate(winrt::array_view<winrt::ColorPickerUpdateReason const> const& reasons)
+{
+    ColorPickerUpdatePlanner planner;
+
+    for (const auto reason : reasons)
+    {
+        planner.AddChange(ToColorUpdateReason(reason));
+    }
+
+    return ToColorPickerUpdateParts(planner.TakePlan(ColorPickerTextValues{}).parts);
+}
+
+void ColorPickerTestHooks::NotifyColorControlsUpdated(const winrt::ColorPicker& sender, const ColorPickerParts& parts)
+{
+    // Only tests subscribe to this, so there is nothing to do unless they created the hooks.
+    if (auto hooks = GetGlobalTestHooks())
+    {
+        if (hooks->m_colorControlsUpdatedEventSource)
+        {
+            hooks->m_colorControlsUpdatedEventSource(sender, box_value(ToColorPickerUpdateParts(parts)));
+        }
+    }
+}
+
+winrt::event_token ColorPickerTestHooks::ColorControlsUpdated(winrt::TypedEventHandler<winrt::ColorPicker, winrt::IInspectable> const& value)
+{
+    auto hooks = EnsureGlobalTestHooks();
+    return hooks->m_colorControlsUpdatedEventSource.add(value);
+}
+
+void ColorPickerTestHooks::ColorControlsUpdated(winrt::event_token const& token)
+{
+    auto hooks = EnsureGlobalTestHooks();
+    hooks->m_colorControlsUpdatedEventSource.remove(token);
+}
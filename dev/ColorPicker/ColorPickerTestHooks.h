@@ -0,0 +1,33 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "ColorPickerUpdatePlanner.h"
+
+#include "ColorPickerTestHooks.g.h"
+
+class ColorPickerTestHooks :
+    public winrt::implementation::ColorPickerTestHooksT<ColorPickerTestHooks>
+{
+public:
+    static com_ptr<ColorPickerTestHooks> GetGlobalTestHooks()
+    {
+        return s_testHooks;
+    }
+
+    static com_ptr<ColorPickerTestHooks> EnsureGlobalTestHooks();
+
+    static bool ShouldCoalesceUpdate(winrt::ColorPickerUpdateReason const& reason);
+    static winrt::ColorPickerUpdateParts GetPartsToUpdate(winrt::array_view<winrt::ColorPickerUpdateReason const> const& reasons);
+
+    static void NotifyColorControlsUpdated(const winrt::ColorPicker& sender, const ColorPickerParts& parts);
+    static winrt::event_token ColorControlsUpdated(winrt::TypedEventHandler<winrt::ColorPicker, winrt::IInspectable> const& value);
+    static void ColorControlsUpdated(winrt::event_token const& token);
+
+private:
+    static com_ptr<ColorPickerTestHooks> s_testHooks;
+    winrt::event<winrt::TypedEventHandler<winrt::ColorPicker, winrt::IInspectable>> m_colorControlsUpdatedEventSource;
+};
+
+CppWinRTActivatableClassWithBasicFactory(ColorPickerTestHooks)
@@ -0,0 +1,258 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "ColorPickerUpdatePlanner.h"
+
+bool ColorPickerParts::Any() const
+{
+    return colorSpectrum || colorPreview || thirdDimensionSlider || alphaSlider || rgbTextBoxes || hsvTextBoxes || alphaTextBox || hexTextBox;
+}
+
+ColorPickerParts& ColorPickerParts::operator|=(const ColorPickerParts& other)
+{
+    colorSpectrum |= other.colorSpectrum;
+    colorPreview |= other.colorPreview;
+    thirdDimensionSlider |= other.thirdDimensionSlider;
+    alphaSlider |= other.alphaSlider;
+    rgbTextBoxes |= other.rgbTextBoxes;
+    hsvTextBoxes |= other.hsvTextBoxes;
+    alphaTextBox |= other.alphaTextBox;
+    hexTextBox |= other.hexTextBox;
+    return *this;
+}
+
+ColorPickerTextValues::ColorPickerTextValues(const Rgb &rgb, const Hsv &hsv, double alpha, const winrt::hstring& hex) :
+    red(static_cast<::byte>(round(rgb.r * 255))),
+    green(static_cast<::byte>(round(rgb.g * 255))),
+    blue(static_cast<::byte>(round(rgb.b * 255))),
+    hue(static_cast<int>(round(hsv.h))),
+    saturation(static_cast<int>(round(hsv.s * 100))),
+    value(static_cast<int>(round(hsv.v * 100))),
+    alpha(static_cast<int>(round(alpha * 100))),
+    hex(hex)
+{
+}
+
+void ColorPickerSliderPlan::AddGradientStop(double offset, const Hsv &hsvColor, double alpha)
+{
+    MUX_ASSERT(gradientStopCount < MaxGradientStopCount);
+
+    gradientStops[gradientStopCount++] = { offset, ColorFromRgba(HsvToRgb(hsvColor), alpha) };
+}
+
+bool ColorPickerUpdatePlanner::ShouldCoalesce(ColorUpdateReason reason)
+{
+    return reason == ColorUpdateReason::ColorSpectrumColorChanged ||
+        reason == ColorUpdateReason::ThirdDimensionSliderChanged ||
+        reason == ColorUpdateReason::AlphaSliderChanged;
+}
+
+ColorPickerParts ColorPickerUpdatePlanner::GetPartsToUpdate(ColorUpdateReason reason)
+{
+    ColorPickerParts parts;
+
+    parts.colorSpectrum = reason != ColorUpdateReason::ColorSpectrumColorChanged;
+    parts.colorPreview = true;
+    parts.thirdDimensionSlider = reason != ColorUpdateReason::ThirdDimensionSliderChanged;
+    parts.alphaSlider = reason != ColorUpdateReason::AlphaSliderChanged;
+    parts.rgbTextBoxes = reason != ColorUpdateReason::RgbTextBoxChanged;
+    parts.hsvTextBoxes = reason != ColorUpdateReason::HsvTextBoxChanged;
+    parts.alphaTextBox = reason != ColorUpdateReason::AlphaTextBoxChanged;
+    parts.hexTextBox = reason != ColorUpdateReason::HexTextBoxChanged;
+
+    return parts;
+}
+
+ColorPickerSliderPlan ColorPickerUpdatePlanner::GetThirdDimensionSliderPlan(
+    winrt::ColorSpectrumComponents components,
+    const Hsv &hsv,
+    int minHue,
+    int maxHue,
+    int minSaturation,
+    int maxSaturation,
+    int minValue,
+    int maxValue)
+{
+    ColorPickerSliderPlan plan;
+
+    // Since the slider changes only one color dimension, we can use a LinearGradientBrush
+    // for its background instead of needing to manually set pixels ourselves.
+    // We'll have the gradient go between the minimum and maximum values in the case where
+    // the slider handles saturation or value, or in the case where it handles hue,
+    // we'll have it go between red, yellow, green, cyan, blue, and purple, in that order.
+    switch (components)
+    {
+    case winrt::ColorSpectrumComponents::HueValue:
+    case winrt::ColorSpectrumComponents::ValueHue:
+    {
+        plan.minimum = minSaturation;
+        plan.maximum = maxSaturation;
+        plan.value = hsv.s * 100;
+
+        // If MinSaturation >= MaxSaturation, then by convention MinSaturation is the only value
+        // that the slider can take.
+        if (minSaturation >= maxSaturation)
+        {
+            maxSaturation = minSaturation;
+        }
+
+        plan.AddGradientStop(0.0, { hsv.h, minSaturation / 100.0, 1.0 }, 1.0);
+        plan.AddGradientStop(1.0, { hsv.h, maxSaturation / 100.0, 1.0 }, 1.0);
+    }
+    break;
+
+    case winrt::ColorSpectrumComponents::HueSaturation:
+    case winrt::ColorSpectrumComponents::SaturationHue:
+    {
+        plan.minimum = minValue;
+        plan.maximum = maxValue;
+        plan.value = hsv.v * 100;
+
+        // If MinValue >= MaxValue, then by convention MinValue is the only value
+        // that the slider can take.
+        if (minValue >= maxValue)
+        {
+            maxValue = minValue;
+        }
+
+        plan.AddGradientStop(0.0, { hsv.h, hsv.s, minValue / 100.0 }, 1.0);
+        plan.AddGradientStop(1.0, { hsv.h, hsv.s, maxValue / 100.0 }, 1.0);
+    }
+    break;
+
+    case winrt::ColorSpectrumComponents::ValueSaturation:
+    case winrt::ColorSpectrumComponents::SaturationValue:
+    {
+        plan.minimum = minHue;
+        plan.maximum = maxHue;
+        plan.value = hsv.h;
+
+        // If MinHue >= MaxHue, then by convention MinHue is the only value
+        // that the slider can take.
+        if (minHue >= maxHue)
+        {
+            maxHue = minHue;
+        }
+
+        double minOffset = minHue / 359.0;
+        double maxOffset = maxHue / 359.0;
+
+        // With unclamped hue values, we have six different gradient stops, corresponding to red, yellow, green, cyan, blue, and purple.
+        // However, with clamped hue values, we may not need all of those gradient stops.
+        // We know we need a gradient stop at the start and end corresponding to the min and max values for hue,
+        // and then in the middle, we'll add any gradient stops corresponding to the hue of those six pure colors that exist
+        // between the min and max hue.
+        plan.AddGradientStop(0.0, { static_cast<double>(minHue), 1.0, 1.0 }, 1.0);
+
+        for (int sextant = 1; sextant <= 5; sextant++)
+        {
+            double offset = sextant / 6.0;
+
+            if (minOffset < offset && maxOffset > offset)
+            {
+                plan.AddGradientStop((offset - minOffset) / (maxOffset - minOffset), { 60.0 * sextant, 1.0, 1.0 }, 1.0);
+            }
+        }
+
+        plan.AddGradientStop(1.0, { static_cast<double>(maxHue), 1.0, 1.0 }, 1.0);
+    }
+    break;
+    }
+
+    return plan;
+}
+
+ColorPickerSliderPlan ColorPickerUpdatePlanner::GetAlphaSliderPlan(const Hsv &hsv, double alpha)
+{
+    ColorPickerSliderPlan plan;
+
+    plan.minimum = 0;
+    plan.maximum = 100;
+    plan.value = alpha * 100;
+
+    plan.AddGradientStop(0.0, hsv, 0.0);
+    plan.AddGradientStop(1.0, hsv, 1.0);
+
+    return plan;
+}
+
+void ColorPickerUpdatePlanner::AddChange(ColorUpdateReason reason)
+{
+    m_pendingParts |= GetPartsToUpdate(reason);
+
+    // The text box that caused the change holds whatever the user typed, which may not be
+    // formatted the way we would format it, so we no longer know what it displays.
+    switch (reason)
+    {
+    case ColorUpdateReason::InitializingColor:
+        InvalidateDisplayedText();
+        break;
+
+    case ColorUpdateReason::RgbTextBoxChanged:
+        m_displayedText.red = m_displayedText.green = m_displayedText.blue = -1;
+        break;
+
+    case ColorUpdateReason::HsvTextBoxChanged:
+        m_displayedText.hue = m_displayedText.saturation = m_displayedText.value = -1;
+        break;
+
+    case ColorUpdateReason::AlphaTextBoxChanged:
+        m_displayedText.alpha = -1;
+        break;
+
+    case ColorUpdateReason::HexTextBoxChanged:
+        m_displayedText.hex = {};
+        break;
+    }
+}
+
+void ColorPickerUpdatePlanner::InvalidateDisplayedText()
+{
+    m_displayedText = {};
+}
+
+ColorPickerUpdatePlan ColorPickerUpdatePlanner::TakePlan(const ColorPickerTextValues& textValues)
+{
+    ColorPickerUpdatePlan plan;
+
+    plan.parts = m_pendingParts;
+    plan.text = textValues;
+
+    if (plan.parts.rgbTextBoxes)
+    {
+        plan.writeRed = textValues.red != m_displayedText.red;
+        plan.writeGreen = textValues.green != m_displayedText.green;
+        plan.writeBlue = textValues.blue != m_displayedText.blue;
+        m_displayedText.red = textValues.red;
+        m_displayedText.green = textValues.green;
+        m_displayedText.blue = textValues.blue;
+    }
+
+    if (plan.parts.hsvTextBoxes)
+    {
+        plan.writeHue = textValues.hue != m_displayedText.hue;
+        plan.writeSaturation = textValues.saturation != m_displayedText.saturation;
+        plan.writeValue = textValues.value != m_displayedText.value;
+        m_displayedText.hue = textValues.hue;
+        m_displayedText.saturation = textValues.saturation;
+        m_displayedText.value = textValues.value;
+    }
+
+    if (plan.parts.alphaTextBox)
+    {
+        plan.writeAlpha = textValues.alpha != m_displayedText.alpha;
+        m_displayedText.alpha = textValues.alpha;
+    }
+
+    if (plan.parts.hexTextBox)
+    {
+        plan.writeHex = m_displayedText.hex.empty() || textValues.hex != m_displayedText.hex;
+        m_displayedText.hex = textValues.hex;
+    }
+
+    m_pendingParts = {};
+
+    return plan;
+}
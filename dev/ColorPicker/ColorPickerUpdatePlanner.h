@@ -0,0 +1,127 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "ColorConversion.h"
+
+enum class ColorUpdateReason
+{
+    InitializingColor,
+    ColorPropertyChanged,
+    ColorSpectrumColorChanged,
+    ThirdDimensionSliderChanged,
+    AlphaSliderChanged,
+    RgbTextBoxChanged,
+    HsvTextBoxChanged,
+    AlphaTextBoxChanged,
+    HexTextBoxChanged,
+};
+
+// The parts of the ColorPicker template that display the current color.
+struct ColorPickerParts
+{
+    bool colorSpectrum{ false };
+    bool colorPreview{ false };
+    bool thirdDimensionSlider{ false };
+    bool alphaSlider{ false };
+    bool rgbTextBoxes{ false };
+    bool hsvTextBoxes{ false };
+    bool alphaTextBox{ false };
+    bool hexTextBox{ false };
+
+    bool Any() const;
+    ColorPickerParts& operator|=(const ColorPickerParts& other);
+};
+
+// The values displayed by the ColorPicker's text boxes, before they are formatted.
+// A value of -1 (or an empty hex string) means that the displayed value is unknown.
+struct ColorPickerTextValues
+{
+    ColorPickerTextValues() = default;
+    ColorPickerTextValues(const Rgb &rgb, const Hsv &hsv, double alpha, const winrt::hstring& hex);
+
+    int red{ -1 };
+    int green{ -1 };
+    int blue{ -1 };
+    int hue{ -1 };
+    int saturation{ -1 };
+    int value{ -1 };
+    int alpha{ -1 };
+    winrt::hstring hex{};
+};
+
+struct ColorPickerUpdatePlan
+{
+    ColorPickerParts parts{};
+
+    // Text boxes whose formatted value changed since it was last written.
+    bool writeRed{ false };
+    bool writeGreen{ false };
+    bool writeBlue{ false };
+    bool writeHue{ false };
+    bool writeSaturation{ false };
+    bool writeValue{ false };
+    bool writeAlpha{ false };
+    bool writeHex{ false };
+    ColorPickerTextValues text{};
+};
+
+struct ColorPickerGradientStop
+{
+    double offset{};
+    winrt::Color color{};
+};
+
+struct ColorPickerSliderPlan
+{
+    // The hue slider needs a stop at each end plus one for each of the five pure colors in between.
+    static constexpr int MaxGradientStopCount = 7;
+
+    double minimum{};
+    double maximum{};
+    double value{};
+    std::array<ColorPickerGradientStop, MaxGradientStopCount> gradientStops{};
+    int gradientStopCount{};
+
+    void AddGradientStop(double offset, const Hsv &hsvColor, double alpha);
+};
+
+// Decides which parts of the ColorPicker need to be refreshed after the color changed, and what they should display.
+// This has no dependency on the ColorPicker's template parts so that the decisions can be verified on their own.
+class ColorPickerUpdatePlanner
+{
+public:
+    // Changes caused by the user dragging on the spectrum or on one of the sliders can arrive many times per frame,
+    // so the controls displaying the color are only refreshed once per rendered frame for those.
+    static bool ShouldCoalesce(ColorUpdateReason reason);
+
+    // Returns the parts that need to be refreshed for a color change. The part that caused the change
+    // already displays the new color, so it is left alone.
+    static ColorPickerParts GetPartsToUpdate(ColorUpdateReason reason);
+
+    static ColorPickerSliderPlan GetThirdDimensionSliderPlan(
+        winrt::ColorSpectrumComponents components,
+        const Hsv &hsv,
+        int minHue,
+        int maxHue,
+        int minSaturation,
+        int maxSaturation,
+        int minValue,
+        int maxValue);
+    static ColorPickerSliderPlan GetAlphaSliderPlan(const Hsv &hsv, double alpha);
+
+    // Accumulates the parts to refresh until the next call to TakePlan. When several changes are coalesced,
+    // a part is only left alone if it caused every one of them.
+    void AddChange(ColorUpdateReason reason);
+    bool HasPendingChanges() const { return m_pendingParts.Any(); }
+
+    // Forgets what the text boxes are known to display, for instance because the user typed in them.
+    void InvalidateDisplayedText();
+
+    ColorPickerUpdatePlan TakePlan(const ColorPickerTextValues& textValues);
+
+private:
+    ColorPickerParts m_pendingParts{};
+    ColorPickerTextValues m_displayedText{};
+};
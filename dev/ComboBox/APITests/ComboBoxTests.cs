@@ -17,6 +17,8 @@ using Microsoft.VisualStudio.TestTools.UnitTesting;
 using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
 #endif
 
+using ComboBoxHelper = Microsoft.UI.Xaml.Controls.Primitives.ComboBoxHelper;
+
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
 {
     [TestClass]
@@ -97,6 +99,120 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        public void VerifyComboBoxEditModeCornerRadiusAfterTemplateReapplied()
+        {
+            if (PlatformConfiguration.IsOSVersionLessThan(OSVersion.Redstone5))
+            {
+                Log.Warning("ComboBox corner radius is not available pre-rs5");
+                return;
+            }
+
+            var comboBox = SetupComboBox();
+            RunOnUIThread.Execute(() =>
+            {
+                comboBox.CornerRadius = new CornerRadius(2);
+                comboBox.IsEditable = true;
+                comboBox.IsDropDownOpen = true;
+            });
+            IdleSynchronizer.Wait();
+
+            ControlTemplate template = null;
+            RunOnUIThread.Execute(() =>
+            {
+                comboBox.IsDropDownOpen = false;
+                template = comboBox.Template;
+                comboBox.Template = null;
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                comboBox.Template = template;
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                comboBox.IsDropDownOpen = true;
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                // Only the parts of the new template should be found and updated.
+                var editableText = TestUtilities.FindDescendents<TextBox>(comboBox).Where(e => e.Name == "EditableText").Single();
+                Verify.AreEqual(new CornerRadius(2, 2, 0, 0), editableText.CornerRadius);
+
+                var overlayCornerRadius = new CornerRadius(0, 0, 0, 0);
+                var radius = App.Current.Resources["OverlayCornerRadius"];
+                if (radius != null)
+                {
+                    overlayCornerRadius = (CornerRadius)radius;
+                }
+                var popup = VisualTreeHelper.GetOpenPopups(Window.Current).Last();
+                var popupBorder = TestUtilities.FindDescendents<Border>(popup).Where(e => e.Name == "PopupBorder").Single();
+                Verify.AreEqual(new CornerRadius(0, 0, overlayCornerRadius.BottomRight, overlayCornerRadius.BottomLeft), popupBorder.CornerRadius);
+
+                comboBox.IsDropDownOpen = false;
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                var editableText = TestUtilities.FindDescendents<TextBox>(comboBox).Where(e => e.Name == "EditableText").Single();
+                Verify.AreEqual(new CornerRadius(2), editableText.CornerRadius);
+            });
+        }
+
+        [TestMethod]
+        public void VerifyComboBoxKeepInteriorCornersSquareTeardown()
+        {
+            if (PlatformConfiguration.IsOSVersionLessThan(OSVersion.Redstone5))
+            {
+                Log.Warning("ComboBox corner radius is not available pre-rs5");
+                return;
+            }
+
+            var comboBox = SetupComboBox();
+            RunOnUIThread.Execute(() =>
+            {
+                comboBox.CornerRadius = new CornerRadius(2);
+                comboBox.IsEditable = true;
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                ComboBoxHelper.SetKeepInteriorCornersSquare(comboBox, false);
+                comboBox.IsDropDownOpen = true;
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                // With the behavior turned off the corners are left as the template sets them.
+                var editableText = TestUtilities.FindDescendents<TextBox>(comboBox).Where(e => e.Name == "EditableText").Single();
+                Verify.AreEqual(new CornerRadius(2), editableText.CornerRadius);
+
+                comboBox.IsDropDownOpen = false;
+                ComboBoxHelper.SetKeepInteriorCornersSquare(comboBox, true);
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                comboBox.IsDropDownOpen = true;
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                var editableText = TestUtilities.FindDescendents<TextBox>(comboBox).Where(e => e.Name == "EditableText").Single();
+                Verify.AreEqual(new CornerRadius(2, 2, 0, 0), editableText.CornerRadius);
+            });
+        }
+
         private ComboBox SetupComboBox()
         {
             ComboBox comboBox = null;
@@ -14,6 +14,15 @@ static constexpr auto c_controlCornerRadiusKey = L"ControlCornerRadius"sv;
 static constexpr auto c_overlayCornerRadiusKey = L"OverlayCornerRadius"sv;
 GlobalDependencyProperty ComboBoxHelper::s_DropDownEventRevokersProperty{ nullptr };
 
+template <typename T>
+static void SetCornerRadiusIfChanged(const T& element, const winrt::CornerRadius& cornerRadius)
+{
+    if (element.CornerRadius() != cornerRadius)
+    {
+        element.CornerRadius(cornerRadius);
+    }
+}
+
 ComboBoxHelper::ComboBoxHelper()
 {
     EnsureProperties();
@@ -89,6 +98,47 @@ void ComboBoxHelper::OnDropDownClosed(const winrt::IInspectable& sender, const w
     UpdateCornerRadius(comboBox, /*IsDropDownOpen=*/false);
 }
 
+// Looking the parts up by name walks the template, which is wasteful to do on every open and close.
+// They are cached in the per-instance side table and looked up again only when the ComboBox's
+// template root changes, which is the case whenever a new template has been applied.
+ComboBoxTemplateParts ComboBoxHelper::GetTemplateParts(const winrt::ComboBox& comboBox)
+{
+    ComboBoxTemplateParts parts;
+
+    auto revokersInspectable = comboBox.GetValue(DropDownEventRevokersProperty());
+    if (!revokersInspectable || winrt::VisualTreeHelper::GetChildrenCount(comboBox) == 0)
+    {
+        return parts;
+    }
+
+    auto revokers = revokersInspectable.as<ComboBoxDropDownEventRevokers>();
+    auto templateRoot = winrt::VisualTreeHelper::GetChild(comboBox, 0).try_as<winrt::UIElement>();
+
+    if (revokers->m_templateRoot.get() != templateRoot)
+    {
+        revokers->m_templateRoot = templateRoot;
+        revokers->m_popupBorder = GetTemplateChildT<winrt::Border>(c_popupBorderName, comboBox);
+        revokers->m_editableText = GetTemplateChildT<winrt::TextBox>(c_editableTextName, comboBox);
+        revokers->m_editableTextBorder = nullptr;
+    }
+
+    parts.popupBorder = revokers->m_popupBorder.get();
+    parts.editableText = revokers->m_editableText.get();
+
+    if (parts.editableText && !parts.editableText.try_as<winrt::IControl7>())
+    {
+        // The TextBox applies its own template later than the ComboBox, so keep trying until its border is found.
+        parts.editableTextBorder = revokers->m_editableTextBorder.get();
+        if (!parts.editableTextBorder)
+        {
+            parts.editableTextBorder = GetTemplateChildT<winrt::Border>(c_editableTextBorderName, parts.editableText);
+            revokers->m_editableTextBorder = parts.editableTextBorder;
+        }
+    }
+
+    return parts;
+}
+
 void ComboBoxHelper::UpdateCornerRadius(const winrt::ComboBox& comboBox, bool isDropDownOpen)
 {
     if (comboBox.IsEditable())
@@ -101,9 +151,11 @@ void ComboBoxHelper::UpdateCornerRadius(const winrt::ComboBox& comboBox, bool is
             textBoxRadius = comboBoxControl7.CornerRadius();
         }
 
+        auto const parts = GetTemplateParts(comboBox);
+
         if (isDropDownOpen)
         {
-            bool isOpenDown = IsPopupOpenDown(comboBox);
+            bool isOpenDown = IsPopupOpenDown(parts);
             auto cornerRadiusConverter = winrt::make_self<CornerRadiusFilterConverter>();
 
             auto popupRadiusFilter = isOpenDown ? winrt::CornerRadiusFilterKind::Bottom : winrt::CornerRadiusFilterKind::Top;
@@ -113,39 +165,33 @@ void ComboBoxHelper::UpdateCornerRadius(const winrt::ComboBox& comboBox, bool is
             textBoxRadius = cornerRadiusConverter->Convert(textBoxRadius, textBoxRadiusFilter);
         }
 
-        if (auto popupBorder = GetTemplateChildT<winrt::Border>(c_popupBorderName, comboBox))
+        if (parts.popupBorder)
         {
-            popupBorder.CornerRadius(popupRadius);
+            SetCornerRadiusIfChanged(parts.popupBorder, popupRadius);
         }
 
-        if (auto textBox = GetTemplateChildT<winrt::TextBox>(c_editableTextName, comboBox))
+        if (parts.editableText)
         {
-            if (winrt::IControl7 textBoxControl7 = textBox)
+            if (winrt::IControl7 textBoxControl7 = parts.editableText)
             {
-                textBoxControl7.CornerRadius(textBoxRadius);
+                SetCornerRadiusIfChanged(textBoxControl7, textBoxRadius);
             }
-            else
+            else if (parts.editableTextBorder)
             {
-                if (auto textBorder = GetTemplateChildT<winrt::Border>(c_editableTextBorderName, textBox))
-                {
-                    textBorder.CornerRadius(textBoxRadius);
-                }
+                SetCornerRadiusIfChanged(parts.editableTextBorder, textBoxRadius);
             }
         }
     }
 }
 
-bool ComboBoxHelper::IsPopupOpenDown(const winrt::ComboBox& comboBox)
+bool ComboBoxHelper::IsPopupOpenDown(const ComboBoxTemplateParts& parts)
 {
     double verticalOffset = 0;
-    if (auto popupBorder = GetTemplateChildT<winrt::Border>(c_popupBorderName, comboBox))
+    if (parts.popupBorder && parts.editableText)
     {
-        if (auto textBox = GetTemplateChildT<winrt::TextBox>(c_editableTextName, comboBox))
-        {
-            auto transform = popupBorder.TransformToVisual(textBox);
-            auto popupTop = transform.TransformPoint(winrt::Point(0, 0));
-            verticalOffset = popupTop.Y;
-        }
+        auto transform = parts.popupBorder.TransformToVisual(parts.editableText);
+        auto popupTop = transform.TransformPoint(winrt::Point(0, 0));
+        verticalOffset = popupTop.Y;
     }
     return verticalOffset > 0;
 }
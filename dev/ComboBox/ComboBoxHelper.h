@@ -5,6 +5,14 @@
 #include "ComboBoxHelper.g.h"
 #include "ComboBoxHelper.properties.h"
 
+struct ComboBoxTemplateParts
+{
+    winrt::Border popupBorder{ nullptr };
+    winrt::TextBox editableText{ nullptr };
+    // Only resolved when the TextBox doesn't expose CornerRadius itself.
+    winrt::Border editableTextBorder{ nullptr };
+};
+
 class ComboBoxHelper
     : public winrt::implementation::ComboBoxHelperT<ComboBoxHelper>
     , public ComboBoxHelperProperties
@@ -23,8 +31,9 @@ private:
     static void OnDropDownOpened(const winrt::IInspectable& sender, const winrt::IInspectable& args);
     static void OnDropDownClosed(const winrt::IInspectable& sender, const winrt::IInspectable& args);
 
+    static ComboBoxTemplateParts GetTemplateParts(const winrt::ComboBox& comboBox);
     static void UpdateCornerRadius(const winrt::ComboBox& comboBox, bool isDropDownOpen);
-    static bool IsPopupOpenDown(const winrt::ComboBox& comboBox);
+    static bool IsPopupOpenDown(const ComboBoxTemplateParts& parts);
     static winrt::IInspectable ResourceLookup(const winrt::Control& control, const winrt::IInspectable& key);
 };
 
@@ -40,4 +49,11 @@ public:
 
     winrt::ComboBox::DropDownOpened_revoker m_dropDownOpenedRevoker;
     winrt::ComboBox::DropDownClosed_revoker m_dropDownClosedRevoker;
+
+    // Template parts looked up for the template whose root is m_templateRoot. Weak references
+    // so that this side table, which the ComboBox owns, doesn't keep an old template alive.
+    winrt::weak_ref<winrt::UIElement> m_templateRoot;
+    winrt::weak_ref<winrt::Border> m_popupBorder;
+    winrt::weak_ref<winrt::TextBox> m_editableText;
+    winrt::weak_ref<winrt::Border> m_editableTextBorder;
 };
@@ -3,9 +3,12 @@
 
 using Common;
 using MUXControlsTestApp.Utilities;
+using System;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.Linq;
 using System.Threading;
+using Windows.Foundation;
 using Windows.Foundation.Metadata;
 using Windows.System;
 using Windows.UI.Xaml;
@@ -24,6 +27,8 @@ using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
 #endif
 
 using CommandBarFlyout = Microsoft.UI.Xaml.Controls.CommandBarFlyout;
+using CommandBarFlyoutCommandBarTemplateSettings = Microsoft.UI.Xaml.Controls.Primitives.CommandBarFlyoutCommandBarTemplateSettings;
+using CommandBarFlyoutTestApi = Microsoft.UI.Private.Controls.CommandBarFlyoutTestApi;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
 {
@@ -404,5 +409,125 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             IdleSynchronizer.Wait();
             Log.Comment("Flyout closed.");
         }
+
+        [TestMethod]
+        [TestProperty("Description", "Verifies the template settings computed from the desired sizes of the primary and secondary item roots.")]
+        public void VerifyTemplateSettingsValues()
+        {
+            if (PlatformConfiguration.IsOSVersionLessThan(OSVersion.Redstone2))
+            {
+                Log.Warning("Test is disabled pre-RS2 because CommandBarFlyout is not supported pre-RS2");
+                return;
+            }
+
+            const double c_tolerance = 0.0001;
+            const double c_height = 48.0;
+            double[] maxWidths = { double.PositiveInfinity, 300.0, 100.0 };
+            Size[] primarySizes = { new Size(0.0, 0.0), new Size(200.0, 48.0), new Size(400.0, 48.0) };
+            Size[] secondarySizes = { new Size(0.0, 0.0), new Size(150.0, 240.0), new Size(350.0, 96.0) };
+
+            RunOnUIThread.Execute(() =>
+            {
+                foreach (double maxWidth in maxWidths)
+                {
+                    foreach (Size primarySize in primarySizes)
+                    {
+                        foreach (Size secondarySize in secondarySizes)
+                        {
+                            foreach (bool isOpen in new bool[] { false, true })
+                            {
+                                foreach (bool hasPrimaryCommands in new bool[] { false, true })
+                                {
+                                    CommandBarFlyoutCommandBarTemplateSettings templateSettings = CommandBarFlyoutTestApi.CreateTemplateSettings();
+                                    CommandBarFlyoutTestApi.UpdateTemplateSettings(templateSettings, maxWidth, primarySize, secondarySize, isOpen, hasPrimaryCommands, c_height, true /*updateOpenCloseAnimationPositions*/);
+
+                                    float collapsedWidth = Math.Min((float)maxWidth, (float)primarySize.Width);
+                                    double expandedWidth = Math.Min((float)maxWidth, Math.Max(collapsedWidth, (float)secondarySize.Width));
+                                    if (collapsedWidth == 0)
+                                    {
+                                        collapsedWidth = (float)expandedWidth;
+                                    }
+                                    double widthExpansionDelta = collapsedWidth - expandedWidth;
+                                    string description = $"maxWidth={maxWidth}, primarySize={primarySize}, secondarySize={secondarySize}, isOpen={isOpen}, hasPrimaryCommands={hasPrimaryCommands}";
+
+                                    Action<double, double, string> verifyValue = (double expected, double actual, string name) =>
+                                    {
+                                        Verify.IsTrue(Math.Abs(expected - actual) < c_tolerance, $"{name}: expected {expected}, actual {actual}, {description}");
+                                    };
+
+                                    verifyValue(expandedWidth, templateSettings.ExpandedWidth, "ExpandedWidth");
+                                    verifyValue(isOpen ? expandedWidth : collapsedWidth, templateSettings.CurrentWidth, "CurrentWidth");
+                                    verifyValue(widthExpansionDelta, templateSettings.WidthExpansionDelta, "WidthExpansionDelta");
+                                    verifyValue(-widthExpansionDelta / 2.0, templateSettings.WidthExpansionAnimationStartPosition, "WidthExpansionAnimationStartPosition");
+                                    verifyValue(-widthExpansionDelta, templateSettings.WidthExpansionAnimationEndPosition, "WidthExpansionAnimationEndPosition");
+                                    verifyValue(widthExpansionDelta / 2.0, templateSettings.WidthExpansionMoreButtonAnimationStartPosition, "WidthExpansionMoreButtonAnimationStartPosition");
+                                    verifyValue(widthExpansionDelta, templateSettings.WidthExpansionMoreButtonAnimationEndPosition, "WidthExpansionMoreButtonAnimationEndPosition");
+                                    verifyValue(isOpen ? -expandedWidth / 2.0 : widthExpansionDelta - collapsedWidth / 2.0, templateSettings.OpenAnimationStartPosition, "OpenAnimationStartPosition");
+                                    verifyValue(isOpen ? 0.0 : widthExpansionDelta, templateSettings.OpenAnimationEndPosition, "OpenAnimationEndPosition");
+                                    verifyValue(-expandedWidth, templateSettings.CloseAnimationEndPosition, "CloseAnimationEndPosition");
+                                    verifyValue(-secondarySize.Height, templateSettings.ExpandUpOverflowVerticalPosition, "ExpandUpOverflowVerticalPosition");
+                                    verifyValue(hasPrimaryCommands ? c_height : 0.0, templateSettings.ExpandDownOverflowVerticalPosition, "ExpandDownOverflowVerticalPosition");
+                                    verifyValue(secondarySize.Height / 2.0, templateSettings.ExpandUpAnimationStartPosition, "ExpandUpAnimationStartPosition");
+                                    verifyValue(0.0, templateSettings.ExpandUpAnimationEndPosition, "ExpandUpAnimationEndPosition");
+                                    verifyValue(secondarySize.Height, templateSettings.ExpandUpAnimationHoldPosition, "ExpandUpAnimationHoldPosition");
+                                    verifyValue(-secondarySize.Height / 2.0, templateSettings.ExpandDownAnimationStartPosition, "ExpandDownAnimationStartPosition");
+                                    verifyValue(0.0, templateSettings.ExpandDownAnimationEndPosition, "ExpandDownAnimationEndPosition");
+                                    verifyValue(-secondarySize.Height, templateSettings.ExpandDownAnimationHoldPosition, "ExpandDownAnimationHoldPosition");
+                                    Verify.AreEqual(new Rect(0, 0, expandedWidth, primarySize.Height), templateSettings.ContentClipRect, $"ContentClipRect, {description}");
+                                    Verify.AreEqual(new Rect(0, 0, expandedWidth, secondarySize.Height + 2), templateSettings.OverflowContentClipRect, $"OverflowContentClipRect, {description}");
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+        }
+
+        [TestMethod]
+        [TestProperty("Description", "Verifies that only the template settings whose value changed are written.")]
+        public void VerifyTemplateSettingsOnlyWriteChangedValues()
+        {
+            if (PlatformConfiguration.IsOSVersionLessThan(OSVersion.Redstone2))
+            {
+                Log.Warning("Test is disabled pre-RS2 because CommandBarFlyout is not supported pre-RS2");
+                return;
+            }
+
+            const int c_updateCount = 10000;
+            Size primarySize = new Size(200.0, 48.0);
+            Size secondarySize = new Size(300.0, 240.0);
+
+            RunOnUIThread.Execute(() =>
+            {
+                CommandBarFlyoutCommandBarTemplateSettings templateSettings = CommandBarFlyoutTestApi.CreateTemplateSettings();
+
+                int writeCount = CommandBarFlyoutTestApi.UpdateTemplateSettings(templateSettings, double.PositiveInfinity, primarySize, secondarySize, false /*isOpen*/, true /*hasPrimaryCommands*/, 48.0, true /*updateOpenCloseAnimationPositions*/);
+                Log.Comment($"First update wrote {writeCount} template settings.");
+                Verify.IsGreaterThan(writeCount, 0);
+
+                writeCount = CommandBarFlyoutTestApi.UpdateTemplateSettings(templateSettings, double.PositiveInfinity, primarySize, secondarySize, false /*isOpen*/, true /*hasPrimaryCommands*/, 48.0, true /*updateOpenCloseAnimationPositions*/);
+                Verify.AreEqual(0, writeCount, "Updating with the same sizes should not write any template setting.");
+
+                // Opening only changes the current width and the open animation positions.
+                writeCount = CommandBarFlyoutTestApi.UpdateTemplateSettings(templateSettings, double.PositiveInfinity, primarySize, secondarySize, true /*isOpen*/, true /*hasPrimaryCommands*/, 48.0, true /*updateOpenCloseAnimationPositions*/);
+                Verify.AreEqual(3, writeCount);
+                Verify.AreEqual(300.0, templateSettings.CurrentWidth);
+                Verify.AreEqual(-150.0, templateSettings.OpenAnimationStartPosition);
+
+                // The open and close animation positions are left alone while the close animation plays.
+                writeCount = CommandBarFlyoutTestApi.UpdateTemplateSettings(templateSettings, double.PositiveInfinity, primarySize, secondarySize, false /*isOpen*/, true /*hasPrimaryCommands*/, 48.0, false /*updateOpenCloseAnimationPositions*/);
+                Verify.AreEqual(1, writeCount);
+                Verify.AreEqual(200.0, templateSettings.CurrentWidth);
+                Verify.AreEqual(-150.0, templateSettings.OpenAnimationStartPosition);
+
+                var stopwatch = Stopwatch.StartNew();
+                for (int update = 0; update < c_updateCount; update++)
+                {
+                    CommandBarFlyoutTestApi.UpdateTemplateSettings(templateSettings, double.PositiveInfinity, primarySize, secondarySize, false /*isOpen*/, true /*hasPrimaryCommands*/, 48.0, false /*updateOpenCloseAnimationPositions*/);
+                }
+                stopwatch.Stop();
+                Log.Comment($"{c_updateCount} unchanged template settings updates took {stopwatch.ElapsedMilliseconds}ms.");
+            });
+        }
     }
 }
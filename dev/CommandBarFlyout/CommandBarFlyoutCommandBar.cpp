@@ -5,6 +5,7 @@
 #include "common.h"
 #include "CommandBarFlyoutCommandBar.h"
 #include "CommandBarFlyoutCommandBarTemplateSettings.h"
+#include "CommandBarFlyoutCommandBarTemplateSettingsValues.h"
 #include "TypeLogging.h"
 
 CommandBarFlyoutCommandBar::CommandBarFlyoutCommandBar()
@@ -76,6 +77,7 @@ CommandBarFlyoutCommandBar::CommandBarFlyoutCommandBar()
             COMMANDBARFLYOUT_TRACE_VERBOSE(*this, TRACE_MSG_METH, METH_NAME, this);
 
             m_secondaryItemsRootSized = false;
+            m_itemsRootsMeasured = false;
 
             if (!SharedHelpers::IsRS3OrHigher() && PrimaryCommands().Size() > 0)
             {
@@ -104,6 +106,7 @@ CommandBarFlyoutCommandBar::CommandBarFlyoutCommandBar()
         {
             COMMANDBARFLYOUT_TRACE_VERBOSE(*this, TRACE_MSG_METH, METH_NAME, this);
 
+            m_itemsRootsMeasured = false;
             UpdateFlowsFromAndFlowsTo();
             UpdateUI();
         }
@@ -115,6 +118,7 @@ CommandBarFlyoutCommandBar::CommandBarFlyoutCommandBar()
             COMMANDBARFLYOUT_TRACE_VERBOSE(*this, TRACE_MSG_METH, METH_NAME, this);
 
             m_secondaryItemsRootSized = false;
+            m_itemsRootsMeasured = false;
             UpdateFlowsFromAndFlowsTo();
             UpdateUI();
         }
@@ -135,6 +139,7 @@ void CommandBarFlyoutCommandBar::OnApplyTemplate()
     m_moreButton.set(GetTemplateChildT<winrt::ButtonBase>(L"MoreButton", thisAsControlProtected));
     m_openingStoryboard.set(GetTemplateChildT<winrt::Storyboard>(L"OpeningStoryboard", thisAsControlProtected));
     m_closingStoryboard.set(GetTemplateChildT<winrt::Storyboard>(L"ClosingStoryboard", thisAsControlProtected));
+    m_itemsRootsMeasured = false;
 
     if (auto moreButton = m_moreButton.get())
     {
@@ -161,6 +166,17 @@ void CommandBarFlyoutCommandBar::AttachEventHandlers()
 {
     COMMANDBARFLYOUT_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
 
+    if (auto primaryItemsRoot = m_primaryItemsRoot.get())
+    {
+        m_primaryItemsRootSizeChangedRevoker = primaryItemsRoot.SizeChanged(winrt::auto_revoke,
+        {
+            [this](auto const&, auto const&)
+            {
+                m_itemsRootsMeasured = false;
+            }
+        });
+    }
+
     if (auto secondaryItemsRoot = m_secondaryItemsRoot.get())
     {
         m_secondaryItemsRootSizeChangedRevoker = secondaryItemsRoot.SizeChanged(winrt::auto_revoke,
@@ -168,6 +184,7 @@ void CommandBarFlyoutCommandBar::AttachEventHandlers()
             [this](auto const&, auto const&)
             {
                 m_secondaryItemsRootSized = true;
+                m_itemsRootsMeasured = false;
                 UpdateUI();
             }
         });
@@ -336,6 +353,7 @@ void CommandBarFlyoutCommandBar::DetachEventHandlers()
 
     m_keyDownRevoker.revoke();
     m_secondaryItemsRootPreviewKeyDownRevoker.revoke();
+    m_primaryItemsRootSizeChangedRevoker.revoke();
     m_secondaryItemsRootSizeChangedRevoker.revoke();
     m_firstItemLoadedRevoker.revoke();
     m_openingStoryboardCompletedRevoker.revoke();
@@ -517,8 +535,8 @@ void CommandBarFlyoutCommandBar::UpdateVisualState(
 
             if (availableHeight >= 0)
             {
-                m_secondaryItemsRoot.get().Measure({ std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity() });
-                auto overflowPopupSize = m_secondaryItemsRoot.get().DesiredSize();
+                EnsureItemsRootsMeasured();
+                auto overflowPopupSize = m_secondaryItemsRootDesiredSize;
 
                 shouldExpandUp =
                     controlBounds.Y + controlBounds.Height + overflowPopupSize.Height > availableHeight &&
@@ -571,69 +589,17 @@ void CommandBarFlyoutCommandBar::UpdateTemplateSettings()
 {
     if (m_primaryItemsRoot && m_secondaryItemsRoot)
     {
-        auto flyoutTemplateSettings = winrt::get_self<CommandBarFlyoutCommandBarTemplateSettings>(FlyoutTemplateSettings());
-        float maxWidth = static_cast<float>(MaxWidth());
+        EnsureItemsRootsMeasured();
 
-        winrt::Size infiniteSize = { std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity() };
-        m_primaryItemsRoot.get().Measure(infiniteSize);
-        winrt::Size primaryItemsRootDesiredSize = m_primaryItemsRoot.get().DesiredSize();
-        float collapsedWidth = std::min(maxWidth, primaryItemsRootDesiredSize.Width);
+        const auto values = CommandBarFlyoutCommandBarTemplateSettingsValues::Compute(
+            static_cast<float>(MaxWidth()),
+            m_primaryItemsRootDesiredSize,
+            m_secondaryItemsRootDesiredSize,
+            IsOpen(),
+            PrimaryCommands().Size() > 0 /*hasPrimaryCommands*/,
+            Height());
 
-        if (m_secondaryItemsRoot)
-        {
-            m_secondaryItemsRoot.get().Measure(infiniteSize);
-            auto overflowPopupSize = m_secondaryItemsRoot.get().DesiredSize();
-
-            flyoutTemplateSettings->ExpandedWidth(std::min(maxWidth, std::max(collapsedWidth, overflowPopupSize.Width)));
-            flyoutTemplateSettings->ExpandUpOverflowVerticalPosition(-overflowPopupSize.Height);
-            flyoutTemplateSettings->ExpandUpAnimationStartPosition(overflowPopupSize.Height / 2);
-            flyoutTemplateSettings->ExpandUpAnimationEndPosition(0);
-            flyoutTemplateSettings->ExpandUpAnimationHoldPosition(overflowPopupSize.Height);
-            flyoutTemplateSettings->ExpandDownAnimationStartPosition(-overflowPopupSize.Height / 2);
-            flyoutTemplateSettings->ExpandDownAnimationEndPosition(0);
-            flyoutTemplateSettings->ExpandDownAnimationHoldPosition(-overflowPopupSize.Height);
-            // This clip needs to cover the border at the bottom of the overflow otherwise it'll 
-            // clip the border. The measure size seems slightly off from what we eventually require
-            // so we're going to compensate just a bit to make sure there's room for any borders.
-            flyoutTemplateSettings->OverflowContentClipRect({ 0, 0, static_cast<float>(flyoutTemplateSettings->ExpandedWidth()), overflowPopupSize.Height + 2 });
-        }
-        else
-        {
-            flyoutTemplateSettings->ExpandedWidth(collapsedWidth);
-            flyoutTemplateSettings->ExpandUpOverflowVerticalPosition(0);
-            flyoutTemplateSettings->ExpandUpAnimationStartPosition(0);
-            flyoutTemplateSettings->ExpandUpAnimationEndPosition(0);
-            flyoutTemplateSettings->ExpandUpAnimationHoldPosition(0);
-            flyoutTemplateSettings->ExpandDownAnimationStartPosition(0);
-            flyoutTemplateSettings->ExpandDownAnimationEndPosition(0);
-            flyoutTemplateSettings->ExpandDownAnimationHoldPosition(0);
-            flyoutTemplateSettings->OverflowContentClipRect({ 0, 0, 0, 0 });
-        }
-
-        double expandedWidth = flyoutTemplateSettings->ExpandedWidth();
-
-        // If collapsedWidth is 0, then we'll never be showing in collapsed mode,
-        // so we'll set it equal to expandedWidth to ensure that our open/close animations are correct.
-        if (collapsedWidth == 0)
-        {
-            collapsedWidth = static_cast<float>(expandedWidth);
-        }
-
-        flyoutTemplateSettings->WidthExpansionDelta(collapsedWidth - expandedWidth);
-        flyoutTemplateSettings->WidthExpansionAnimationStartPosition(-flyoutTemplateSettings->WidthExpansionDelta() / 2.0);
-        flyoutTemplateSettings->WidthExpansionAnimationEndPosition(-flyoutTemplateSettings->WidthExpansionDelta());
-        flyoutTemplateSettings->ContentClipRect({ 0, 0, static_cast<float>(expandedWidth), primaryItemsRootDesiredSize.Height });
-
-        if (IsOpen())
-        {
-            flyoutTemplateSettings->CurrentWidth(expandedWidth);
-        }
-        else
-        {
-            flyoutTemplateSettings->CurrentWidth(collapsedWidth);
-        }
-
-        // If we're currently playing the close animation, don't update these properties -
+        // If we're currently playing the close animation, don't update the open and close animation positions -
         // the animation is expecting them not to change out from under it.
         // After the close animation has completed, the flyout will close and no further
         // visual updates will occur, so there's no need to update these values in that case.
@@ -644,33 +610,32 @@ void CommandBarFlyoutCommandBar::UpdateTemplateSettings()
             isPlayingCloseAnimation = closingStoryboard.GetCurrentState() == winrt::ClockState::Active;
         }
 
-        if (!isPlayingCloseAnimation)
-        {
-            if (IsOpen())
-            {
-                flyoutTemplateSettings->OpenAnimationStartPosition(-expandedWidth / 2);
-                flyoutTemplateSettings->OpenAnimationEndPosition(0);
-            }
-            else
-            {
-                flyoutTemplateSettings->OpenAnimationStartPosition(flyoutTemplateSettings->WidthExpansionDelta() - collapsedWidth / 2);
-                flyoutTemplateSettings->OpenAnimationEndPosition(flyoutTemplateSettings->WidthExpansionDelta());
-            }
+        winrt::get_self<CommandBarFlyoutCommandBarTemplateSettings>(FlyoutTemplateSettings())->Update(values, !isPlayingCloseAnimation /*updateOpenCloseAnimationPositions*/);
+    }
+}
 
-            flyoutTemplateSettings->CloseAnimationEndPosition(-expandedWidth);
-        }
+void CommandBarFlyoutCommandBar::EnsureItemsRootsMeasured()
+{
+    const double maxWidth = MaxWidth();
 
-        flyoutTemplateSettings->WidthExpansionMoreButtonAnimationStartPosition(flyoutTemplateSettings->WidthExpansionDelta() / 2);
-        flyoutTemplateSettings->WidthExpansionMoreButtonAnimationEndPosition(flyoutTemplateSettings->WidthExpansionDelta());
+    if (!m_itemsRootsMeasured || m_itemsRootsMeasuredMaxWidth != maxWidth)
+    {
+        winrt::Size infiniteSize = { std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity() };
 
-        if (PrimaryCommands().Size() > 0)
+        if (auto primaryItemsRoot = m_primaryItemsRoot.get())
         {
-            flyoutTemplateSettings->ExpandDownOverflowVerticalPosition(Height());
+            primaryItemsRoot.Measure(infiniteSize);
+            m_primaryItemsRootDesiredSize = primaryItemsRoot.DesiredSize();
         }
-        else
+
+        if (auto secondaryItemsRoot = m_secondaryItemsRoot.get())
         {
-            flyoutTemplateSettings->ExpandDownOverflowVerticalPosition(0);
+            secondaryItemsRoot.Measure(infiniteSize);
+            m_secondaryItemsRootDesiredSize = secondaryItemsRoot.DesiredSize();
         }
+
+        m_itemsRootsMeasuredMaxWidth = maxWidth;
+        m_itemsRootsMeasured = true;
     }
 }
 
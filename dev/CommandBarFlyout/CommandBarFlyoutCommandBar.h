@@ -37,6 +37,7 @@ private:
     void UpdateUI(bool useTransitions = true);
     void UpdateVisualState(bool useTransitions);
     void UpdateTemplateSettings();
+    void EnsureItemsRootsMeasured();
     void EnsureAutomationSetCountAndPosition();
     void EnsureFocusedPrimaryCommand();
 
@@ -69,6 +70,7 @@ private:
     weak_ref<winrt::CommandBarFlyout> m_owningFlyout{ nullptr };
     RoutedEventHandler_revoker m_keyDownRevoker{};
     winrt::UIElement::PreviewKeyDown_revoker m_secondaryItemsRootPreviewKeyDownRevoker{};
+    winrt::FrameworkElement::SizeChanged_revoker m_primaryItemsRootSizeChangedRevoker{};
     winrt::FrameworkElement::SizeChanged_revoker m_secondaryItemsRootSizeChangedRevoker{};
     winrt::FrameworkElement::Loaded_revoker m_firstItemLoadedRevoker{};
 
@@ -86,4 +88,11 @@ private:
     winrt::Storyboard::Completed_revoker m_closingStoryboardCompletedCallbackRevoker{};
 
     bool m_secondaryItemsRootSized{ false };
+
+    // Desired sizes of the item roots at an infinite size. They are only measured again after the commands,
+    // the MaxWidth or the size of an item root changed, or after the flyout closed.
+    winrt::Size m_primaryItemsRootDesiredSize{};
+    winrt::Size m_secondaryItemsRootDesiredSize{};
+    double m_itemsRootsMeasuredMaxWidth{};
+    bool m_itemsRootsMeasured{ false };
 };
@@ -4,3 +4,48 @@
 #include "pch.h"
 #include "common.h"
 #include "CommandBarFlyoutCommandBarTemplateSettings.h"
+
+int CommandBarFlyoutCommandBarTemplateSettings::Update(const CommandBarFlyoutCommandBarTemplateSettingsValues& values, bool updateOpenCloseAnimationPositions)
+{
+    int writeCount = 0;
+    const bool hasValues = m_hasValues;
+
+    auto update = [&writeCount, hasValues](auto& currentValue, const auto& newValue, auto&& setValue)
+    {
+        if (!hasValues || currentValue != newValue)
+        {
+            currentValue = newValue;
+            setValue(newValue);
+            writeCount++;
+        }
+    };
+
+    update(m_values.ExpandedWidth, values.ExpandedWidth, [this](double value) { ExpandedWidth(value); });
+    update(m_values.ExpandUpOverflowVerticalPosition, values.ExpandUpOverflowVerticalPosition, [this](double value) { ExpandUpOverflowVerticalPosition(value); });
+    update(m_values.ExpandUpAnimationStartPosition, values.ExpandUpAnimationStartPosition, [this](double value) { ExpandUpAnimationStartPosition(value); });
+    update(m_values.ExpandUpAnimationEndPosition, values.ExpandUpAnimationEndPosition, [this](double value) { ExpandUpAnimationEndPosition(value); });
+    update(m_values.ExpandUpAnimationHoldPosition, values.ExpandUpAnimationHoldPosition, [this](double value) { ExpandUpAnimationHoldPosition(value); });
+    update(m_values.ExpandDownAnimationStartPosition, values.ExpandDownAnimationStartPosition, [this](double value) { ExpandDownAnimationStartPosition(value); });
+    update(m_values.ExpandDownAnimationEndPosition, values.ExpandDownAnimationEndPosition, [this](double value) { ExpandDownAnimationEndPosition(value); });
+    update(m_values.ExpandDownAnimationHoldPosition, values.ExpandDownAnimationHoldPosition, [this](double value) { ExpandDownAnimationHoldPosition(value); });
+    update(m_values.OverflowContentClipRect, values.OverflowContentClipRect, [this](auto const& value) { OverflowContentClipRect(value); });
+    update(m_values.WidthExpansionDelta, values.WidthExpansionDelta, [this](double value) { WidthExpansionDelta(value); });
+    update(m_values.WidthExpansionAnimationStartPosition, values.WidthExpansionAnimationStartPosition, [this](double value) { WidthExpansionAnimationStartPosition(value); });
+    update(m_values.WidthExpansionAnimationEndPosition, values.WidthExpansionAnimationEndPosition, [this](double value) { WidthExpansionAnimationEndPosition(value); });
+    update(m_values.ContentClipRect, values.ContentClipRect, [this](auto const& value) { ContentClipRect(value); });
+    update(m_values.CurrentWidth, values.CurrentWidth, [this](double value) { CurrentWidth(value); });
+
+    if (updateOpenCloseAnimationPositions)
+    {
+        update(m_values.OpenAnimationStartPosition, values.OpenAnimationStartPosition, [this](double value) { OpenAnimationStartPosition(value); });
+        update(m_values.OpenAnimationEndPosition, values.OpenAnimationEndPosition, [this](double value) { OpenAnimationEndPosition(value); });
+        update(m_values.CloseAnimationEndPosition, values.CloseAnimationEndPosition, [this](double value) { CloseAnimationEndPosition(value); });
+    }
+
+    update(m_values.WidthExpansionMoreButtonAnimationStartPosition, values.WidthExpansionMoreButtonAnimationStartPosition, [this](double value) { WidthExpansionMoreButtonAnimationStartPosition(value); });
+    update(m_values.WidthExpansionMoreButtonAnimationEndPosition, values.WidthExpansionMoreButtonAnimationEndPosition, [this](double value) { WidthExpansionMoreButtonAnimationEndPosition(value); });
+    update(m_values.ExpandDownOverflowVerticalPosition, values.ExpandDownOverflowVerticalPosition, [this](double value) { ExpandDownOverflowVerticalPosition(value); });
+
+    m_hasValues = true;
+    return writeCount;
+}
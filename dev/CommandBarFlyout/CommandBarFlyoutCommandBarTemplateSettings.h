@@ -5,11 +5,22 @@
 
 #include "CommandBarFlyoutCommandBarTemplateSettings.g.h"
 #include "CommandBarFlyoutCommandBarTemplateSettings.properties.h"
+#include "CommandBarFlyoutCommandBarTemplateSettingsValues.h"
 
 class CommandBarFlyoutCommandBarTemplateSettings :
     public winrt::implementation::CommandBarFlyoutCommandBarTemplateSettingsT<CommandBarFlyoutCommandBarTemplateSettings>,
     public CommandBarFlyoutCommandBarTemplateSettingsProperties
 {
+public:
+    // Every property write boxes the value and notifies the bindings and storyboards of the template,
+    // so after the first update only the properties whose value differs from the last update are written.
+    // The open and close animation positions are left untouched when updateOpenCloseAnimationPositions
+    // is false. Returns the number of properties written.
+    int Update(const CommandBarFlyoutCommandBarTemplateSettingsValues& values, bool updateOpenCloseAnimationPositions);
+
+private:
+    CommandBarFlyoutCommandBarTemplateSettingsValues m_values{};
+    bool m_hasValues{ false };
 };
 
 // Not actually a factory since this class is not activatable,
@@ -0,0 +1,66 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "CommandBarFlyoutCommandBarTemplateSettingsValues.h"
+
+/* static */
+CommandBarFlyoutCommandBarTemplateSettingsValues CommandBarFlyoutCommandBarTemplateSettingsValues::Compute(
+    float maxWidth,
+    const winrt::Size& primaryItemsRootDesiredSize,
+    const winrt::Size& secondaryItemsRootDesiredSize,
+    bool isOpen,
+    bool hasPrimaryCommands,
+    double height)
+{
+    CommandBarFlyoutCommandBarTemplateSettingsValues values;
+    float collapsedWidth = std::min(maxWidth, primaryItemsRootDesiredSize.Width);
+    const auto& overflowPopupSize = secondaryItemsRootDesiredSize;
+
+    values.ExpandedWidth = std::min(maxWidth, std::max(collapsedWidth, overflowPopupSize.Width));
+    values.ExpandUpOverflowVerticalPosition = -overflowPopupSize.Height;
+    values.ExpandUpAnimationStartPosition = overflowPopupSize.Height / 2;
+    values.ExpandUpAnimationEndPosition = 0;
+    values.ExpandUpAnimationHoldPosition = overflowPopupSize.Height;
+    values.ExpandDownAnimationStartPosition = -overflowPopupSize.Height / 2;
+    values.ExpandDownAnimationEndPosition = 0;
+    values.ExpandDownAnimationHoldPosition = -overflowPopupSize.Height;
+    // This clip needs to cover the border at the bottom of the overflow otherwise it'll 
+    // clip the border. The measure size seems slightly off from what we eventually require
+    // so we're going to compensate just a bit to make sure there's room for any borders.
+    values.OverflowContentClipRect = { 0, 0, static_cast<float>(values.ExpandedWidth), overflowPopupSize.Height + 2 };
+
+    const double expandedWidth = values.ExpandedWidth;
+
+    // If collapsedWidth is 0, then we'll never be showing in collapsed mode,
+    // so we'll set it equal to expandedWidth to ensure that our open/close animations are correct.
+    if (collapsedWidth == 0)
+    {
+        collapsedWidth = static_cast<float>(expandedWidth);
+    }
+
+    values.WidthExpansionDelta = collapsedWidth - expandedWidth;
+    values.WidthExpansionAnimationStartPosition = -values.WidthExpansionDelta / 2.0;
+    values.WidthExpansionAnimationEndPosition = -values.WidthExpansionDelta;
+    values.ContentClipRect = { 0, 0, static_cast<float>(expandedWidth), primaryItemsRootDesiredSize.Height };
+    values.CurrentWidth = isOpen ? expandedWidth : collapsedWidth;
+
+    if (isOpen)
+    {
+        values.OpenAnimationStartPosition = -expandedWidth / 2;
+        values.OpenAnimationEndPosition = 0;
+    }
+    else
+    {
+        values.OpenAnimationStartPosition = values.WidthExpansionDelta - collapsedWidth / 2;
+        values.OpenAnimationEndPosition = values.WidthExpansionDelta;
+    }
+
+    values.CloseAnimationEndPosition = -expandedWidth;
+    values.WidthExpansionMoreButtonAnimationStartPosition = values.WidthExpansionDelta / 2;
+    values.WidthExpansionMoreButtonAnimationEndPosition = values.WidthExpansionDelta;
+    values.ExpandDownOverflowVerticalPosition = hasPrimaryCommands ? height : 0;
+
+    return values;
+}
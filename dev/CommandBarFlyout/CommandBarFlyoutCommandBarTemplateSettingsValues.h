@@ -0,0 +1,39 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Values of the CommandBarFlyoutCommandBarTemplateSettings properties. They only depend on the desired sizes
+// of the primary and secondary item roots and on a few properties of the command bar, so they are computed
+// without touching any XAML object.
+struct CommandBarFlyoutCommandBarTemplateSettingsValues
+{
+    static CommandBarFlyoutCommandBarTemplateSettingsValues Compute(
+        float maxWidth,
+        const winrt::Size& primaryItemsRootDesiredSize,
+        const winrt::Size& secondaryItemsRootDesiredSize,
+        bool isOpen,
+        bool hasPrimaryCommands,
+        double height);
+
+    double OpenAnimationStartPosition{};
+    double OpenAnimationEndPosition{};
+    double CloseAnimationEndPosition{};
+    double CurrentWidth{};
+    double ExpandedWidth{};
+    double WidthExpansionDelta{};
+    double WidthExpansionAnimationStartPosition{};
+    double WidthExpansionAnimationEndPosition{};
+    double WidthExpansionMoreButtonAnimationStartPosition{};
+    double WidthExpansionMoreButtonAnimationEndPosition{};
+    double ExpandUpOverflowVerticalPosition{};
+    double ExpandDownOverflowVerticalPosition{};
+    double ExpandUpAnimationStartPosition{};
+    double ExpandUpAnimationEndPosition{};
+    double ExpandUpAnimationHoldPosition{};
+    double ExpandDownAnimationStartPosition{};
+    double ExpandDownAnimationEndPosition{};
+    double ExpandDownAnimationHoldPosition{};
+    winrt::Rect ContentClipRect{};
+    winrt::Rect OverflowContentClipRect{};
+};
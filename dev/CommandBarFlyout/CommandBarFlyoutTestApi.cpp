@@ -0,0 +1,37 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "CommandBarFlyoutTestApi.h"
+#include "CommandBarFlyoutCommandBarTemplateSettings.h"
+
+winrt::CommandBarFlyoutCommandBarTemplateSettings CommandBarFlyoutTestApi::CreateTemplateSettings()
+{
+    return winrt::make<CommandBarFlyoutCommandBarTemplateSettings>();
+}
+
+int CommandBarFlyoutTestApi::UpdateTemplateSettings(
+    const winrt::CommandBarFlyoutCommandBarTemplateSettings& templateSettings,
+    double maxWidth,
+    const winrt::Size& primaryItemsRootDesiredSize,
+    const winrt::Size& secondaryItemsRootDesiredSize,
+    bool isOpen,
+    bool hasPrimaryCommands,
+    double height,
+    bool updateOpenCloseAnimationPositions)
+{
+    if (templateSettings)
+    {
+        const auto values = CommandBarFlyoutCommandBarTemplateSettingsValues::Compute(
+            static_cast<float>(maxWidth),
+            primaryItemsRootDesiredSize,
+            secondaryItemsRootDesiredSize,
+            isOpen,
+            hasPrimaryCommands,
+            height);
+
+        return winrt::get_self<CommandBarFlyoutCommandBarTemplateSettings>(templateSettings)->Update(values, updateOpenCloseAnimationPositions);
+    }
+    return 0;
+}
@@ -0,0 +1,24 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CommandBarFlyoutTestApi.g.h"
+
+class CommandBarFlyoutTestApi :
+    public winrt::implementation::CommandBarFlyoutTestApiT<CommandBarFlyoutTestApi>
+{
+public:
+    static winrt::CommandBarFlyoutCommandBarTemplateSettings CreateTemplateSettings();
+    static int UpdateTemplateSettings(
+        const winrt::CommandBarFlyoutCommandBarTemplateSettings& templateSettings,
+        double maxWidth,
+        const winrt::Size& primaryItemsRootDesiredSize,
+        const winrt::Size& secondaryItemsRootDesiredSize,
+        bool isOpen,
+        bool hasPrimaryCommands,
+        double height,
+        bool updateOpenCloseAnimationPositions);
+};
+
+CppWinRTActivatableClassWithBasicFactory(CommandBarFlyoutTestApi);
\ No newline at end of file
@@ -18,6 +18,11 @@ using OSVersion = Common.OSVersion;
 using System.Collections.Generic;
 using XamlControlsResources = Microsoft.UI.Xaml.Controls.XamlControlsResources;
 using Windows.UI.Xaml.Markup;
+using System;
+using System.Diagnostics;
+using TreeViewItem = Microsoft.UI.Xaml.Controls.TreeViewItem;
+using NavigationViewItem = Microsoft.UI.Xaml.Controls.NavigationViewItem;
+using RatingControl = Microsoft.UI.Xaml.Controls.RatingControl;
 
 #if USING_TAEF
 using WEX.TestExecution;
@@ -55,6 +60,50 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             MUXControlsTestApp.Utilities.IdleSynchronizer.Wait();
         }
 
+        [TestMethod]
+        public void VerifyControlConstructionCost()
+        {
+            VerifyControlConstructionCost("TreeViewItem", () => new TreeViewItem());
+            VerifyControlConstructionCost("NavigationViewItem", () => new NavigationViewItem());
+            VerifyControlConstructionCost("RatingControl", () => new RatingControl());
+        }
+
+        private void VerifyControlConstructionCost(string name, Func<Control> createControl)
+        {
+            const int instanceCount = 5000;
+
+            RunOnUIThread.Execute(() =>
+            {
+                // The first instance pays for the per-type setup (boxed style key, default style resource Uri).
+                createControl();
+
+                var stopwatch = Stopwatch.StartNew();
+                var controls = new List<Control>(instanceCount);
+                for (int i = 0; i < instanceCount; i++)
+                {
+                    controls.Add(createControl());
+                }
+                stopwatch.Stop();
+
+                Log.Comment("Constructed {0} {1} instances in {2} ms ({3:F2} us per instance)",
+                    instanceCount, name, stopwatch.ElapsedMilliseconds, stopwatch.Elapsed.TotalMilliseconds * 1000 / instanceCount);
+
+                // Instances share the cached style key, make sure the default style still gets applied to each of them.
+                var root = new StackPanel();
+                root.Children.Add(controls[0]);
+                root.Children.Add(controls[instanceCount - 1]);
+                MUXControlsTestApp.App.TestContentRoot = root;
+                root.UpdateLayout();
+
+                Verify.IsGreaterThan(VisualTreeHelper.GetChildrenCount(controls[0]), 0, name + " first instance has its default template");
+                Verify.IsGreaterThan(VisualTreeHelper.GetChildrenCount(controls[instanceCount - 1]), 0, name + " last instance has its default template");
+
+                MUXControlsTestApp.App.TestContentRoot = null;
+            });
+
+            IdleSynchronizer.Wait();
+        }
+
         [TestMethod]
         public void CornerRadiusFilterConverterTest()
         {
@@ -16,6 +16,8 @@ GlobalDependencyProperty FlowLayoutProperties::s_OrientationProperty{ nullptr };
 FlowLayoutProperties::FlowLayoutProperties()
 {
     EnsureProperties();
+    m_cachedMinColumnSpacing = 0.0;
+    m_cachedMinRowSpacing = 0.0;
 }
 
 void FlowLayoutProperties::EnsureProperties()
@@ -87,6 +89,7 @@ void FlowLayoutProperties::OnMinColumnSpacingPropertyChanged(
     winrt::DependencyPropertyChangedEventArgs const& args)
 {
     auto owner = sender.as<winrt::FlowLayout>();
+    static_cast<FlowLayoutProperties*>(winrt::get_self<FlowLayout>(owner))->m_cachedMinColumnSpacing = ValueHelper<double>::CastOrUnbox(args.NewValue());
     winrt::get_self<FlowLayout>(owner)->OnPropertyChanged(args);
 }
 
@@ -95,6 +98,7 @@ void FlowLayoutProperties::OnMinRowSpacingPropertyChanged(
     winrt::DependencyPropertyChangedEventArgs const& args)
 {
     auto owner = sender.as<winrt::FlowLayout>();
+    static_cast<FlowLayoutProperties*>(winrt::get_self<FlowLayout>(owner))->m_cachedMinRowSpacing = ValueHelper<double>::CastOrUnbox(args.NewValue());
     winrt::get_self<FlowLayout>(owner)->OnPropertyChanged(args);
 }
 
@@ -123,7 +127,7 @@ void FlowLayoutProperties::MinColumnSpacing(double value)
 
 double FlowLayoutProperties::MinColumnSpacing()
 {
-    return ValueHelper<double>::CastOrUnbox(static_cast<FlowLayout*>(this)->GetValue(s_MinColumnSpacingProperty));
+    return m_cachedMinColumnSpacing;
 }
 
 void FlowLayoutProperties::MinRowSpacing(double value)
@@ -133,7 +137,7 @@ void FlowLayoutProperties::MinRowSpacing(double value)
 
 double FlowLayoutProperties::MinRowSpacing()
 {
-    return ValueHelper<double>::CastOrUnbox(static_cast<FlowLayout*>(this)->GetValue(s_MinRowSpacingProperty));
+    return m_cachedMinRowSpacing;
 }
 
 void FlowLayoutProperties::Orientation(winrt::Orientation const& value)
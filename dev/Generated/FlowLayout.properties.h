@@ -49,4 +49,8 @@ public:
     static void OnOrientationPropertyChanged(
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
+
+private:
+    double m_cachedMinColumnSpacing{};
+    double m_cachedMinRowSpacing{};
 };
@@ -14,6 +14,7 @@ GlobalDependencyProperty ItemsRepeaterProperties::s_HorizontalCacheLengthPropert
 GlobalDependencyProperty ItemsRepeaterProperties::s_ItemsSourceProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeaterProperties::s_ItemTemplateProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeaterProperties::s_LayoutProperty{ nullptr };
+GlobalDependencyProperty ItemsRepeaterProperties::s_PrewarmElementCountProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeaterProperties::s_VerticalCacheLengthProperty{ nullptr };
 
 ItemsRepeaterProperties::ItemsRepeaterProperties()
@@ -92,6 +93,17 @@ void ItemsRepeaterProperties::EnsureProperties()
                 ValueHelper<winrt::Layout>::BoxValueIfNecessary(winrt::StackLayout()),
                 winrt::PropertyChangedCallback(&OnLayoutPropertyChanged));
     }
+    if (!s_PrewarmElementCountProperty)
+    {
+        s_PrewarmElementCountProperty =
+            InitializeDependencyProperty(
+                L"PrewarmElementCount",
+                winrt::name_of<int>(),
+                winrt::name_of<winrt::ItemsRepeater>(),
+                false /* isAttached */,
+                ValueHelper<int>::BoxValueIfNecessary(0),
+                winrt::PropertyChangedCallback(&OnPrewarmElementCountPropertyChanged));
+    }
     if (!s_VerticalCacheLengthProperty)
     {
         s_VerticalCacheLengthProperty =
@@ -113,6 +125,7 @@ void ItemsRepeaterProperties::ClearProperties()
     s_ItemsSourceProperty = nullptr;
     s_ItemTemplateProperty = nullptr;
     s_LayoutProperty = nullptr;
+    s_PrewarmElementCountProperty = nullptr;
     s_VerticalCacheLengthProperty = nullptr;
 }
 
@@ -156,6 +169,14 @@ void ItemsRepeaterProperties::OnLayoutPropertyChanged(
     winrt::get_self<ItemsRepeater>(owner)->OnPropertyChanged(args);
 }
 
+void ItemsRepeaterProperties::OnPrewarmElementCountPropertyChanged(
+    winrt::DependencyObject const& sender,
+    winrt::DependencyPropertyChangedEventArgs const& args)
+{
+    auto owner = sender.as<winrt::ItemsRepeater>();
+    winrt::get_self<ItemsRepeater>(owner)->OnPropertyChanged(args);
+}
+
 void ItemsRepeaterProperties::OnVerticalCacheLengthPropertyChanged(
     winrt::DependencyObject const& sender,
     winrt::DependencyPropertyChangedEventArgs const& args)
@@ -224,6 +245,16 @@ winrt::Layout ItemsRepeaterProperties::Layout()
     return ValueHelper<winrt::Layout>::CastOrUnbox(static_cast<ItemsRepeater*>(this)->GetValue(s_LayoutProperty));
 }
 
+void ItemsRepeaterProperties::PrewarmElementCount(int value)
+{
+    static_cast<ItemsRepeater*>(this)->SetValue(s_PrewarmElementCountProperty, ValueHelper<int>::BoxValueIfNecessary(value));
+}
+
+int ItemsRepeaterProperties::PrewarmElementCount()
+{
+    return ValueHelper<int>::CastOrUnbox(static_cast<ItemsRepeater*>(this)->GetValue(s_PrewarmElementCountProperty));
+}
+
 void ItemsRepeaterProperties::VerticalCacheLength(double value)
 {
     static_cast<ItemsRepeater*>(this)->SetValue(s_VerticalCacheLengthProperty, ValueHelper<double>::BoxValueIfNecessary(value));
@@ -27,6 +27,9 @@ public:
     void Layout(winrt::Layout const& value);
     winrt::Layout Layout();
 
+    void PrewarmElementCount(int value);
+    int PrewarmElementCount();
+
     void VerticalCacheLength(double value);
     double VerticalCacheLength();
 
@@ -36,6 +39,7 @@ public:
     static winrt::DependencyProperty ItemsSourceProperty() { return s_ItemsSourceProperty; }
     static winrt::DependencyProperty ItemTemplateProperty() { return s_ItemTemplateProperty; }
     static winrt::DependencyProperty LayoutProperty() { return s_LayoutProperty; }
+    static winrt::DependencyProperty PrewarmElementCountProperty() { return s_PrewarmElementCountProperty; }
     static winrt::DependencyProperty VerticalCacheLengthProperty() { return s_VerticalCacheLengthProperty; }
 
     static GlobalDependencyProperty s_AnimatorProperty;
@@ -44,6 +48,7 @@ public:
     static GlobalDependencyProperty s_ItemsSourceProperty;
     static GlobalDependencyProperty s_ItemTemplateProperty;
     static GlobalDependencyProperty s_LayoutProperty;
+    static GlobalDependencyProperty s_PrewarmElementCountProperty;
     static GlobalDependencyProperty s_VerticalCacheLengthProperty;
 
     winrt::event_token ElementClearing(winrt::TypedEventHandler<winrt::ItemsRepeater, winrt::ItemsRepeaterElementClearingEventArgs> const& value);
@@ -80,6 +85,10 @@ public:
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
 
+    static void OnPrewarmElementCountPropertyChanged(
+        winrt::DependencyObject const& sender,
+        winrt::DependencyPropertyChangedEventArgs const& args);
+
     static void OnVerticalCacheLengthPropertyChanged(
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
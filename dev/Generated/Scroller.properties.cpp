@@ -37,6 +37,11 @@ ScrollerProperties::ScrollerProperties()
     , m_zoomCompletedEventSource{static_cast<Scroller*>(this)}
 {
     EnsureProperties();
+    m_cachedHorizontalAnchorRatio = Scroller::s_defaultAnchorRatio;
+    m_cachedHorizontalScrollMode = Scroller::s_defaultHorizontalScrollMode;
+    m_cachedVerticalAnchorRatio = Scroller::s_defaultAnchorRatio;
+    m_cachedVerticalScrollMode = Scroller::s_defaultVerticalScrollMode;
+    m_cachedZoomMode = Scroller::s_defaultZoomMode;
 }
 
 void ScrollerProperties::EnsureProperties()
@@ -278,6 +283,7 @@ void ScrollerProperties::OnHorizontalAnchorRatioPropertyChanged(
         return;
     }
 
+    static_cast<ScrollerProperties*>(winrt::get_self<Scroller>(owner))->m_cachedHorizontalAnchorRatio = ValueHelper<double>::CastOrUnbox(args.NewValue());
     winrt::get_self<Scroller>(owner)->OnPropertyChanged(args);
 }
 
@@ -294,6 +300,7 @@ void ScrollerProperties::OnHorizontalScrollModePropertyChanged(
     winrt::DependencyPropertyChangedEventArgs const& args)
 {
     auto owner = sender.as<winrt::Scroller>();
+    static_cast<ScrollerProperties*>(winrt::get_self<Scroller>(owner))->m_cachedHorizontalScrollMode = ValueHelper<winrt::ScrollMode>::CastOrUnbox(args.NewValue());
     winrt::get_self<Scroller>(owner)->OnPropertyChanged(args);
 }
 
@@ -364,6 +371,7 @@ void ScrollerProperties::OnVerticalAnchorRatioPropertyChanged(
         return;
     }
 
+    static_cast<ScrollerProperties*>(winrt::get_self<Scroller>(owner))->m_cachedVerticalAnchorRatio = ValueHelper<double>::CastOrUnbox(args.NewValue());
     winrt::get_self<Scroller>(owner)->OnPropertyChanged(args);
 }
 
@@ -380,6 +388,7 @@ void ScrollerProperties::OnVerticalScrollModePropertyChanged(
     winrt::DependencyPropertyChangedEventArgs const& args)
 {
     auto owner = sender.as<winrt::Scroller>();
+    static_cast<ScrollerProperties*>(winrt::get_self<Scroller>(owner))->m_cachedVerticalScrollMode = ValueHelper<winrt::ScrollMode>::CastOrUnbox(args.NewValue());
     winrt::get_self<Scroller>(owner)->OnPropertyChanged(args);
 }
 
@@ -404,6 +413,7 @@ void ScrollerProperties::OnZoomModePropertyChanged(
     winrt::DependencyPropertyChangedEventArgs const& args)
 {
     auto owner = sender.as<winrt::Scroller>();
+    static_cast<ScrollerProperties*>(winrt::get_self<Scroller>(owner))->m_cachedZoomMode = ValueHelper<winrt::ZoomMode>::CastOrUnbox(args.NewValue());
     winrt::get_self<Scroller>(owner)->OnPropertyChanged(args);
 }
 
@@ -446,7 +456,7 @@ void ScrollerProperties::HorizontalAnchorRatio(double value)
 
 double ScrollerProperties::HorizontalAnchorRatio()
 {
-    return ValueHelper<double>::CastOrUnbox(static_cast<Scroller*>(this)->GetValue(s_HorizontalAnchorRatioProperty));
+    return m_cachedHorizontalAnchorRatio;
 }
 
 void ScrollerProperties::HorizontalScrollChainingMode(winrt::ChainingMode const& value)
@@ -466,7 +476,7 @@ void ScrollerProperties::HorizontalScrollMode(winrt::ScrollMode const& value)
 
 winrt::ScrollMode ScrollerProperties::HorizontalScrollMode()
 {
-    return ValueHelper<winrt::ScrollMode>::CastOrUnbox(static_cast<Scroller*>(this)->GetValue(s_HorizontalScrollModeProperty));
+    return m_cachedHorizontalScrollMode;
 }
 
 void ScrollerProperties::HorizontalScrollRailingMode(winrt::RailingMode const& value)
@@ -522,7 +532,7 @@ void ScrollerProperties::VerticalAnchorRatio(double value)
 
 double ScrollerProperties::VerticalAnchorRatio()
 {
-    return ValueHelper<double>::CastOrUnbox(static_cast<Scroller*>(this)->GetValue(s_VerticalAnchorRatioProperty));
+    return m_cachedVerticalAnchorRatio;
 }
 
 void ScrollerProperties::VerticalScrollChainingMode(winrt::ChainingMode const& value)
@@ -542,7 +552,7 @@ void ScrollerProperties::VerticalScrollMode(winrt::ScrollMode const& value)
 
 winrt::ScrollMode ScrollerProperties::VerticalScrollMode()
 {
-    return ValueHelper<winrt::ScrollMode>::CastOrUnbox(static_cast<Scroller*>(this)->GetValue(s_VerticalScrollModeProperty));
+    return m_cachedVerticalScrollMode;
 }
 
 void ScrollerProperties::VerticalScrollRailingMode(winrt::RailingMode const& value)
@@ -572,7 +582,7 @@ void ScrollerProperties::ZoomMode(winrt::ZoomMode const& value)
 
 winrt::ZoomMode ScrollerProperties::ZoomMode()
 {
-    return ValueHelper<winrt::ZoomMode>::CastOrUnbox(static_cast<Scroller*>(this)->GetValue(s_ZoomModeProperty));
+    return m_cachedZoomMode;
 }
 
 winrt::event_token ScrollerProperties::AnchorRequested(winrt::TypedEventHandler<winrt::Scroller, winrt::ScrollerAnchorRequestedEventArgs> const& value)
@@ -186,4 +186,11 @@ public:
     static void OnZoomModePropertyChanged(
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
+
+private:
+    double m_cachedHorizontalAnchorRatio{};
+    winrt::ScrollMode m_cachedHorizontalScrollMode{};
+    double m_cachedVerticalAnchorRatio{};
+    winrt::ScrollMode m_cachedVerticalScrollMode{};
+    winrt::ZoomMode m_cachedZoomMode{};
 };
@@ -14,6 +14,7 @@ GlobalDependencyProperty StackLayoutProperties::s_SpacingProperty{ nullptr };
 StackLayoutProperties::StackLayoutProperties()
 {
     EnsureProperties();
+    m_cachedSpacing = 0.0;
 }
 
 void StackLayoutProperties::EnsureProperties()
@@ -61,6 +62,7 @@ void StackLayoutProperties::OnSpacingPropertyChanged(
     winrt::DependencyPropertyChangedEventArgs const& args)
 {
     auto owner = sender.as<winrt::StackLayout>();
+    static_cast<StackLayoutProperties*>(winrt::get_self<StackLayout>(owner))->m_cachedSpacing = ValueHelper<double>::CastOrUnbox(args.NewValue());
     winrt::get_self<StackLayout>(owner)->OnPropertyChanged(args);
 }
 
@@ -81,5 +83,5 @@ void StackLayoutProperties::Spacing(double value)
 
 double StackLayoutProperties::Spacing()
 {
-    return ValueHelper<double>::CastOrUnbox(static_cast<StackLayout*>(this)->GetValue(s_SpacingProperty));
+    return m_cachedSpacing;
 }
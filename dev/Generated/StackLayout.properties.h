@@ -31,4 +31,7 @@ public:
     static void OnSpacingPropertyChanged(
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
+
+private:
+    double m_cachedSpacing{};
 };
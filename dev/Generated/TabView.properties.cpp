@@ -11,6 +11,7 @@ CppWinRTActivatableClassWithDPFactory(TabView)
 GlobalDependencyProperty TabViewProperties::s_AddTabButtonCommandProperty{ nullptr };
 GlobalDependencyProperty TabViewProperties::s_AddTabButtonCommandParameterProperty{ nullptr };
 GlobalDependencyProperty TabViewProperties::s_AllowDropTabsProperty{ nullptr };
+GlobalDependencyProperty TabViewProperties::s_CachedTabContentCountProperty{ nullptr };
 GlobalDependencyProperty TabViewProperties::s_CanDragTabsProperty{ nullptr };
 GlobalDependencyProperty TabViewProperties::s_CanReorderTabsProperty{ nullptr };
 GlobalDependencyProperty TabViewProperties::s_IsAddTabButtonVisibleProperty{ nullptr };
@@ -28,6 +29,7 @@ GlobalDependencyProperty TabViewProperties::s_TabWidthModeProperty{ nullptr };
 
 TabViewProperties::TabViewProperties()
     : m_addTabButtonClickEventSource{static_cast<TabView*>(this)}
+    , m_cachedTabContentEvictedEventSource{static_cast<TabView*>(this)}
     , m_selectionChangedEventSource{static_cast<TabView*>(this)}
     , m_tabCloseRequestedEventSource{static_cast<TabView*>(this)}
     , m_tabDragCompletedEventSource{static_cast<TabView*>(this)}
@@ -74,6 +76,17 @@ void TabViewProperties::EnsureProperties()
                 ValueHelper<bool>::BoxValueIfNecessary(true),
                 nullptr);
     }
+    if (!s_CachedTabContentCountProperty)
+    {
+        s_CachedTabContentCountProperty =
+            InitializeDependencyProperty(
+                L"CachedTabContentCount",
+                winrt::name_of<int>(),
+                winrt::name_of<winrt::TabView>(),
+                false /* isAttached */,
+                ValueHelper<int>::BoxValueIfNecessary(0),
+                winrt::PropertyChangedCallback(&OnCachedTabContentCountPropertyChanged));
+    }
     if (!s_CanDragTabsProperty)
     {
         s_CanDragTabsProperty =
@@ -149,7 +162,7 @@ void TabViewProperties::EnsureProperties()
                 winrt::name_of<winrt::TabView>(),
                 false /* isAttached */,
                 ValueHelper<winrt::IInspectable>::BoxedDefaultValue(),
-                nullptr);
+                winrt::PropertyChangedCallback(&OnTabItemsSourcePropertyChanged));
     }
     if (!s_TabItemTemplateProperty)
     {
@@ -235,6 +248,7 @@ void TabViewProperties::ClearProperties()
     s_AddTabButtonCommandProperty = nullptr;
     s_AddTabButtonCommandParameterProperty = nullptr;
     s_AllowDropTabsProperty = nullptr;
+    s_CachedTabContentCountProperty = nullptr;
     s_CanDragTabsProperty = nullptr;
     s_CanReorderTabsProperty = nullptr;
     s_IsAddTabButtonVisibleProperty = nullptr;
@@ -251,6 +265,24 @@ void TabViewProperties::ClearProperties()
     s_TabWidthModeProperty = nullptr;
 }
 
+void TabViewProperties::OnCachedTabContentCountPropertyChanged(
+    winrt::DependencyObject const& sender,
+    winrt::DependencyPropertyChangedEventArgs const& args)
+{
+    auto owner = sender.as<winrt::TabView>();
+
+    auto value = winrt::unbox_value<int>(args.NewValue());
+    auto coercedValue = value;
+    winrt::get_self<TabView>(owner)->CoerceToGreaterThanOrEqualToZero(coercedValue);
+    if (value != coercedValue)
+    {
+        sender.SetValue(args.Property(), winrt::box_value<int>(coercedValue));
+        return;
+    }
+
+    winrt::get_self<TabView>(owner)->OnCachedTabContentCountPropertyChanged(args);
+}
+
 void TabViewProperties::OnSelectedIndexPropertyChanged(
     winrt::DependencyObject const& sender,
     winrt::DependencyPropertyChangedEventArgs const& args)
@@ -267,6 +299,14 @@ void TabViewProperties::OnSelectedItemPropertyChanged(
     winrt::get_self<TabView>(owner)->OnSelectedItemPropertyChanged(args);
 }
 
+void TabViewProperties::OnTabItemsSourcePropertyChanged(
+    winrt::DependencyObject const& sender,
+    winrt::DependencyPropertyChangedEventArgs const& args)
+{
+    auto owner = sender.as<winrt::TabView>();
+    winrt::get_self<TabView>(owner)->OnTabItemsSourcePropertyChanged(args);
+}
+
 void TabViewProperties::OnTabWidthModePropertyChanged(
     winrt::DependencyObject const& sender,
     winrt::DependencyPropertyChangedEventArgs const& args)
@@ -305,6 +345,18 @@ bool TabViewProperties::AllowDropTabs()
     return ValueHelper<bool>::CastOrUnbox(static_cast<TabView*>(this)->GetValue(s_AllowDropTabsProperty));
 }
 
+void TabViewProperties::CachedTabContentCount(int value)
+{
+    int coercedValue = value;
+    static_cast<TabView*>(this)->CoerceToGreaterThanOrEqualToZero(coercedValue);
+    static_cast<TabView*>(this)->SetValue(s_CachedTabContentCountProperty, ValueHelper<int>::BoxValueIfNecessary(coercedValue));
+}
+
+int TabViewProperties::CachedTabContentCount()
+{
+    return ValueHelper<int>::CastOrUnbox(static_cast<TabView*>(this)->GetValue(s_CachedTabContentCountProperty));
+}
+
 void TabViewProperties::CanDragTabs(bool value)
 {
     static_cast<TabView*>(this)->SetValue(s_CanDragTabsProperty, ValueHelper<bool>::BoxValueIfNecessary(value));
@@ -455,6 +507,16 @@ void TabViewProperties::AddTabButtonClick(winrt::event_token const& token)
     m_addTabButtonClickEventSource.remove(token);
 }
 
+winrt::event_token TabViewProperties::CachedTabContentEvicted(winrt::TypedEventHandler<winrt::TabView, winrt::TabViewCachedTabContentEvictedEventArgs> const& value)
+{
+    return m_cachedTabContentEvictedEventSource.add(value);
+}
+
+void TabViewProperties::CachedTabContentEvicted(winrt::event_token const& token)
+{
+    m_cachedTabContentEvictedEventSource.remove(token);
+}
+
 winrt::event_token TabViewProperties::SelectionChanged(winrt::SelectionChangedEventHandler const& value)
 {
     return m_selectionChangedEventSource.add(value);
@@ -18,6 +18,9 @@ public:
     void AllowDropTabs(bool value);
     bool AllowDropTabs();
 
+    void CachedTabContentCount(int value);
+    int CachedTabContentCount();
+
     void CanDragTabs(bool value);
     bool CanDragTabs();
 
@@ -63,6 +66,7 @@ public:
     static winrt::DependencyProperty AddTabButtonCommandProperty() { return s_AddTabButtonCommandProperty; }
     static winrt::DependencyProperty AddTabButtonCommandParameterProperty() { return s_AddTabButtonCommandParameterProperty; }
     static winrt::DependencyProperty AllowDropTabsProperty() { return s_AllowDropTabsProperty; }
+    static winrt::DependencyProperty CachedTabContentCountProperty() { return s_CachedTabContentCountProperty; }
     static winrt::DependencyProperty CanDragTabsProperty() { return s_CanDragTabsProperty; }
     static winrt::DependencyProperty CanReorderTabsProperty() { return s_CanReorderTabsProperty; }
     static winrt::DependencyProperty IsAddTabButtonVisibleProperty() { return s_IsAddTabButtonVisibleProperty; }
@@ -81,6 +85,7 @@ public:
     static GlobalDependencyProperty s_AddTabButtonCommandProperty;
     static GlobalDependencyProperty s_AddTabButtonCommandParameterProperty;
     static GlobalDependencyProperty s_AllowDropTabsProperty;
+    static GlobalDependencyProperty s_CachedTabContentCountProperty;
     static GlobalDependencyProperty s_CanDragTabsProperty;
     static GlobalDependencyProperty s_CanReorderTabsProperty;
     static GlobalDependencyProperty s_IsAddTabButtonVisibleProperty;
@@ -98,6 +103,8 @@ public:
 
     winrt::event_token AddTabButtonClick(winrt::TypedEventHandler<winrt::TabView, winrt::IInspectable> const& value);
     void AddTabButtonClick(winrt::event_token const& token);
+    winrt::event_token CachedTabContentEvicted(winrt::TypedEventHandler<winrt::TabView, winrt::TabViewCachedTabContentEvictedEventArgs> const& value);
+    void CachedTabContentEvicted(winrt::event_token const& token);
     winrt::event_token SelectionChanged(winrt::SelectionChangedEventHandler const& value);
     void SelectionChanged(winrt::event_token const& token);
     winrt::event_token TabCloseRequested(winrt::TypedEventHandler<winrt::TabView, winrt::TabViewTabCloseRequestedEventArgs> const& value);
@@ -114,6 +121,7 @@ public:
     void TabStripDrop(winrt::event_token const& token);
 
     event_source<winrt::TypedEventHandler<winrt::TabView, winrt::IInspectable>> m_addTabButtonClickEventSource;
+    event_source<winrt::TypedEventHandler<winrt::TabView, winrt::TabViewCachedTabContentEvictedEventArgs>> m_cachedTabContentEvictedEventSource;
     event_source<winrt::SelectionChangedEventHandler> m_selectionChangedEventSource;
     event_source<winrt::TypedEventHandler<winrt::TabView, winrt::TabViewTabCloseRequestedEventArgs>> m_tabCloseRequestedEventSource;
     event_source<winrt::TypedEventHandler<winrt::TabView, winrt::TabViewTabDragCompletedEventArgs>> m_tabDragCompletedEventSource;
@@ -125,6 +133,10 @@ public:
     static void EnsureProperties();
     static void ClearProperties();
 
+    static void OnCachedTabContentCountPropertyChanged(
+        winrt::DependencyObject const& sender,
+        winrt::DependencyPropertyChangedEventArgs const& args);
+
     static void OnSelectedIndexPropertyChanged(
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
@@ -133,6 +145,10 @@ public:
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
 
+    static void OnTabItemsSourcePropertyChanged(
+        winrt::DependencyObject const& sender,
+        winrt::DependencyPropertyChangedEventArgs const& args);
+
     static void OnTabWidthModePropertyChanged(
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
@@ -19,6 +19,9 @@ GlobalDependencyProperty UniformGridLayoutProperties::s_OrientationProperty{ nul
 UniformGridLayoutProperties::UniformGridLayoutProperties()
 {
     EnsureProperties();
+    m_cachedMinColumnSpacing = 0.0;
+    m_cachedMinRowSpacing = 0.0;
+    m_cachedOrientation = winrt::Orientation::Horizontal;
 }
 
 void UniformGridLayoutProperties::EnsureProperties()
@@ -134,6 +137,7 @@ void UniformGridLayoutProperties::OnMinColumnSpacingPropertyChanged(
     winrt::DependencyPropertyChangedEventArgs const& args)
 {
     auto owner = sender.as<winrt::UniformGridLayout>();
+    static_cast<UniformGridLayoutProperties*>(winrt::get_self<UniformGridLayout>(owner))->m_cachedMinColumnSpacing = ValueHelper<double>::CastOrUnbox(args.NewValue());
     winrt::get_self<UniformGridLayout>(owner)->OnPropertyChanged(args);
 }
 
@@ -158,6 +162,7 @@ void UniformGridLayoutProperties::OnMinRowSpacingPropertyChanged(
     winrt::DependencyPropertyChangedEventArgs const& args)
 {
     auto owner = sender.as<winrt::UniformGridLayout>();
+    static_cast<UniformGridLayoutProperties*>(winrt::get_self<UniformGridLayout>(owner))->m_cachedMinRowSpacing = ValueHelper<double>::CastOrUnbox(args.NewValue());
     winrt::get_self<UniformGridLayout>(owner)->OnPropertyChanged(args);
 }
 
@@ -166,6 +171,7 @@ void UniformGridLayoutProperties::OnOrientationPropertyChanged(
     winrt::DependencyPropertyChangedEventArgs const& args)
 {
     auto owner = sender.as<winrt::UniformGridLayout>();
+    static_cast<UniformGridLayoutProperties*>(winrt::get_self<UniformGridLayout>(owner))->m_cachedOrientation = ValueHelper<winrt::Orientation>::CastOrUnbox(args.NewValue());
     winrt::get_self<UniformGridLayout>(owner)->OnPropertyChanged(args);
 }
 
@@ -196,7 +202,7 @@ void UniformGridLayoutProperties::MinColumnSpacing(double value)
 
 double UniformGridLayoutProperties::MinColumnSpacing()
 {
-    return ValueHelper<double>::CastOrUnbox(static_cast<UniformGridLayout*>(this)->GetValue(s_MinColumnSpacingProperty));
+    return m_cachedMinColumnSpacing;
 }
 
 void UniformGridLayoutProperties::MinItemHeight(double value)
@@ -226,7 +232,7 @@ void UniformGridLayoutProperties::MinRowSpacing(double value)
 
 double UniformGridLayoutProperties::MinRowSpacing()
 {
-    return ValueHelper<double>::CastOrUnbox(static_cast<UniformGridLayout*>(this)->GetValue(s_MinRowSpacingProperty));
+    return m_cachedMinRowSpacing;
 }
 
 void UniformGridLayoutProperties::Orientation(winrt::Orientation const& value)
@@ -236,5 +242,5 @@ void UniformGridLayoutProperties::Orientation(winrt::Orientation const& value)
 
 winrt::Orientation UniformGridLayoutProperties::Orientation()
 {
-    return ValueHelper<winrt::Orientation>::CastOrUnbox(static_cast<UniformGridLayout*>(this)->GetValue(s_OrientationProperty));
+    return m_cachedOrientation;
 }
@@ -76,4 +76,9 @@ public:
     static void OnOrientationPropertyChanged(
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
+
+private:
+    double m_cachedMinColumnSpacing{};
+    double m_cachedMinRowSpacing{};
+    winrt::Orientation m_cachedOrientation{};
 };
@@ -2,6 +2,8 @@
 // Licensed under the MIT License. See LICENSE in the project root for license information.
 
 using System;
+using System.Collections.Generic;
+using System.Diagnostics;
 
 using MUXControlsTestApp.Utilities;
 
@@ -24,6 +26,8 @@ using SymbolIconSource = Microsoft.UI.Xaml.Controls.SymbolIconSource;
 using FontIconSource = Microsoft.UI.Xaml.Controls.FontIconSource;
 using BitmapIconSource = Microsoft.UI.Xaml.Controls.BitmapIconSource;
 using PathIconSource = Microsoft.UI.Xaml.Controls.PathIconSource;
+using IconSource = Microsoft.UI.Xaml.Controls.IconSource;
+using TabViewItem = Microsoft.UI.Xaml.Controls.TabViewItem;
 using XamlControlsXamlMetaDataProvider = Microsoft.UI.Xaml.XamlTypeInfo.XamlControlsXamlMetaDataProvider;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
@@ -190,6 +194,49 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        public void VerifyIconElementCreationCost()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var geometry = new RectangleGeometry();
+                var uri = new Uri("ms-appx:///Assets/ingredient1.png");
+
+                VerifyIconElementCreationCost(new SymbolIconSource() { Symbol = Symbol.Home }, icon =>
+                    Verify.AreEqual(Symbol.Home, ((SymbolIcon)icon).Symbol));
+                VerifyIconElementCreationCost(new FontIconSource() { Glyph = "\uE8A5" }, icon =>
+                    Verify.AreEqual("\uE8A5", ((FontIcon)icon).Glyph));
+                VerifyIconElementCreationCost(new BitmapIconSource() { UriSource = uri }, icon =>
+                    Verify.AreEqual(uri, ((BitmapIcon)icon).UriSource));
+                VerifyIconElementCreationCost(new PathIconSource() { Data = geometry }, icon =>
+                    Verify.AreSame(geometry, ((PathIcon)icon).Data, "Geometry data should be shared, not copied"));
+            });
+        }
+
+        private void VerifyIconElementCreationCost(IconSource iconSource, Action<IconElement> verifyIcon)
+        {
+            const int tabCount = 1000;
+
+            var stopwatch = Stopwatch.StartNew();
+            var tabs = new List<TabViewItem>(tabCount);
+            for (int i = 0; i < tabCount; i++)
+            {
+                tabs.Add(new TabViewItem() { IconSource = iconSource });
+            }
+            stopwatch.Stop();
+
+            Log.Comment("Created {0} tabs with a {1} in {2} ms",
+                tabCount, iconSource.GetType().Name, stopwatch.ElapsedMilliseconds);
+
+            var firstIcon = tabs[0].TabViewTemplateSettings.IconElement;
+            var lastIcon = tabs[tabCount - 1].TabViewTemplateSettings.IconElement;
+            Verify.IsNotNull(firstIcon);
+            Verify.IsNotNull(lastIcon);
+            Verify.AreNotSame(firstIcon, lastIcon, "Each tab should get its own IconElement");
+            verifyIcon(firstIcon);
+            verifyIcon(lastIcon);
+        }
+
         // XamlControlsXamlMetaDataProvider does not exist in the OS repo,
         // so we can't execute this test as authored there.
         [TestMethod]
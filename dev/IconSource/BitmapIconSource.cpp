@@ -3,6 +3,24 @@
 
 #include "pch.h"
 #include "common.h"
+#include "SharedHelpers.h"
 
 #include "IconSource.h"
 #include "BitmapIconSource.h"
+
+winrt::IconElement BitmapIconSource::CreateIconElementCore()
+{
+    winrt::BitmapIcon bitmapIcon;
+
+    if (auto uriSource = UriSource())
+    {
+        bitmapIcon.UriSource(uriSource);
+    }
+
+    if (SharedHelpers::IsBitmapIconShowAsMonochromeAvailable())
+    {
+        bitmapIcon.ShowAsMonochrome(ShowAsMonochrome());
+    }
+
+    return bitmapIcon;
+}
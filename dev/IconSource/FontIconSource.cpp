@@ -6,3 +6,23 @@
 
 #include "IconSource.h"
 #include "FontIconSource.h"
+
+winrt::IconElement FontIconSource::CreateIconElementCore()
+{
+    winrt::FontIcon fontIcon;
+
+    fontIcon.Glyph(Glyph());
+    fontIcon.FontSize(FontSize());
+
+    if (auto fontFamily = FontFamily())
+    {
+        fontIcon.FontFamily(fontFamily);
+    }
+
+    fontIcon.FontWeight(FontWeight());
+    fontIcon.FontStyle(FontStyle());
+    fontIcon.IsTextScaleFactorEnabled(IsTextScaleFactorEnabled());
+    fontIcon.MirroredWhenRightToLeft(MirroredWhenRightToLeft());
+
+    return fontIcon;
+}
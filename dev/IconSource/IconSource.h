@@ -7,7 +7,7 @@
 #include "IconSource.properties.h"
 
 class IconSource : 
-    public winrt::implementation::IconSourceT<IconSource, winrt::composable>,
+    public winrt::implementation::IconSourceT<IconSource, winrt::composable, winrt::IIconSourcePrivate>,
     public IconSourceProperties
 {
 public:
@@ -15,4 +15,11 @@ public:
     {
         return SharedHelpers::MakeIconElementFrom(iconSource);
     }
+
+    // IIconSourcePrivate
+    winrt::IconElement CreateIconElement() { return CreateIconElementCore(); }
+
+    // Creates a new IconElement matching this IconSource. Immutable values such as geometry
+    // data and bitmap Uris are shared with the IconSource rather than copied.
+    virtual winrt::IconElement CreateIconElementCore() { return nullptr; }
 };
\ No newline at end of file
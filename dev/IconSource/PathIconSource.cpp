@@ -6,3 +6,15 @@
 
 #include "IconSource.h"
 #include "PathIconSource.h"
+
+winrt::IconElement PathIconSource::CreateIconElementCore()
+{
+    winrt::PathIcon pathIcon;
+
+    if (auto data = Data())
+    {
+        pathIcon.Data(data);
+    }
+
+    return pathIcon;
+}
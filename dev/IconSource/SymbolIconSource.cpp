@@ -7,3 +7,10 @@
 #include "IconSource.h"
 #include "SymbolIconSource.h"
 
+winrt::IconElement SymbolIconSource::CreateIconElementCore()
+{
+    winrt::SymbolIcon symbolIcon;
+    symbolIcon.Symbol(Symbol());
+
+    return symbolIcon;
+}
@@ -14,4 +14,6 @@ class SymbolIconSource :
 public:
     using SymbolIconSourceProperties::EnsureProperties;
     using SymbolIconSourceProperties::ClearProperties;
+
+    winrt::IconElement CreateIconElementCore() override;
 };
@@ -7,6 +7,7 @@ using Windows.UI.Xaml.Controls.Primitives;
 using Windows.UI.Xaml;
 using System.Threading;
 using System;
+using System.Diagnostics;
 using Windows.UI.Xaml.Media;
 using Windows.UI;
 using Windows.Foundation;
@@ -236,6 +237,45 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
 
             IdleSynchronizer.Wait();
         }
+
+        [TestMethod]
+        public void VerifyRepeatedLayoutPassesWithManyChildren()
+        {
+            const int childCount = 500;
+            const int passCount = 50;
+
+            RunOnUIThread.Execute(() =>
+            {
+                foreach (var layout in new NonVirtualizingLayout[] { new StackLayout(), new MyCustomNonVirtualizingStackLayout() })
+                {
+                    Log.Comment("Create LayoutPanel with " + childCount + " children and " + layout.GetType().Name);
+
+                    var panel = new LayoutPanel() { Width = 400, Layout = layout };
+                    for (int i = 0; i < childCount; i++)
+                    {
+                        panel.Children.Add(new Border { Height = 20, Width = 400 });
+                    }
+
+                    Content = panel;
+                    Content.UpdateLayout();
+
+                    var stopwatch = Stopwatch.StartNew();
+                    for (int pass = 0; pass < passCount; pass++)
+                    {
+                        panel.InvalidateMeasure();
+                        panel.UpdateLayout();
+                    }
+                    stopwatch.Stop();
+
+                    Log.Comment(passCount + " layout passes took " + stopwatch.ElapsedMilliseconds + "ms");
+
+                    Verify.AreEqual(new Rect(0, 0, 400, 20), LayoutInformation.GetLayoutSlot(panel.Children[0]), "Verify LayoutSlot of first child");
+                    Verify.AreEqual(new Rect(0, 20 * (childCount - 1), 400, 20), LayoutInformation.GetLayoutSlot(panel.Children[childCount - 1]), "Verify LayoutSlot of last child");
+                }
+            });
+
+            IdleSynchronizer.Wait();
+        }
     }
 
     public class MyCustomNonVirtualizingStackLayout: NonVirtualizingLayout
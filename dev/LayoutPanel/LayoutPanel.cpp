@@ -196,6 +196,12 @@ winrt::Size LayoutPanel::MeasureOverride(winrt::Size const& availableSize)
 
     if (auto layout = Layout())
     {
+        m_layoutContextImpl->BeginLayoutPass();
+        auto endLayoutPass = gsl::finally([this]()
+        {
+            m_layoutContextImpl->EndLayoutPass();
+        });
+
         auto layoutDesiredSize = layout.Measure(m_layoutContext, adjustedSize);
         layoutDesiredSize.Width += effectiveHorizontalPadding;
         layoutDesiredSize.Height += effectiveVerticalPadding;
@@ -239,6 +245,12 @@ winrt::Size LayoutPanel::ArrangeOverride(winrt::Size const& finalSize)
     
     if (auto layout = Layout())
     {
+        m_layoutContextImpl->BeginLayoutPass();
+        auto endLayoutPass = gsl::finally([this]()
+        {
+            m_layoutContextImpl->EndLayoutPass();
+        });
+
         auto layoutSize = layout.Arrange(m_layoutContext, adjustedSize);
         layoutSize.Width += effectiveHorizontalPadding;
         layoutSize.Height += effectiveVerticalPadding;
@@ -276,7 +288,8 @@ void LayoutPanel::OnLayoutChanged(winrt::Layout const& oldValue, winrt::Layout c
 {
     if (!m_layoutContext)
     {
-        m_layoutContext = winrt::make<LayoutPanelLayoutContext>(*this);
+        m_layoutContextImpl = winrt::make_self<LayoutPanelLayoutContext>(*this);
+        m_layoutContext = m_layoutContextImpl.as<winrt::LayoutContext>();
     }
 
     if (oldValue)
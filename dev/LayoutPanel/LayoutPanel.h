@@ -3,6 +3,7 @@
 
 #pragma once
 #include "LayoutPanel.g.h"
+#include "LayoutPanelLayoutContext.h"
 
 class LayoutPanel : 
     public ReferenceTracker<LayoutPanel, winrt::implementation::LayoutPanelT>
@@ -53,6 +54,7 @@ public:
 
 private:
     winrt::LayoutContext m_layoutContext{ nullptr };
+    winrt::com_ptr<LayoutPanelLayoutContext> m_layoutContextImpl{ nullptr };
 
     tracker_ref<winrt::IInspectable> m_layoutState{ this };
     tracker_ref<winrt::Layout, TrackerRefFallback::FallbackToComPtrBeforeRS4> m_layout{ this };
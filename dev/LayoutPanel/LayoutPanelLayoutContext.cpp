@@ -13,6 +13,11 @@ LayoutPanelLayoutContext::LayoutPanelLayoutContext(winrt::LayoutPanel const& own
 
 winrt::IVectorView<winrt::UIElement> LayoutPanelLayoutContext::ChildrenCore()
 {
+    if (m_passChildren)
+    {
+        return m_passChildren;
+    }
+
     return winrt::get_self<LayoutPanel>(GetOwner())->Children().GetView();
 }
 
@@ -26,7 +31,33 @@ void LayoutPanelLayoutContext::LayoutStateCore(winrt::IInspectable const& value)
     winrt::get_self<LayoutPanel>(GetOwner())->LayoutState(value);
 }
 
+void LayoutPanelLayoutContext::BeginLayoutPass()
+{
+    if (m_layoutPassDepth++ == 0)
+    {
+        m_passOwner = m_owner.get();
+        if (m_passOwner)
+        {
+            m_passChildren = winrt::get_self<LayoutPanel>(m_passOwner)->Children().GetView();
+        }
+    }
+}
+
+void LayoutPanelLayoutContext::EndLayoutPass()
+{
+    if (--m_layoutPassDepth == 0)
+    {
+        m_passChildren = nullptr;
+        m_passOwner = nullptr;
+    }
+}
+
 winrt::LayoutPanel LayoutPanelLayoutContext::GetOwner()
 {
+    if (m_passOwner)
+    {
+        return m_passOwner;
+    }
+
     return m_owner.get();
 }
\ No newline at end of file
@@ -19,6 +19,11 @@ public:
 
 #pragma endregion
 
+    // While a layout pass is in progress, the owner and its children view are resolved once
+    // instead of on every call the layout makes. Both are released when the pass ends so that
+    // the context does not keep its owner alive.
+    void BeginLayoutPass();
+    void EndLayoutPass();
 
 private:
     winrt::LayoutPanel GetOwner();
@@ -26,4 +31,8 @@ private:
     // We hold a weak reference to prevent a leaking reference
     // cycle between the LayoutPanel and its layout.
     winrt::weak_ref<winrt::LayoutPanel> m_owner;
+
+    winrt::LayoutPanel m_passOwner{ nullptr };
+    winrt::IVectorView<winrt::UIElement> m_passChildren{ nullptr };
+    int m_layoutPassDepth{ 0 };
 };
\ No newline at end of file
@@ -93,6 +93,10 @@ void NavigationView::UnhookEventsAndClearFields(bool isFromDestructor)
     m_settingsItemTappedRevoker.revoke();
     m_settingsItemKeyDownRevoker.revoke();
     m_settingsItemKeyUpRevoker.revoke();
+    if (auto settingsItem = m_settingsItem.get())
+    {
+        winrt::get_self<NavigationViewItem>(settingsItem)->SetPaneState(nullptr, nullptr);
+    }
     m_settingsItem.set(nullptr);
 
     m_leftNavListViewSelectionChangedRevoker.revoke();
@@ -163,6 +167,8 @@ void NavigationView::OnApplyTemplate()
 
     winrt::IControlProtected controlProtected = *this;
 
+    m_paneState->SetNavigationView(*this);
+
     // Set up the pane toggle button click handler
     if (auto paneToggleButton = GetTemplateChildT<winrt::Button>(c_togglePaneButtonName, controlProtected))
     {
@@ -200,6 +206,10 @@ void NavigationView::OnApplyTemplate()
             winrt::SplitView::DisplayModeProperty(), 
             { this, &NavigationView::OnSplitViewClosedCompactChanged });
 
+        m_splitViewCompactPaneLengthChangedRevoker = RegisterPropertyChanged(splitView,
+            winrt::SplitView::CompactPaneLengthProperty(),
+            { this, &NavigationView::OnSplitViewClosedCompactChanged });
+
         if (SharedHelpers::IsRS3OrHigher()) // These events are new to RS3/v5 API
         {
             m_splitViewPaneClosedRevoker = splitView.PaneClosed(winrt::auto_revoke, { this, &NavigationView::OnSplitViewPaneClosed });
@@ -403,7 +413,12 @@ void NavigationView::CreateAndHookEventsToSettings(std::wstring_view settingsNam
         m_settingsItemKeyDownRevoker.revoke();
         m_settingsItemKeyUpRevoker.revoke();
 
+        if (auto oldSettingsItem = m_settingsItem.get())
+        {
+            winrt::get_self<NavigationViewItem>(oldSettingsItem)->SetPaneState(nullptr, nullptr);
+        }
         m_settingsItem.set(settingsItem);
+        winrt::get_self<NavigationViewItem>(settingsItem)->SetPaneState(m_paneState, nullptr);
         m_settingsItemTappedRevoker = settingsItem.Tapped(winrt::auto_revoke, { this, &NavigationView::OnSettingsTapped });
         m_settingsItemKeyDownRevoker = settingsItem.KeyDown(winrt::auto_revoke, { this, &NavigationView::OnSettingsKeyDown });
         m_settingsItemKeyUpRevoker = settingsItem.KeyUp(winrt::auto_revoke, { this, &NavigationView::OnSettingsKeyUp });
@@ -683,6 +698,10 @@ void NavigationView::OnSplitViewClosedCompactChanged(const winrt::DependencyObje
     {
         UpdateIsClosedCompact();
     }
+    else if (args == winrt::SplitView::CompactPaneLengthProperty())
+    {
+        UpdatePaneState();
+    }
 }
 
 void NavigationView::OnSplitViewPaneClosed(const winrt::DependencyObject& /*sender*/, const winrt::IInspectable& obj)
@@ -772,6 +791,17 @@ void NavigationView::UpdateIsClosedCompact()
         UpdateBackAndCloseButtonsVisibility();
         UpdatePaneTitleMargins();
         UpdatePaneToggleSize();
+        UpdatePaneState();
+    }
+}
+
+// Items observe the shared pane state instead of each registering on the SplitView, so this is the
+// only place the closed compact state is computed and every item is notified once per change.
+void NavigationView::UpdatePaneState()
+{
+    if (auto splitView = m_rootSplitView.get())
+    {
+        m_paneState->Update(m_isClosedCompact, splitView.CompactPaneLength());
     }
 }
 
@@ -971,11 +1001,6 @@ void NavigationView::OnSettingsInvoked()
     }
 }
 
-winrt::float2 c_frame1point1 = winrt::float2(0.9f, 0.1f);
-winrt::float2 c_frame1point2 = winrt::float2(1.0f, 0.2f);
-winrt::float2 c_frame2point1 = winrt::float2(0.1f, 0.9f);
-winrt::float2 c_frame2point2 = winrt::float2(0.2f, 1.0f);
-
 void NavigationView::AnimateSelectionChangedToItem(const winrt::IInspectable& selectedItem)
 {
     if (selectedItem && !IsSelectionSuppressed(selectedItem))
@@ -1084,62 +1109,19 @@ void NavigationView::AnimateSelectionChanged(const winrt::IInspectable& prevItem
 void NavigationView::PlayIndicatorAnimations(const winrt::UIElement& indicator, float from, float to, winrt::Size beginSize, winrt::Size endSize, bool isOutgoing)
 {
     winrt::Visual visual = winrt::ElementCompositionPreview::GetElementVisual(indicator);
-    winrt::Compositor comp = visual.Compositor();
+    const bool isTopNavigationView = IsTopNavigationView();
+    const NavigationViewIndicatorKeyFrames keyFrames{ isTopNavigationView, indicator.RenderSize(), beginSize, endSize, from, to };
 
-    winrt::Size size = indicator.RenderSize();
-    float dimension = IsTopNavigationView() ? size.Width : size.Height;
-
-    float beginScale = 1.0f;
-    float endScale = 1.0f;
-    if (IsTopNavigationView() && fabs(size.Width) > 0.001f)
-    {
-        beginScale = beginSize.Width / size.Width;
-        endScale = endSize.Width / size.Width;
-    }
-
-    winrt::StepEasingFunction singleStep = comp.CreateStepEasingFunction();
-    singleStep.IsFinalStepSingleFrame(true);
-
-    if (isOutgoing)
-    {
-        // fade the outgoing indicator so it looks nice when animating over the scroll area
-        winrt::ScalarKeyFrameAnimation opacityAnim = comp.CreateScalarKeyFrameAnimation();
-        opacityAnim.InsertKeyFrame(0.0f, 1.0);
-        opacityAnim.InsertKeyFrame(0.333f, 1.0, singleStep);
-        opacityAnim.InsertKeyFrame(1.0f, 0.0, comp.CreateCubicBezierEasingFunction(c_frame2point1, c_frame2point2));
-        opacityAnim.Duration(600ms);
-
-        visual.StartAnimation(L"Opacity", opacityAnim);
-    }
-
-    winrt::ScalarKeyFrameAnimation posAnim = comp.CreateScalarKeyFrameAnimation();
-    posAnim.InsertKeyFrame(0.0f, from < to ? from : (from + (dimension * (beginScale - 1))));
-    posAnim.InsertKeyFrame(0.333f, from < to ? (to + (dimension * (endScale - 1))) : to, singleStep);
-    posAnim.Duration(600ms);
-
-    winrt::ScalarKeyFrameAnimation scaleAnim = comp.CreateScalarKeyFrameAnimation();
-    scaleAnim.InsertKeyFrame(0.0f, beginScale);
-    scaleAnim.InsertKeyFrame(0.333f, abs(to - from) / dimension + (from < to ? endScale : beginScale), comp.CreateCubicBezierEasingFunction(c_frame1point1, c_frame1point2));
-    scaleAnim.InsertKeyFrame(1.0f, endScale, comp.CreateCubicBezierEasingFunction(c_frame2point1, c_frame2point2));
-    scaleAnim.Duration(600ms);
-
-    winrt::ScalarKeyFrameAnimation centerAnim = comp.CreateScalarKeyFrameAnimation();
-    centerAnim.InsertKeyFrame(0.0f, from < to ? 0.0f : dimension);
-    centerAnim.InsertKeyFrame(1.0f, from < to ? dimension : 0.0f, singleStep);
-    centerAnim.Duration(200ms);
+    EnsureIndicatorAnimations(visual.Compositor())->Start(visual, isTopNavigationView, keyFrames, isOutgoing);
+}
 
-    if (IsTopNavigationView())
-    {
-        visual.StartAnimation(L"Offset.X", posAnim);
-        visual.StartAnimation(L"Scale.X", scaleAnim);
-        visual.StartAnimation(L"CenterPoint.X", centerAnim);
-    }
-    else
+const std::shared_ptr<NavigationViewIndicatorAnimations>& NavigationView::EnsureIndicatorAnimations(const winrt::Compositor& compositor)
+{
+    if (!m_indicatorAnimations || m_indicatorAnimations->Compositor() != compositor)
     {
-        visual.StartAnimation(L"Offset.Y", posAnim);
-        visual.StartAnimation(L"Scale.Y", scaleAnim);
-        visual.StartAnimation(L"CenterPoint.Y", centerAnim);
+        m_indicatorAnimations = NavigationViewIndicatorAnimations::GetForCompositor(compositor);
     }
+    return m_indicatorAnimations;
 }
 
 void NavigationView::OnAnimationComplete(const winrt::IInspectable& /*sender*/, const winrt::CompositionBatchCompletedEventArgs& /*args*/)
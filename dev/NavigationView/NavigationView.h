@@ -12,6 +12,8 @@ struct bringintoview_event_revoker;
 #include "NavigationView.g.h"
 #include "TopNavigationViewDataProvider.h"
 #include "NavigationViewHelper.h"
+#include "NavigationViewPaneState.h"
+#include "NavigationViewIndicatorAnimations.h"
 #include "NavigationView.properties.h"
 
 enum class TopNavigationViewLayoutState
@@ -73,6 +75,7 @@ public:
     int GetNavigationViewItemCountInPrimaryList();
     int GetNavigationViewItemCountInTopNav();
     winrt::SplitView GetSplitView();
+    const std::shared_ptr<NavigationViewPaneState>& GetPaneState() const { return m_paneState; }
     TopNavigationViewDataProvider& GetTopDataProvider() { return m_topDataProvider; };
     winrt::ListView LeftNavListView() { return m_leftNavListView.get(); };
     void TopNavigationViewItemContentChanged();
@@ -200,6 +203,7 @@ private:
     void AnimateSelectionChanged(const winrt::IInspectable& lastItem, const winrt::IInspectable& currentItem);
     void AnimateSelectionChangedToItem(const winrt::IInspectable& selectedItem);
     void PlayIndicatorAnimations(const winrt::UIElement& indicator, float yFrom, float yTo, winrt::Size beginSize, winrt::Size endSize, bool isOutgoing);
+    const std::shared_ptr<NavigationViewIndicatorAnimations>& EnsureIndicatorAnimations(const winrt::Compositor& compositor);
     void OnAnimationComplete(const winrt::IInspectable& sender, const winrt::CompositionBatchCompletedEventArgs& args);
     void ResetElementAnimationProperties(const winrt::UIElement& element, float desiredOpacity);
     winrt::NavigationViewItem NavigationViewItemOrSettingsContentFromData(const winrt::IInspectable& data);
@@ -255,6 +259,7 @@ private:
     void OnSplitViewPaneOpened(const winrt::DependencyObject& sender, const winrt::IInspectable& obj);
     void OnSplitViewPaneOpening(const winrt::DependencyObject& sender, const winrt::IInspectable& obj);
     void UpdateIsClosedCompact();
+    void UpdatePaneState();
 
     void OnBackButtonClicked(const winrt::IInspectable& sender, const winrt::RoutedEventArgs& args);
 
@@ -290,6 +295,7 @@ private:
 
     tracker_ref<winrt::UIElement> m_prevIndicator{ this };
     tracker_ref<winrt::UIElement> m_nextIndicator{ this };
+    std::shared_ptr<NavigationViewIndicatorAnimations> m_indicatorAnimations{ nullptr };
 
     tracker_ref<winrt::FrameworkElement> m_togglePaneTopPadding{ this };
     tracker_ref<winrt::FrameworkElement> m_contentPaneTopPadding{ this };
@@ -337,6 +343,7 @@ private:
     winrt::ListView::SelectionChanged_revoker m_topNavListOverflowViewSelectionChangedRevoker{};
     PropertyChanged_revoker m_splitViewIsPaneOpenChangedRevoker{};
     PropertyChanged_revoker m_splitViewDisplayModeChangedRevoker{};
+    PropertyChanged_revoker m_splitViewCompactPaneLengthChangedRevoker{};
     winrt::SplitView::PaneClosed_revoker m_splitViewPaneClosedRevoker{};
     winrt::SplitView::PaneClosing_revoker m_splitViewPaneClosingRevoker{};
     winrt::SplitView::PaneOpened_revoker m_splitViewPaneOpenedRevoker{};
@@ -347,6 +354,7 @@ private:
 
     bool m_wasForceClosed{ false };
     bool m_isClosedCompact{ false };
+    std::shared_ptr<NavigationViewPaneState> m_paneState{ std::make_shared<NavigationViewPaneState>() };
     bool m_blockNextClosingEvent{ false };
     bool m_initialListSizeStateSet{ false };
 
@@ -0,0 +1,129 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "NavigationViewIndicatorAnimations.h"
+
+thread_local int NavigationViewIndicatorAnimations::s_createdAnimationObjectCount{ 0 };
+
+// Only a weak reference is kept so that the animations go away with the last NavigationView using them.
+static thread_local std::weak_ptr<NavigationViewIndicatorAnimations> s_animations;
+
+NavigationViewIndicatorAnimations::NavigationViewIndicatorAnimations(const winrt::Compositor& compositor) :
+    m_compositor(compositor)
+{
+    auto const singleStep = CreateSingleStepEasingFunction(compositor);
+    auto const growEasingFunction = CreateGrowEasingFunction(compositor);
+    auto const shrinkEasingFunction = CreateShrinkEasingFunction(compositor);
+
+    m_opacityAnimation = CreateOpacityAnimation(compositor, singleStep, shrinkEasingFunction);
+    m_positionAnimation = CreatePositionAnimation(compositor, singleStep);
+    m_scaleAnimation = CreateScaleAnimation(compositor, growEasingFunction, shrinkEasingFunction);
+    m_centerPointAnimation = CreateCenterPointAnimation(compositor, singleStep);
+}
+
+/* static */
+std::shared_ptr<NavigationViewIndicatorAnimations> NavigationViewIndicatorAnimations::GetForCompositor(const winrt::Compositor& compositor)
+{
+    auto animations = s_animations.lock();
+    if (!animations || animations->Compositor() != compositor)
+    {
+        animations = std::make_shared<NavigationViewIndicatorAnimations>(compositor);
+        s_animations = animations;
+    }
+    return animations;
+}
+
+/* static */
+winrt::StepEasingFunction NavigationViewIndicatorAnimations::CreateSingleStepEasingFunction(const winrt::Compositor& compositor)
+{
+    s_createdAnimationObjectCount++;
+    auto const singleStep = compositor.CreateStepEasingFunction();
+    singleStep.IsFinalStepSingleFrame(true);
+    return singleStep;
+}
+
+/* static */
+winrt::CompositionEasingFunction NavigationViewIndicatorAnimations::CreateGrowEasingFunction(const winrt::Compositor& compositor)
+{
+    s_createdAnimationObjectCount++;
+    return compositor.CreateCubicBezierEasingFunction(s_growEasingCurveControlPoint1, s_growEasingCurveControlPoint2);
+}
+
+/* static */
+winrt::CompositionEasingFunction NavigationViewIndicatorAnimations::CreateShrinkEasingFunction(const winrt::Compositor& compositor)
+{
+    s_createdAnimationObjectCount++;
+    return compositor.CreateCubicBezierEasingFunction(s_shrinkEasingCurveControlPoint1, s_shrinkEasingCurveControlPoint2);
+}
+
+/* static */
+winrt::ScalarKeyFrameAnimation NavigationViewIndicatorAnimations::CreateOpacityAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& singleStep, const winrt::CompositionEasingFunction& shrinkEasingFunction)
+{
+    s_createdAnimationObjectCount++;
+    auto const opacityAnimation = compositor.CreateScalarKeyFrameAnimation();
+    opacityAnimation.InsertKeyFrame(0.0f, 1.0);
+    opacityAnimation.InsertKeyFrame(0.333f, 1.0, singleStep);
+    opacityAnimation.InsertKeyFrame(1.0f, 0.0, shrinkEasingFunction);
+    opacityAnimation.Duration(600ms);
+    return opacityAnimation;
+}
+
+/* static */
+winrt::ScalarKeyFrameAnimation NavigationViewIndicatorAnimations::CreatePositionAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& singleStep)
+{
+    s_createdAnimationObjectCount++;
+    auto const positionAnimation = compositor.CreateScalarKeyFrameAnimation();
+    positionAnimation.InsertExpressionKeyFrame(0.0f, s_startParameterName);
+    positionAnimation.InsertExpressionKeyFrame(0.333f, s_endParameterName, singleStep);
+    positionAnimation.Duration(600ms);
+    return positionAnimation;
+}
+
+/* static */
+winrt::ScalarKeyFrameAnimation NavigationViewIndicatorAnimations::CreateScaleAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& growEasingFunction, const winrt::CompositionEasingFunction& shrinkEasingFunction)
+{
+    s_createdAnimationObjectCount++;
+    auto const scaleAnimation = compositor.CreateScalarKeyFrameAnimation();
+    scaleAnimation.InsertExpressionKeyFrame(0.0f, s_startParameterName);
+    scaleAnimation.InsertExpressionKeyFrame(0.333f, s_middleParameterName, growEasingFunction);
+    scaleAnimation.InsertExpressionKeyFrame(1.0f, s_endParameterName, shrinkEasingFunction);
+    scaleAnimation.Duration(600ms);
+    return scaleAnimation;
+}
+
+/* static */
+winrt::ScalarKeyFrameAnimation NavigationViewIndicatorAnimations::CreateCenterPointAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& singleStep)
+{
+    s_createdAnimationObjectCount++;
+    auto const centerPointAnimation = compositor.CreateScalarKeyFrameAnimation();
+    centerPointAnimation.InsertExpressionKeyFrame(0.0f, s_startParameterName);
+    centerPointAnimation.InsertExpressionKeyFrame(1.0f, s_endParameterName, singleStep);
+    centerPointAnimation.Duration(200ms);
+    return centerPointAnimation;
+}
+
+// The animations are shared, so the values of this selection change are set right before starting them.
+// Composition takes a copy of the animation, including its parameters, at that point.
+void NavigationViewIndicatorAnimations::Start(const winrt::Visual& visual, bool isTopNavigationView, const NavigationViewIndicatorKeyFrames& keyFrames, bool isOutgoing) const
+{
+    if (isOutgoing)
+    {
+        // fade the outgoing indicator so it looks nice when animating over the scroll area
+        visual.StartAnimation(L"Opacity", m_opacityAnimation);
+    }
+
+    m_positionAnimation.SetScalarParameter(s_startParameterName, keyFrames.PositionStart());
+    m_positionAnimation.SetScalarParameter(s_endParameterName, keyFrames.PositionEnd());
+    visual.StartAnimation(isTopNavigationView ? L"Offset.X" : L"Offset.Y", m_positionAnimation);
+
+    m_scaleAnimation.SetScalarParameter(s_startParameterName, keyFrames.ScaleStart());
+    m_scaleAnimation.SetScalarParameter(s_middleParameterName, keyFrames.ScaleMiddle());
+    m_scaleAnimation.SetScalarParameter(s_endParameterName, keyFrames.ScaleEnd());
+    visual.StartAnimation(isTopNavigationView ? L"Scale.X" : L"Scale.Y", m_scaleAnimation);
+
+    m_centerPointAnimation.SetScalarParameter(s_startParameterName, keyFrames.CenterPointStart());
+    m_centerPointAnimation.SetScalarParameter(s_endParameterName, keyFrames.CenterPointEnd());
+    visual.StartAnimation(isTopNavigationView ? L"CenterPoint.X" : L"CenterPoint.Y", m_centerPointAnimation);
+}
@@ -0,0 +1,51 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "NavigationViewIndicatorKeyFrames.h"
+
+// Selection indicator animations shared by the NavigationViews of a compositor. The key frame values of a
+// selection change are passed as the StartValue, MiddleValue and EndValue parameters. The same set animates
+// the X axis in top navigation and the Y axis in left navigation.
+class NavigationViewIndicatorAnimations
+{
+public:
+    explicit NavigationViewIndicatorAnimations(const winrt::Compositor& compositor);
+
+    static std::shared_ptr<NavigationViewIndicatorAnimations> GetForCompositor(const winrt::Compositor& compositor);
+
+    // Number of composition animations and easing functions created for selection indicators on this thread.
+    static int CreatedAnimationObjectCount() { return s_createdAnimationObjectCount; }
+
+    static winrt::StepEasingFunction CreateSingleStepEasingFunction(const winrt::Compositor& compositor);
+    static winrt::CompositionEasingFunction CreateGrowEasingFunction(const winrt::Compositor& compositor);
+    static winrt::CompositionEasingFunction CreateShrinkEasingFunction(const winrt::Compositor& compositor);
+    static winrt::ScalarKeyFrameAnimation CreateOpacityAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& singleStep, const winrt::CompositionEasingFunction& shrinkEasingFunction);
+    static winrt::ScalarKeyFrameAnimation CreatePositionAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& singleStep);
+    static winrt::ScalarKeyFrameAnimation CreateScaleAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& growEasingFunction, const winrt::CompositionEasingFunction& shrinkEasingFunction);
+    static winrt::ScalarKeyFrameAnimation CreateCenterPointAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& singleStep);
+
+    // Starts the animations on the visual of an indicator. The opacity animation is only played on the outgoing indicator.
+    void Start(const winrt::Visual& visual, bool isTopNavigationView, const NavigationViewIndicatorKeyFrames& keyFrames, bool isOutgoing) const;
+
+    winrt::Compositor Compositor() const { return m_compositor; }
+
+    static constexpr wstring_view s_startParameterName{ L"StartValue"sv };
+    static constexpr wstring_view s_middleParameterName{ L"MiddleValue"sv };
+    static constexpr wstring_view s_endParameterName{ L"EndValue"sv };
+
+private:
+    winrt::Compositor m_compositor{ nullptr };
+    winrt::ScalarKeyFrameAnimation m_opacityAnimation{ nullptr };
+    winrt::ScalarKeyFrameAnimation m_positionAnimation{ nullptr };
+    winrt::ScalarKeyFrameAnimation m_scaleAnimation{ nullptr };
+    winrt::ScalarKeyFrameAnimation m_centerPointAnimation{ nullptr };
+
+    static thread_local int s_createdAnimationObjectCount;
+
+    static constexpr winrt::float2 s_growEasingCurveControlPoint1{ 0.9f, 0.1f };
+    static constexpr winrt::float2 s_growEasingCurveControlPoint2{ 1.0f, 0.2f };
+    static constexpr winrt::float2 s_shrinkEasingCurveControlPoint1{ 0.1f, 0.9f };
+    static constexpr winrt::float2 s_shrinkEasingCurveControlPoint2{ 0.2f, 1.0f };
+};
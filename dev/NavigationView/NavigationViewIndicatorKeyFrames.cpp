@@ -0,0 +1,38 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "NavigationViewIndicatorKeyFrames.h"
+
+NavigationViewIndicatorKeyFrames::NavigationViewIndicatorKeyFrames(
+    bool isTopNavigationView,
+    const winrt::Size& indicatorSize,
+    const winrt::Size& beginSize,
+    const winrt::Size& endSize,
+    float from,
+    float to)
+{
+    const float dimension = isTopNavigationView ? indicatorSize.Width : indicatorSize.Height;
+
+    // Top navigation items can have different widths, the indicator gets stretched to the size of the items.
+    float beginScale = 1.0f;
+    float endScale = 1.0f;
+    if (isTopNavigationView && std::abs(indicatorSize.Width) > 0.001f)
+    {
+        beginScale = beginSize.Width / indicatorSize.Width;
+        endScale = endSize.Width / indicatorSize.Width;
+    }
+
+    const bool isMovingForward = from < to;
+
+    m_positionStart = isMovingForward ? from : (from + (dimension * (beginScale - 1)));
+    m_positionEnd = isMovingForward ? (to + (dimension * (endScale - 1))) : to;
+
+    m_scaleStart = beginScale;
+    m_scaleMiddle = std::abs(to - from) / dimension + (isMovingForward ? endScale : beginScale);
+    m_scaleEnd = endScale;
+
+    m_centerPointStart = isMovingForward ? 0.0f : dimension;
+    m_centerPointEnd = isMovingForward ? dimension : 0.0f;
+}
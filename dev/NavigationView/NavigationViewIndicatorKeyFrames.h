@@ -0,0 +1,37 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Key frame values of the animations moving a selection indicator from one NavigationView item to another.
+// Positions are relative to the indicator's own position and only the axis of the pane matters: X for top
+// navigation, Y otherwise. This type has no dependency on any XAML or composition object so that the values
+// fed to the shared NavigationViewIndicatorAnimations can be verified on their own.
+class NavigationViewIndicatorKeyFrames
+{
+public:
+    NavigationViewIndicatorKeyFrames(
+        bool isTopNavigationView,
+        const winrt::Size& indicatorSize,
+        const winrt::Size& beginSize,
+        const winrt::Size& endSize,
+        float from,
+        float to);
+
+    float PositionStart() const { return m_positionStart; }
+    float PositionEnd() const { return m_positionEnd; }
+    float ScaleStart() const { return m_scaleStart; }
+    float ScaleMiddle() const { return m_scaleMiddle; }
+    float ScaleEnd() const { return m_scaleEnd; }
+    float CenterPointStart() const { return m_centerPointStart; }
+    float CenterPointEnd() const { return m_centerPointEnd; }
+
+private:
+    float m_positionStart{};
+    float m_positionEnd{};
+    float m_scaleStart{ 1.0f };
+    float m_scaleMiddle{ 1.0f };
+    float m_scaleEnd{ 1.0f };
+    float m_centerPointStart{};
+    float m_centerPointEnd{};
+};
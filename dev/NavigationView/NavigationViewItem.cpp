@@ -7,6 +7,7 @@
 #include "NavigationView.h"
 #include "NavigationViewItem.h"
 #include "NavigationViewItemAutomationPeer.h"
+#include "NavigationViewList.h"
 #include "Utils.h"
 
 
@@ -42,7 +43,12 @@ void NavigationViewItem::OnApplyTemplate()
 
     m_toolTip.set(GetTemplateChildT<winrt::ToolTip>(L"ToolTip"sv, controlProtected));
 
-    if (auto splitView = GetSplitView())
+    if (GetPaneState())
+    {
+        UpdateCompactPaneLength();
+        UpdateIsClosedCompact();
+    }
+    else if (auto splitView = GetSplitView())
     {
         m_splitViewIsPaneOpenChangedRevoker = RegisterPropertyChanged(splitView,
             winrt::SplitView::IsPaneOpenProperty(), { this, &NavigationViewItem::OnSplitViewPropertyChanged });
@@ -85,9 +91,49 @@ void NavigationViewItem::OnSplitViewPropertyChanged(const winrt::DependencyObjec
     }
 }
 
+void NavigationViewItem::OnPaneStateChanged()
+{
+    if (GetPaneState())
+    {
+        // The pane state shared by NavigationView replaces the listeners on the SplitView.
+        m_splitViewIsPaneOpenChangedRevoker.revoke();
+        m_splitViewDisplayModeChangedRevoker.revoke();
+        m_splitViewCompactPaneLengthChangedRevoker.revoke();
+
+        UpdateCompactPaneLength();
+        UpdateIsClosedCompact();
+    }
+}
+
+void NavigationViewItem::StartListeningForVisibilityChanges()
+{
+    if (!m_visibilityChangedRevoker)
+    {
+        m_visibilityChangedRevoker = RegisterPropertyChanged(*this,
+            winrt::UIElement::VisibilityProperty(), { this, &NavigationViewItem::OnVisibilityPropertyChanged });
+    }
+}
+
+void NavigationViewItem::StopListeningForVisibilityChanges()
+{
+    m_visibilityChangedRevoker.revoke();
+}
+
+void NavigationViewItem::OnVisibilityPropertyChanged(const winrt::DependencyObject& /*sender*/, const winrt::DependencyProperty& /*args*/)
+{
+    if (auto navigationViewList = GetNavigationViewList())
+    {
+        winrt::get_self<NavigationViewList>(navigationViewList)->InvalidateItemSetPositions();
+    }
+}
+
 void NavigationViewItem::UpdateCompactPaneLength()
 {
-    if (auto splitView = GetSplitView())
+    if (auto paneState = GetPaneState())
+    {
+        SetValue(s_CompactPaneLengthProperty, winrt::PropertyValue::CreateDouble(paneState->CompactPaneLength()));
+    }
+    else if (auto splitView = GetSplitView())
     {
         SetValue(s_CompactPaneLengthProperty, winrt::PropertyValue::CreateDouble(splitView.CompactPaneLength()));
     }
@@ -95,7 +141,12 @@ void NavigationViewItem::UpdateCompactPaneLength()
 
 void NavigationViewItem::UpdateIsClosedCompact()
 {
-    if (auto splitView = GetSplitView())
+    if (auto paneState = GetPaneState())
+    {
+        m_isClosedCompact = paneState->IsClosedCompact();
+        UpdateVisualState(true /*useTransitions*/);
+    }
+    else if (auto splitView = GetSplitView())
     {
         // Check if the pane is closed and if the splitview is in either compact mode.
         m_isClosedCompact = !splitView.IsPaneOpen() && (splitView.DisplayMode() == winrt::SplitViewDisplayMode::CompactOverlay || splitView.DisplayMode() == winrt::SplitViewDisplayMode::CompactInline);
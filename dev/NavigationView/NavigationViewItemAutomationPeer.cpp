@@ -7,6 +7,7 @@
 #include "NavigationViewItemAutomationPeer.h"
 #include "NavigationView.h"
 #include "NavigationViewItemBase.h"
+#include "NavigationViewList.h"
 
 
 CppWinRTActivatableClassWithBasicFactory(NavigationViewItemAutomationPeer);
@@ -63,55 +64,22 @@ winrt::IInspectable NavigationViewItemAutomationPeer::GetPatternCore(winrt::Patt
 
 int32_t NavigationViewItemAutomationPeer::GetPositionInSetCore()
 {
-    int32_t positionInSet = 0;
-
     if (IsSettingsItem())
     {
         return 1;
     }
 
-    if (IsOnTopNavigation())
-    {
-        if (auto navigationView = GetParentNavigationView())
-        {
-            auto topDataProvider = winrt::get_self<NavigationView>(navigationView)->GetTopDataProvider();
-            positionInSet = GetPositionOrSetCountInTopNavHelper(IsOnTopNavigationOverflow() 
-                ? topDataProvider.GetOverflowItems() : topDataProvider.GetPrimaryItems(), AutomationOutput::Position);
-        }
-    }
-    else
-    {
-        positionInSet = GetPositionOrSetCountInLeftNavHelper(AutomationOutput::Position);
-    }
-
-    return positionInSet;
+    return GetPositionOrSetCountHelper(AutomationOutput::Position);
 }
 
 int32_t NavigationViewItemAutomationPeer::GetSizeOfSetCore()
 {
-    int32_t sizeOfSet = 0;
-
     if (IsSettingsItem())
     {
         return 1;
     }
 
-    if (IsOnTopNavigation())
-    {
-        if (auto navview = GetParentNavigationView())
-        {
-            auto topNavDataProvider = winrt::get_self<NavigationView>(navview)->GetTopDataProvider();
-            sizeOfSet = GetPositionOrSetCountInTopNavHelper(IsOnTopNavigationOverflow() 
-                ? topNavDataProvider.GetOverflowItems() : topNavDataProvider.GetPrimaryItems(), AutomationOutput::Size);
-
-        }
-    }
-    else
-    {
-        sizeOfSet = GetPositionOrSetCountInLeftNavHelper(AutomationOutput::Size);
-    }
-
-    return sizeOfSet;
+    return GetPositionOrSetCountHelper(AutomationOutput::Size);
 }
 
 void NavigationViewItemAutomationPeer::Invoke()
@@ -173,139 +141,21 @@ bool NavigationViewItemAutomationPeer::IsSettingsItem()
     return false;
 }
 
-bool NavigationViewItemAutomationPeer::IsOnTopNavigation()
-{
-    return GetNavigationViewListPosition() != NavigationViewListPosition::LeftNav;
-}
-
-bool NavigationViewItemAutomationPeer::IsOnTopNavigationOverflow()
-{
-    return GetNavigationViewListPosition() == NavigationViewListPosition::TopOverflow;
-}
-
-NavigationViewListPosition NavigationViewItemAutomationPeer::GetNavigationViewListPosition()
-{
-    NavigationViewListPosition position = NavigationViewListPosition::LeftNav;
-    winrt::NavigationViewItemBase navigationViewItem = Owner().try_as<winrt::NavigationViewItemBase>();
-    if (navigationViewItem)
-    {
-        position = winrt::get_self<NavigationViewItemBase>(navigationViewItem)->Position();
-    }
-    return position;
-}
-
-// Get either the position or the size of the set for this particular item in the case of left nav. 
-// We go through all the items and then we determine if the listviewitem from the left listview can be a navigation view item header
-// or a navigation view item. If it's the former, we just reset the count. If it's the latter, we increment the counter.
-// In case of calculating the position, if this is the NavigationViewItemAutomationPeer we're iterating through we break the loop.
-int32_t NavigationViewItemAutomationPeer::GetPositionOrSetCountInLeftNavHelper(AutomationOutput automationOutput)
-{
-    int returnValue = 0;
-    
-    if (auto navview = GetParentNavigationView())
-    {
-        if (auto listview = winrt::get_self<NavigationView>(navview)->LeftNavListView())
-        {
-            if (auto parent = Navigate(winrt::AutomationNavigationDirection::Parent).try_as<winrt::AutomationPeer>())
-            {
-                if (auto children = parent.GetChildren())
-                {
-                    int index = 0;
-                    bool itemFound = false;
-
-                    for (auto const& child : children)
-                    {
-                        if (auto dependencyObject = listview.ContainerFromIndex(index))
-                        {
-                            if (dependencyObject.try_as<winrt::NavigationViewItemHeader>())
-                            {
-                                if (automationOutput == AutomationOutput::Size && itemFound)
-                                {
-                                    break;
-                                }
-                                else
-                                {
-                                    returnValue = 0;
-                                }
-                            }
-                            else if (auto navviewItem = dependencyObject.try_as<winrt::NavigationViewItem>())
-                            {
-                                if (navviewItem.Visibility() == winrt::Visibility::Visible)
-                                {
-                                    returnValue++;
-
-                                    if (child.try_as<winrt::NavigationViewItemAutomationPeer>() == static_cast<winrt::NavigationViewItemAutomationPeer>(*this))
-                                    {
-                                        if (automationOutput == AutomationOutput::Position)
-                                        {
-                                            break;
-                                        }
-                                        else
-                                        {
-                                            itemFound = true;
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                        index++;
-                    }
-                }
-            }
-        }
-    }
-
-    return returnValue;
-}
-
-// Get either the position or the size of the set for this particular item in the case of top nav (primary/overflow items). 
-// Basically, we do the same here as GetPositionOrSetCountInLeftNavHelper without dealing with the listview directly, because 
-// TopDataProvider provcides two methods: GetOverflowItems() and GetPrimaryItems(), so we can break the loop (in case of position) by 
-// comparing the value of the FrameworkElementAutomationPeer we can get from the item we're iterating through to this object.
-int32_t NavigationViewItemAutomationPeer::GetPositionOrSetCountInTopNavHelper(winrt::IVector<winrt::IInspectable> navigationViewElements, AutomationOutput automationOutput)
+// Get either the position or the size of the set for this particular item. This works the same for left nav, top nav
+// primary and top nav overflow since each of them is a NavigationViewList. The list keeps the header-delimited groups of
+// its items up to date, so this doesn't need to walk the siblings of the item.
+int32_t NavigationViewItemAutomationPeer::GetPositionOrSetCountHelper(AutomationOutput automationOutput)
 {
     int32_t returnValue = 0;
-    
-    if (auto navview = GetParentNavigationView())
-    {
-        bool itemFound = false;
 
-        for (auto const& child : navigationViewElements)
+    if (auto navigationViewItem = Owner().try_as<winrt::NavigationViewItemBase>())
+    {
+        if (auto navigationViewList = winrt::get_self<NavigationViewItemBase>(navigationViewItem)->GetNavigationViewList())
         {
-            if (auto childAsNavViewItem = navview.ContainerFromMenuItem(child))
-            {
-                if (child.try_as<winrt::NavigationViewItemHeader>())
-                {
-                    if (automationOutput == AutomationOutput::Size && itemFound)
-                    {
-                        break;
-                    }
-                    else
-                    {
-                        returnValue = 0;
-                    }
-                }
-                else if (auto navviewitem = childAsNavViewItem.try_as<winrt::NavigationViewItem>())
-                {
-                    if (navviewitem.Visibility() == winrt::Visibility::Visible)
-                    {
-                        returnValue++;
-
-                        if (winrt::FrameworkElementAutomationPeer::FromElement(navviewitem) == static_cast<winrt::NavigationViewItemAutomationPeer>(*this))
-                        {
-                            if (automationOutput == AutomationOutput::Position)
-                            {
-                                break;
-                            }
-                            else
-                            {
-                                itemFound = true;
-                            }
-                        }
-                    }
-                }
-
-            }
+            auto navigationViewListImpl = winrt::get_self<NavigationViewList>(navigationViewList);
+            returnValue = automationOutput == AutomationOutput::Position ?
+                navigationViewListImpl->GetPositionInSet(navigationViewItem) :
+                navigationViewListImpl->GetSizeOfSet(navigationViewItem);
         }
     }
 
@@ -36,12 +36,8 @@ private:
     };
 
     winrt::NavigationView GetParentNavigationView();
-    bool IsOnTopNavigation();
-    bool IsOnTopNavigationOverflow();
     bool IsSettingsItem();
-    NavigationViewListPosition GetNavigationViewListPosition();
     int32_t GetNavigationViewItemCountInPrimaryList();
     int32_t GetNavigationViewItemCountInTopNav();
-    int32_t GetPositionOrSetCountInLeftNavHelper(AutomationOutput automationOutput);
-    int32_t GetPositionOrSetCountInTopNavHelper(winrt::IVector<winrt::IInspectable> navigationViewElements, AutomationOutput automationOutput);
+    int32_t GetPositionOrSetCountHelper(AutomationOutput automationOutput);
 };
@@ -25,6 +25,14 @@ struct NavigationViewItemBaseFactory :
 
 CppWinRTActivatableClassWithFactory(NavigationViewItemBase, NavigationViewItemBaseFactory);
 
+NavigationViewItemBase::~NavigationViewItemBase()
+{
+    if (m_paneState)
+    {
+        m_paneState->RemoveObserver(this);
+    }
+}
+
 NavigationViewListPosition NavigationViewItemBase::Position()
 {
     return m_position;
@@ -41,6 +49,14 @@ void NavigationViewItemBase::Position(NavigationViewListPosition value)
 
 winrt::NavigationView NavigationViewItemBase::GetNavigationView()
 {
+    if (m_paneState)
+    {
+        if (auto navigationView = m_paneState->GetNavigationView())
+        {
+            return navigationView;
+        }
+    }
+
     //Because of Overflow popup, we can't get NavigationView by SharedHelpers::GetAncestorOfType
     winrt::NavigationView navigationView{ nullptr };
     auto navigationViewList = GetNavigationViewList();
@@ -69,6 +85,45 @@ winrt::SplitView NavigationViewItemBase::GetSplitView()
 
 winrt::NavigationViewList NavigationViewItemBase::GetNavigationViewList()
 {
+    if (auto navigationViewList = m_navigationViewList.get())
+    {
+        return navigationViewList;
+    }
+
     // Find parent NavigationViewList
     return SharedHelpers::GetAncestorOfType<winrt::NavigationViewList>(winrt::VisualTreeHelper::GetParent(*this));
 }
+
+void NavigationViewItemBase::SetPaneState(const std::shared_ptr<NavigationViewPaneState>& paneState, winrt::NavigationViewList const& navigationViewList)
+{
+    m_navigationViewList = nullptr;
+    if (navigationViewList)
+    {
+        m_navigationViewList = winrt::make_weak(navigationViewList);
+    }
+
+    if (m_paneState != paneState)
+    {
+        if (m_paneState)
+        {
+            m_paneState->RemoveObserver(this);
+        }
+
+        m_paneState = paneState;
+
+        if (m_paneState)
+        {
+            m_paneState->AddObserver(this);
+            OnPaneStateChanged();
+        }
+    }
+}
+
+void NavigationViewItemBase::ClearPaneState(winrt::NavigationViewList const& navigationViewList)
+{
+    // An item that is its own container can be prepared by the top nav overflow list before the primary list clears it.
+    if (m_navigationViewList.get() == navigationViewList)
+    {
+        SetPaneState(nullptr, nullptr);
+    }
+}
@@ -5,11 +5,14 @@
 
 #include "NavigationViewItemBase.g.h"
 #include "NavigationViewHelper.h"
+#include "NavigationViewPaneState.h"
 
 class NavigationViewItemBase :
     public ReferenceTracker<NavigationViewItemBase, winrt::implementation::NavigationViewItemBaseT, winrt::composable>
 {
 public:
+    ~NavigationViewItemBase();
+
     // Promote all overrides that our derived classes want into virtual so that our shim will call them.
     // IFrameworkElementOverrides
     virtual void OnApplyTemplate()
@@ -41,6 +44,7 @@ public:
     }
 
     virtual void OnNavigationViewListPositionChanged() {}
+    virtual void OnPaneStateChanged() {}
 
     NavigationViewListPosition Position();
     void Position(NavigationViewListPosition value);
@@ -49,6 +53,14 @@ public:
     winrt::SplitView GetSplitView();
     winrt::NavigationViewList GetNavigationViewList();
 
+    // Set when the item is prepared by a NavigationViewList (or is the settings item) and cleared when it's cleared.
+    void SetPaneState(const std::shared_ptr<NavigationViewPaneState>& paneState, winrt::NavigationViewList const& navigationViewList);
+    void ClearPaneState(winrt::NavigationViewList const& navigationViewList);
+    // Null until the pane state has been initialized, callers fall back to the SplitView in that case.
+    NavigationViewPaneState* GetPaneState() const { return m_paneState && m_paneState->IsInitialized() ? m_paneState.get() : nullptr; }
+
 private:
     NavigationViewListPosition m_position{ NavigationViewListPosition::LeftNav };
+    std::shared_ptr<NavigationViewPaneState> m_paneState{};
+    winrt::weak_ref<winrt::NavigationViewList> m_navigationViewList{ nullptr };
 };
@@ -15,7 +15,11 @@ NavigationViewItemHeader::NavigationViewItemHeader()
 
 void NavigationViewItemHeader::OnApplyTemplate()
 {
-    if (auto splitView = GetSplitView())
+    if (GetPaneState())
+    {
+        UpdateIsClosedCompact();
+    }
+    else if (auto splitView = GetSplitView())
     {
         m_splitViewIsPaneOpenChangedRevoker = RegisterPropertyChanged(splitView,
             winrt::SplitView::IsPaneOpenProperty(), { this, &NavigationViewItemHeader::OnSplitViewPropertyChanged });
@@ -40,9 +44,26 @@ void NavigationViewItemHeader::OnSplitViewPropertyChanged(const winrt::Dependenc
     }
 }
 
+void NavigationViewItemHeader::OnPaneStateChanged()
+{
+    if (GetPaneState())
+    {
+        // The pane state shared by NavigationView replaces the listeners on the SplitView.
+        m_splitViewIsPaneOpenChangedRevoker.revoke();
+        m_splitViewDisplayModeChangedRevoker.revoke();
+
+        UpdateIsClosedCompact();
+    }
+}
+
 void NavigationViewItemHeader::UpdateIsClosedCompact()
 {
-    if (auto splitView = GetSplitView())
+    if (auto paneState = GetPaneState())
+    {
+        m_isClosedCompact = paneState->IsClosedCompact();
+        UpdateVisualState(true /*useTransitions*/);
+    }
+    else if (auto splitView = GetSplitView())
     {
         // Check if the pane is closed and if the splitview is in either compact mode.
         m_isClosedCompact = !splitView.IsPaneOpen() && (splitView.DisplayMode() == winrt::SplitViewDisplayMode::CompactOverlay || splitView.DisplayMode() == winrt::SplitViewDisplayMode::CompactInline);
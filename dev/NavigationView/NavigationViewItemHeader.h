@@ -18,6 +18,7 @@ public:
     void OnApplyTemplate() override;
 
 private:
+    void OnPaneStateChanged() override;
     void OnSplitViewPropertyChanged(const winrt::DependencyObject& sender, const winrt::DependencyProperty& args);
     void UpdateIsClosedCompact();
 
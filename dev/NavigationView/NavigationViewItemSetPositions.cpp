@@ -0,0 +1,51 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "NavigationViewItemSetPositions.h"
+
+void NavigationViewItemSetPositions::Build(const std::vector<NavigationViewSetEntryKind>& entries)
+{
+    m_positions.assign(entries.size(), 0);
+    m_groupIndices.assign(entries.size(), 0);
+    m_groupSizes.clear();
+    m_groupSizes.push_back(0);
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        switch (entries[i])
+        {
+        case NavigationViewSetEntryKind::Header:
+            m_groupSizes.push_back(0);
+            break;
+        case NavigationViewSetEntryKind::Item:
+            m_positions[i] = ++m_groupSizes.back();
+            break;
+        default:
+            break;
+        }
+
+        m_groupIndices[i] = static_cast<int32_t>(m_groupSizes.size() - 1);
+    }
+}
+
+int32_t NavigationViewItemSetPositions::PositionInSet(int index) const
+{
+    if (index < 0 || index >= static_cast<int>(m_positions.size()))
+    {
+        return 0;
+    }
+
+    return m_positions[index];
+}
+
+int32_t NavigationViewItemSetPositions::SizeOfSet(int index) const
+{
+    if (PositionInSet(index) == 0)
+    {
+        return 0;
+    }
+
+    return m_groupSizes[m_groupIndices[index]];
+}
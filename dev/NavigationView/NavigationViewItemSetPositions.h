@@ -0,0 +1,36 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// The role an entry of a NavigationViewList plays when computing the automation
+// PositionInSet and SizeOfSet of its items.
+enum class NavigationViewSetEntryKind
+{
+    // A visible NavigationViewItem, counted in its group.
+    Item,
+    // A NavigationViewItemHeader, which starts a new group.
+    Header,
+    // Anything else (separators, collapsed items, unrealized containers), which is skipped.
+    Other,
+};
+
+// Splits the entries of a list into header-delimited groups and records, for every item,
+// its 1-based position within its group and the size of that group. Building is linear in
+// the number of entries and both lookups are constant time afterwards.
+class NavigationViewItemSetPositions
+{
+public:
+    void Build(const std::vector<NavigationViewSetEntryKind>& entries);
+
+    // Both return 0 for an index that is out of range or is not an item.
+    int32_t PositionInSet(int index) const;
+    int32_t SizeOfSet(int index) const;
+
+private:
+    // Per entry: the 1-based position within its group, or 0 when the entry is not an item.
+    std::vector<int32_t> m_positions;
+    // Per entry: the index into m_groupSizes of the group the entry belongs to.
+    std::vector<int32_t> m_groupIndices;
+    std::vector<int32_t> m_groupSizes;
+};
@@ -7,6 +7,7 @@
 #include "Utils.h"
 #include "NavigationViewList.h"
 #include "NavigationViewItem.h"
+#include "NavigationView.h"
 
 CppWinRTActivatableClassWithBasicFactory(NavigationViewList);
 
@@ -41,10 +42,17 @@ bool NavigationViewList::IsItemItsOwnContainerOverride(winrt::IInspectable const
 
 void NavigationViewList::ClearContainerForItemOverride(winrt::DependencyObject const& element, winrt::IInspectable const& item)
 {
+    if (auto itemContainer = element.try_as<winrt::NavigationViewItemBase>())
+    {
+        winrt::get_self<NavigationViewItemBase>(itemContainer)->ClearPaneState(*this);
+    }
     if (auto itemContainer = element.try_as<winrt::NavigationViewItem>())
     {
-        winrt::get_self<NavigationViewItem>(itemContainer)->ClearIsContentChangeHandlingDelayedForTopNavFlag();
+        auto itemContainerImpl = winrt::get_self<NavigationViewItem>(itemContainer);
+        itemContainerImpl->ClearIsContentChangeHandlingDelayedForTopNavFlag();
+        itemContainerImpl->StopListeningForVisibilityChanges();
     }
+    InvalidateItemSetPositions();
     __super::PrepareContainerForItemOverride(element, item);
 }
 
@@ -52,17 +60,28 @@ void NavigationViewList::PrepareContainerForItemOverride(winrt::DependencyObject
 {
     if (auto itemContainer = element.try_as<winrt::NavigationViewItemBase>())
     {
-        winrt::get_self<NavigationViewItemBase>(itemContainer)->Position(m_navigationViewListPosition);
+        auto itemContainerImpl = winrt::get_self<NavigationViewItemBase>(itemContainer);
+        itemContainerImpl->Position(m_navigationViewListPosition);
+        itemContainerImpl->SetPaneState(m_paneState, *this);
     }
     if (auto itemContainer = element.try_as<winrt::NavigationViewItem>())
     {
         itemContainer.UseSystemFocusVisuals(m_showFocusVisual);
-        winrt::get_self<NavigationViewItem>(itemContainer)->ClearIsContentChangeHandlingDelayedForTopNavFlag();
+        auto itemContainerImpl = winrt::get_self<NavigationViewItem>(itemContainer);
+        itemContainerImpl->ClearIsContentChangeHandlingDelayedForTopNavFlag();
+        itemContainerImpl->StartListeningForVisibilityChanges();
     }
+    InvalidateItemSetPositions();
 
     __super::PrepareContainerForItemOverride(element, item);
 }
 
+void NavigationViewList::OnItemsChanged(winrt::IInspectable const& e)
+{
+    InvalidateItemSetPositions();
+    __super::OnItemsChanged(e);
+}
+
 void NavigationViewList::SetNavigationViewListPosition(NavigationViewListPosition navigationViewListPosition)
 {
     m_navigationViewListPosition = navigationViewListPosition;
@@ -85,7 +104,18 @@ void NavigationViewList::SetShowFocusVisual(bool showFocus)
 
 void NavigationViewList::SetNavigationViewParent(winrt::NavigationView const& navigationView)
 {
-    m_navigationView = winrt::make_weak(navigationView);
+    auto paneState = winrt::get_self<NavigationView>(navigationView)->GetPaneState();
+    if (m_paneState != paneState)
+    {
+        m_paneState = paneState;
+
+        // Containers prepared before the list knew its NavigationView. This only happens once per template.
+        PropagateChangeToAllContainers<winrt::NavigationViewItemBase>(
+            [this](const winrt::NavigationViewItemBase& container)
+            {
+                winrt::get_self<NavigationViewItemBase>(container)->SetPaneState(m_paneState, *this);
+            });
+    }
 }
 
 // IControlOverrides
@@ -110,7 +140,7 @@ void NavigationViewList::OnKeyDown(winrt::KeyRoutedEventArgs const& eventArgs)
 
 winrt::NavigationView NavigationViewList::GetNavigationViewParent()
 {
-    return m_navigationView.get();
+    return m_paneState ? m_paneState->GetNavigationView() : nullptr;
 }
 
 winrt::NavigationViewItemBase NavigationViewList::GetLastItemCalledInIsItemItsOwnContainerOverride()
@@ -118,6 +148,62 @@ winrt::NavigationViewItemBase NavigationViewList::GetLastItemCalledInIsItemItsOw
     return m_lastItemCalledInIsItemItsOwnContainerOverride.get();
 }
 
+int32_t NavigationViewList::GetPositionInSet(winrt::DependencyObject const& container)
+{
+    EnsureItemSetPositions();
+    return m_itemSetPositions.PositionInSet(IndexFromContainer(container));
+}
+
+int32_t NavigationViewList::GetSizeOfSet(winrt::DependencyObject const& container)
+{
+    EnsureItemSetPositions();
+    return m_itemSetPositions.SizeOfSet(IndexFromContainer(container));
+}
+
+void NavigationViewList::InvalidateItemSetPositions()
+{
+    m_areItemSetPositionsValid = false;
+}
+
+// A header starts a new group and every visible NavigationViewItem is counted in the current one.
+// Separators, collapsed items and containers that are not realized are skipped.
+void NavigationViewList::EnsureItemSetPositions()
+{
+    if (m_areItemSetPositionsValid)
+    {
+        return;
+    }
+
+    std::vector<NavigationViewSetEntryKind> entries;
+    if (auto items = Items())
+    {
+        auto size = static_cast<int>(items.Size());
+        entries.reserve(size);
+        for (int i = 0; i < size; i++)
+        {
+            auto kind = NavigationViewSetEntryKind::Other;
+            if (auto container = ContainerFromIndex(i))
+            {
+                if (container.try_as<winrt::NavigationViewItemHeader>())
+                {
+                    kind = NavigationViewSetEntryKind::Header;
+                }
+                else if (auto navigationViewItem = container.try_as<winrt::NavigationViewItem>())
+                {
+                    if (navigationViewItem.Visibility() == winrt::Visibility::Visible)
+                    {
+                        kind = NavigationViewSetEntryKind::Item;
+                    }
+                }
+            }
+            entries.push_back(kind);
+        }
+    }
+
+    m_itemSetPositions.Build(entries);
+    m_areItemSetPositionsValid = true;
+}
+
 template<typename T> 
 void NavigationViewList::PropagateChangeToAllContainers(std::function<void(T& container)> function)
 {
@@ -3,6 +3,8 @@
 
 #pragma once
 #include "NavigationViewHelper.h"
+#include "NavigationViewItemSetPositions.h"
+#include "NavigationViewPaneState.h"
 #include "NavigationViewList.g.h"
 
 class NavigationViewList :
@@ -14,17 +16,24 @@ public:
     bool IsItemItsOwnContainerOverride(winrt::IInspectable const& item);
     void ClearContainerForItemOverride(winrt::DependencyObject const& element, winrt::IInspectable const& item);
     void PrepareContainerForItemOverride(winrt::DependencyObject const& element, winrt::IInspectable const& item);
+    void OnItemsChanged(winrt::IInspectable const& e);
 
     void SetNavigationViewListPosition(NavigationViewListPosition navigationViewListPosition);
     void SetShowFocusVisual(bool showFocus);
 
     // In overflow, NavigationViewItem can't reach to NavigationView from visual tree by iterating all parents since it's a popup.
-    // As a workaround, we make NavigationViewList keep a weakref of NavigationView.
+    // As a workaround, we make NavigationViewList keep the pane state of NavigationView, which holds a weakref of it, and hand
+    // it to every container it prepares.
     void SetNavigationViewParent(winrt::NavigationView const& navigationView);
     winrt::NavigationView GetNavigationViewParent();
 
     winrt::NavigationViewItemBase GetLastItemCalledInIsItemItsOwnContainerOverride();
 
+    // Automation PositionInSet/SizeOfSet of a container within its header-delimited group.
+    int32_t GetPositionInSet(winrt::DependencyObject const& container);
+    int32_t GetSizeOfSet(winrt::DependencyObject const& container);
+    void InvalidateItemSetPositions();
+
     // IControlOverrides / IControlOverridesHelper
     void OnKeyDown(winrt::KeyRoutedEventArgs const& e);
 
@@ -32,7 +41,12 @@ private:
     NavigationViewListPosition m_navigationViewListPosition{ NavigationViewListPosition::LeftNav };
     bool m_showFocusVisual{ true };
     template<typename T> void PropagateChangeToAllContainers(std::function<void(typename T& container)> function);
-    winrt::weak_ref<winrt::NavigationView> m_navigationView{ nullptr };
+    void EnsureItemSetPositions();
+    std::shared_ptr<NavigationViewPaneState> m_paneState{};
+
+    // Rebuilt lazily after the items, the realized containers or the visibility of an item change.
+    NavigationViewItemSetPositions m_itemSetPositions{};
+    bool m_areItemSetPositionsValid{ false };
 
     // For topnav, like alarm application, we may only need icon and no content for NavigationViewItem. 
     // ListView raise ItemClicked event, but it only provides the content and not the container.
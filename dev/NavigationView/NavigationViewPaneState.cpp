@@ -0,0 +1,37 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "NavigationViewPaneState.h"
+#include "NavigationViewItemBase.h"
+
+void NavigationViewPaneState::SetNavigationView(winrt::NavigationView const& navigationView)
+{
+    m_navigationView = winrt::make_weak(navigationView);
+}
+
+void NavigationViewPaneState::Update(bool isClosedCompact, double compactPaneLength)
+{
+    if (!m_isInitialized || m_isClosedCompact != isClosedCompact || m_compactPaneLength != compactPaneLength)
+    {
+        m_isInitialized = true;
+        m_isClosedCompact = isClosedCompact;
+        m_compactPaneLength = compactPaneLength;
+
+        for (auto observer : m_observers)
+        {
+            observer->OnPaneStateChanged();
+        }
+    }
+}
+
+void NavigationViewPaneState::AddObserver(NavigationViewItemBase* item)
+{
+    m_observers.insert(item);
+}
+
+void NavigationViewPaneState::RemoveObserver(NavigationViewItemBase* item)
+{
+    m_observers.erase(item);
+}
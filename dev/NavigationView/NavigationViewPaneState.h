@@ -0,0 +1,38 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include <unordered_set>
+
+class NavigationViewItemBase;
+
+// Pane state that a NavigationView shares with its settings item and with every container its
+// NavigationViewLists prepare. Containers get a reference to it once, when they are prepared, so
+// finding the owning NavigationView doesn't require walking the visual tree. NavigationView computes
+// the closed compact state once per SplitView change and each attached container is notified once.
+class NavigationViewPaneState
+{
+public:
+    winrt::NavigationView GetNavigationView() const { return m_navigationView.get(); }
+    void SetNavigationView(winrt::NavigationView const& navigationView);
+
+    // False until NavigationView has found its SplitView and computed the values below.
+    bool IsInitialized() const { return m_isInitialized; }
+    bool IsClosedCompact() const { return m_isClosedCompact; }
+    double CompactPaneLength() const { return m_compactPaneLength; }
+
+    // Notifies the attached containers if either value differs from the current one.
+    void Update(bool isClosedCompact, double compactPaneLength);
+
+    void AddObserver(NavigationViewItemBase* item);
+    void RemoveObserver(NavigationViewItemBase* item);
+
+private:
+    winrt::weak_ref<winrt::NavigationView> m_navigationView{ nullptr };
+    bool m_isInitialized{ false };
+    bool m_isClosedCompact{ false };
+    double m_compactPaneLength{ 0.0 };
+
+    std::unordered_set<NavigationViewItemBase*> m_observers;
+};
@@ -0,0 +1,38 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "NavigationViewTestApi.h"
+#include "NavigationViewIndicatorAnimations.h"
+
+void NavigationViewTestApi::ComputeIndicatorKeyFrames(
+    bool isTopNavigationView,
+    const winrt::Size& indicatorSize,
+    const winrt::Size& beginSize,
+    const winrt::Size& endSize,
+    float from,
+    float to,
+    float& positionStart,
+    float& positionEnd,
+    float& scaleStart,
+    float& scaleMiddle,
+    float& scaleEnd,
+    float& centerPointStart,
+    float& centerPointEnd)
+{
+    const NavigationViewIndicatorKeyFrames keyFrames{ isTopNavigationView, indicatorSize, beginSize, endSize, from, to };
+
+    positionStart = keyFrames.PositionStart();
+    positionEnd = keyFrames.PositionEnd();
+    scaleStart = keyFrames.ScaleStart();
+    scaleMiddle = keyFrames.ScaleMiddle();
+    scaleEnd = keyFrames.ScaleEnd();
+    centerPointStart = keyFrames.CenterPointStart();
+    centerPointEnd = keyFrames.CenterPointEnd();
+}
+
+int NavigationViewTestApi::GetCreatedIndicatorAnimationObjectCount()
+{
+    return NavigationViewIndicatorAnimations::CreatedAnimationObjectCount();
+}
@@ -0,0 +1,29 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "NavigationViewTestApi.g.h"
+
+class NavigationViewTestApi :
+    public winrt::implementation::NavigationViewTestApiT<NavigationViewTestApi>
+{
+public:
+    static void ComputeIndicatorKeyFrames(
+        bool isTopNavigationView,
+        const winrt::Size& indicatorSize,
+        const winrt::Size& beginSize,
+        const winrt::Size& endSize,
+        float from,
+        float to,
+        float& positionStart,
+        float& positionEnd,
+        float& scaleStart,
+        float& scaleMiddle,
+        float& scaleEnd,
+        float& centerPointStart,
+        float& centerPointEnd);
+    static int GetCreatedIndicatorAnimationObjectCount();
+};
+
+CppWinRTActivatableClassWithBasicFactory(NavigationViewTestApi);
\ No newline at end of file
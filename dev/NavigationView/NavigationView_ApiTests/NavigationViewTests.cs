@@ -5,7 +5,10 @@ using MUXControlsTestApp.Utilities;
 
 using Common;
 using System;
+using System.Diagnostics;
+using Windows.Foundation;
 using Windows.Foundation.Metadata;
+using Windows.UI.Xaml.Automation.Peers;
 using Windows.UI.Xaml.Controls;
 using Windows.UI.Xaml.Media;
 using Windows.UI.Xaml.Shapes;
@@ -23,7 +26,10 @@ using NavigationViewDisplayMode = Microsoft.UI.Xaml.Controls.NavigationViewDispl
 using NavigationViewPaneDisplayMode = Microsoft.UI.Xaml.Controls.NavigationViewPaneDisplayMode;
 using NavigationView = Microsoft.UI.Xaml.Controls.NavigationView;
 using NavigationViewItem = Microsoft.UI.Xaml.Controls.NavigationViewItem;
+using NavigationViewItemHeader = Microsoft.UI.Xaml.Controls.NavigationViewItemHeader;
+using NavigationViewItemSeparator = Microsoft.UI.Xaml.Controls.NavigationViewItemSeparator;
 using NavigationViewBackButtonVisible = Microsoft.UI.Xaml.Controls.NavigationViewBackButtonVisible;
+using NavigationViewTestApi = Microsoft.UI.Private.Controls.NavigationViewTestApi;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
 {
@@ -344,6 +350,167 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        public void VerifyItemsAccessibilitySetOnLeftNav()
+        {
+            VerifyItemsAccessibilitySet(NavigationViewPaneDisplayMode.Left);
+        }
+
+        [TestMethod]
+        public void VerifyItemsAccessibilitySetOnTopNav()
+        {
+            VerifyItemsAccessibilitySet(NavigationViewPaneDisplayMode.Top);
+        }
+
+        private void VerifyItemsAccessibilitySet(NavigationViewPaneDisplayMode paneDisplayMode)
+        {
+            if (!PlatformConfiguration.IsOsVersionGreaterThanOrEqual(OSVersion.Redstone3))
+            {
+                Log.Warning("AutomationPeer.GetPositionInSet and GetSizeOfSet are only available starting in RS3.");
+                return;
+            }
+
+            NavigationView navView = null;
+            NavigationViewItem itemA1 = null;
+            NavigationViewItem itemA2 = null;
+            NavigationViewItem itemA3 = null;
+            NavigationViewItem itemB1 = null;
+            NavigationViewItem itemB2 = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                navView = new NavigationView() { PaneDisplayMode = paneDisplayMode, IsSettingsVisible = false, Width = 1500.0 };
+
+                itemA1 = new NavigationViewItem() { Content = "A1" };
+                itemA2 = new NavigationViewItem() { Content = "A2", Visibility = Visibility.Collapsed };
+                itemA3 = new NavigationViewItem() { Content = "A3" };
+                itemB1 = new NavigationViewItem() { Content = "B1" };
+
+                navView.MenuItems.Add(new NavigationViewItemHeader() { Content = "Group A" });
+                navView.MenuItems.Add(itemA1);
+                navView.MenuItems.Add(itemA2);
+                navView.MenuItems.Add(new NavigationViewItemSeparator());
+                navView.MenuItems.Add(itemA3);
+                navView.MenuItems.Add(new NavigationViewItemHeader() { Content = "Group B" });
+                navView.MenuItems.Add(itemB1);
+
+                MUXControlsTestApp.App.TestContentRoot = navView;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment("Separators and collapsed items are not part of the set");
+                VerifyAccessibilitySet(itemA1, 1, 2);
+                VerifyAccessibilitySet(itemA3, 2, 2);
+
+                Log.Comment("Headers start a new set");
+                VerifyAccessibilitySet(itemB1, 1, 1);
+
+                Log.Comment("Make A2 visible");
+                itemA2.Visibility = Visibility.Visible;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                VerifyAccessibilitySet(itemA1, 1, 3);
+                VerifyAccessibilitySet(itemA2, 2, 3);
+                VerifyAccessibilitySet(itemA3, 3, 3);
+                VerifyAccessibilitySet(itemB1, 1, 1);
+
+                Log.Comment("Add an item to the second group and remove the first header");
+                itemB2 = new NavigationViewItem() { Content = "B2" };
+                navView.MenuItems.Add(itemB2);
+                navView.MenuItems.RemoveAt(0);
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                VerifyAccessibilitySet(itemA1, 1, 3);
+                VerifyAccessibilitySet(itemA3, 3, 3);
+                VerifyAccessibilitySet(itemB1, 1, 2);
+                VerifyAccessibilitySet(itemB2, 2, 2);
+
+                MUXControlsTestApp.App.TestContentRoot = null;
+            });
+        }
+
+        private void VerifyAccessibilitySet(NavigationViewItem item, int expectedPositionInSet, int expectedSizeOfSet)
+        {
+            var peer = FrameworkElementAutomationPeer.CreatePeerForElement(item);
+            Verify.AreEqual(expectedPositionInSet, peer.GetPositionInSet(), "Position in set of " + item.Content);
+            Verify.AreEqual(expectedSizeOfSet, peer.GetSizeOfSet(), "Size of set of " + item.Content);
+        }
+
+        [TestMethod]
+        public void VerifyPaneStateIsSharedWithMenuItems()
+        {
+            const int c_menuItemCount = 500;
+            const int c_toggleCount = 10;
+            NavigationView navView = null;
+            NavigationViewItem firstItem = null;
+            NavigationViewItem lastItem = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                navView = new NavigationView() { PaneDisplayMode = NavigationViewPaneDisplayMode.LeftCompact, IsPaneOpen = true, Width = 800.0, Height = 600.0 };
+                for (int i = 0; i < c_menuItemCount; i++)
+                {
+                    navView.MenuItems.Add(new NavigationViewItem() { Content = "Item " + i, Icon = new SymbolIcon(Symbol.Home) });
+                }
+                firstItem = (NavigationViewItem)navView.MenuItems[0];
+                lastItem = (NavigationViewItem)navView.MenuItems[c_menuItemCount - 1];
+
+                MUXControlsTestApp.App.TestContentRoot = navView;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                var stopwatch = Stopwatch.StartNew();
+                for (int toggle = 0; toggle < c_toggleCount; toggle++)
+                {
+                    navView.IsPaneOpen = !navView.IsPaneOpen;
+                    navView.UpdateLayout();
+                }
+                stopwatch.Stop();
+
+                Log.Comment(string.Format("{0} pane toggles with {1} menu items, average cost {2:F4}ms",
+                    c_toggleCount,
+                    c_menuItemCount,
+                    stopwatch.Elapsed.TotalMilliseconds / c_toggleCount));
+
+                Log.Comment("Changing CompactPaneLength reaches the realized menu items");
+                navView.CompactPaneLength = 60.0;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual(60.0, firstItem.CompactPaneLength);
+
+                Log.Comment("An item realized after the change picks up the current pane state when it is prepared");
+                navView.MenuItems.Remove(lastItem);
+                navView.MenuItems.Insert(1, lastItem);
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual(60.0, lastItem.CompactPaneLength);
+
+                MUXControlsTestApp.App.TestContentRoot = null;
+            });
+        }
+
         // Disabled per GitHub Issue #211
         //[TestMethod]
         public void VerifyCanNotAddWUXItems()
@@ -412,5 +579,119 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
                 root: headerContent,
                 masterFilePrefix: masterFilePrefix);
         }
+
+        [TestMethod]
+        public void VerifyIndicatorKeyFrames()
+        {
+            const double c_tolerance = 0.0001;
+            const int c_computationCount = 10000;
+            Size indicatorSize = new Size(40.0, 3.0);
+            Size[] itemSizes = { new Size(40.0, 3.0), new Size(64.0, 3.0), new Size(120.0, 3.0) };
+            float[] distances = { -200.0f, -40.0f, 40.0f, 200.0f };
+
+            RunOnUIThread.Execute(() =>
+            {
+                foreach (bool isTopNavigationView in new bool[] { false, true })
+                {
+                    foreach (Size beginSize in itemSizes)
+                    {
+                        foreach (Size endSize in itemSizes)
+                        {
+                            foreach (float distance in distances)
+                            {
+                                // The outgoing indicator moves from 0 to the distance, the incoming one from the opposite distance to 0.
+                                foreach (var fromTo in new float[][] { new float[] { 0.0f, distance }, new float[] { -distance, 0.0f } })
+                                {
+                                    float from = fromTo[0];
+                                    float to = fromTo[1];
+                                    float positionStart, positionEnd, scaleStart, scaleMiddle, scaleEnd, centerPointStart, centerPointEnd;
+
+                                    NavigationViewTestApi.ComputeIndicatorKeyFrames(
+                                        isTopNavigationView, indicatorSize, beginSize, endSize, from, to,
+                                        out positionStart, out positionEnd, out scaleStart, out scaleMiddle, out scaleEnd, out centerPointStart, out centerPointEnd);
+
+                                    float dimension = (float)(isTopNavigationView ? indicatorSize.Width : indicatorSize.Height);
+                                    float beginScale = isTopNavigationView ? (float)(beginSize.Width / indicatorSize.Width) : 1.0f;
+                                    float endScale = isTopNavigationView ? (float)(endSize.Width / indicatorSize.Width) : 1.0f;
+                                    string description = $"isTopNavigationView={isTopNavigationView}, beginSize={beginSize}, endSize={endSize}, from={from}, to={to}";
+
+                                    Verify.IsTrue(Math.Abs(positionStart - (from < to ? from : from + dimension * (beginScale - 1))) < c_tolerance, $"Position start, {description}");
+                                    Verify.IsTrue(Math.Abs(positionEnd - (from < to ? to + dimension * (endScale - 1) : to)) < c_tolerance, $"Position end, {description}");
+                                    Verify.IsTrue(Math.Abs(scaleStart - beginScale) < c_tolerance, $"Scale start, {description}");
+                                    Verify.IsTrue(Math.Abs(scaleMiddle - (Math.Abs(to - from) / dimension + (from < to ? endScale : beginScale))) < c_tolerance, $"Scale middle, {description}");
+                                    Verify.IsTrue(Math.Abs(scaleEnd - endScale) < c_tolerance, $"Scale end, {description}");
+                                    Verify.IsTrue(Math.Abs(centerPointStart - (from < to ? 0.0f : dimension)) < c_tolerance, $"Center point start, {description}");
+                                    Verify.IsTrue(Math.Abs(centerPointEnd - (from < to ? dimension : 0.0f)) < c_tolerance, $"Center point end, {description}");
+                                }
+                            }
+                        }
+                    }
+                }
+
+                var stopwatch = Stopwatch.StartNew();
+                for (int computation = 0; computation < c_computationCount; computation++)
+                {
+                    float positionStart, positionEnd, scaleStart, scaleMiddle, scaleEnd, centerPointStart, centerPointEnd;
+
+                    NavigationViewTestApi.ComputeIndicatorKeyFrames(
+                        true, indicatorSize, itemSizes[computation % itemSizes.Length], itemSizes[(computation + 1) % itemSizes.Length], 0.0f, computation % 200.0f,
+                        out positionStart, out positionEnd, out scaleStart, out scaleMiddle, out scaleEnd, out centerPointStart, out centerPointEnd);
+                }
+                stopwatch.Stop();
+                Log.Comment($"{c_computationCount} indicator key frame computations took {stopwatch.ElapsedMilliseconds}ms.");
+            });
+        }
+
+        [TestMethod]
+        public void VerifySelectionChangesReuseIndicatorAnimations()
+        {
+            var navView = SetupNavigationView(NavigationViewPaneDisplayMode.Top);
+            int createdAnimationObjectCount = 0;
+
+            RunOnUIThread.Execute(() =>
+            {
+                navView.SelectedItem = navView.MenuItems[0];
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                navView.SelectedItem = navView.MenuItems[1];
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                createdAnimationObjectCount = NavigationViewTestApi.GetCreatedIndicatorAnimationObjectCount();
+                Log.Comment($"Created indicator animation objects after the first selection change: {createdAnimationObjectCount}");
+
+                for (int selectionChange = 0; selectionChange < 10; selectionChange++)
+                {
+                    navView.SelectedItem = navView.MenuItems[selectionChange % 2];
+                }
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                navView.PaneDisplayMode = NavigationViewPaneDisplayMode.Left;
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                for (int selectionChange = 0; selectionChange < 10; selectionChange++)
+                {
+                    navView.SelectedItem = navView.MenuItems[selectionChange % 2];
+                }
+            });
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual(createdAnimationObjectCount, NavigationViewTestApi.GetCreatedIndicatorAnimationObjectCount(),
+                    "Selection changes in top and left navigation should reuse the indicator animations.");
+            });
+        }
     }
 }
\ No newline at end of file
@@ -7,6 +7,7 @@ using MUXControlsTestApp.Utilities;
 using System;
 using System.Collections.Generic;
 using System.Collections.ObjectModel;
+using System.Diagnostics;
 using System.Linq;
 using System.Threading;
 using Windows.Foundation;
@@ -37,6 +38,7 @@ using UniformGridLayout = Microsoft.UI.Xaml.Controls.UniformGridLayout;
 using ItemsRepeaterScrollHost = Microsoft.UI.Xaml.Controls.ItemsRepeaterScrollHost;
 using VirtualizingLayoutContext = Microsoft.UI.Xaml.Controls.VirtualizingLayoutContext;
 using LayoutPanel = Microsoft.UI.Xaml.Controls.LayoutPanel;
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
 {
@@ -1235,6 +1237,117 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateUniformGridLayoutScrollFrameCostWithLargeItemCount()
+        {
+            const int itemCount = 100000;
+            const int itemSize = 40;
+            const int spacing = 10;
+            const int frameCount = 60;
+
+            // UniformGridLayout computes positions in closed form. FlowLayout with fixed size items produces the
+            // same arrangement through the general line-walking path, which gives us a baseline for the frame cost.
+            var createLayouts = new Func<VirtualizingLayout[]>(() => new VirtualizingLayout[]
+            {
+                new UniformGridLayout { MinItemWidth = itemSize, MinItemHeight = itemSize, MinColumnSpacing = spacing, MinRowSpacing = spacing },
+                new FlowLayout { MinColumnSpacing = spacing, MinRowSpacing = spacing },
+            });
+
+            var layoutCount = 0;
+            RunOnUIThread.Execute(() => layoutCount = createLayouts().Length);
+
+            for (int layoutIndex = 0; layoutIndex < layoutCount; layoutIndex++)
+            {
+                ItemsRepeater repeater = null;
+                ScrollViewer scrollViewer = null;
+                var om = new OrientationBasedMeasures(ScrollOrientation.Vertical);
+
+                RunOnUIThread.Execute(() =>
+                {
+                    var layout = createLayouts()[layoutIndex];
+                    var elementFactory = new RecyclingElementFactoryDerived()
+                    {
+                        Templates = { { "key", GetDataTemplate(string.Format(@"<Border Width='{0}' Height='{0}'/>", itemSize)) } },
+                        RecyclePool = new RecyclePool(),
+                        ValidateElementIndices = false,
+                    };
+
+                    Content = CreateAndInitializeRepeater(om, Enumerable.Range(0, itemCount), layout, elementFactory, ref repeater, ref scrollViewer);
+                    Content.UpdateLayout();
+                });
+
+                IdleSynchronizer.Wait();
+
+                RunOnUIThread.Execute(() =>
+                {
+                    var stopwatch = Stopwatch.StartNew();
+                    for (int frame = 0; frame < frameCount; frame++)
+                    {
+                        scrollViewer.ChangeView(null, (frame + 1) * 3 * (itemSize + spacing), null, disableAnimation: true);
+                        Content.UpdateLayout();
+                    }
+                    stopwatch.Stop();
+
+                    Log.Comment(string.Format("{0}: {1} items, {2} scroll frames, average frame cost {3:F3}ms",
+                        repeater.Layout.GetType().Name,
+                        itemCount,
+                        frameCount,
+                        stopwatch.Elapsed.TotalMilliseconds / frameCount));
+                });
+
+                IdleSynchronizer.Wait();
+
+                RunOnUIThread.Execute(() =>
+                {
+                    // Every realized element has to be at its closed form position.
+                    int itemsPerLine = (int)(om.Minor(repeater.DesiredSize) / (itemSize + spacing));
+                    int realizedCount = 0;
+                    for (int i = 0; i < itemCount; i++)
+                    {
+                        var element = repeater.TryGetElement(i);
+                        if (element != null)
+                        {
+                            var expected = om.MinorMajorRect(
+                                (i % itemsPerLine) * (itemSize + spacing),
+                                (i / itemsPerLine) * (itemSize + spacing),
+                                itemSize,
+                                itemSize);
+                            Verify.AreEqual(expected, LayoutInformation.GetLayoutSlot((FrameworkElement)element));
+                            realizedCount++;
+                        }
+                    }
+
+                    Verify.IsGreaterThan(realizedCount, 0);
+                    Verify.IsLessThan(realizedCount, itemCount);
+                });
+            }
+        }
+
+        [TestMethod]
+        public void ValidateUniformGridLayoutIndexRangeInMajorWindow()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                // 10 items, 4 per line and 50px per line with spacing: lines [0, 50), [50, 100) and [100, 150).
+                int firstIndex, lastIndex;
+
+                Log.Comment("Window inside the extent.");
+                RepeaterTestHooks.GetUniformGridLayoutIndexRangeInMajorWindow(40, 10, 4, 10, 0, 60, out firstIndex, out lastIndex);
+                Verify.AreEqual(0, firstIndex);
+                Verify.AreEqual(7, lastIndex);
+
+                Log.Comment("Window starting exactly at the end of the extent.");
+                RepeaterTestHooks.GetUniformGridLayoutIndexRangeInMajorWindow(40, 10, 4, 10, 150, 200, out firstIndex, out lastIndex);
+                Verify.AreEqual(8, firstIndex);
+                Verify.AreEqual(9, lastIndex);
+
+                Log.Comment("Window past the end of the extent.");
+                RepeaterTestHooks.GetUniformGridLayoutIndexRangeInMajorWindow(40, 10, 4, 10, 151, 200, out firstIndex, out lastIndex);
+                Verify.AreEqual(-1, firstIndex);
+                Verify.AreEqual(-1, lastIndex);
+            });
+        }
+
         #region Private Helpers
 
         private enum LayoutChoice
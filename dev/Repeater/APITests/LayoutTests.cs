@@ -7,6 +7,7 @@ using MUXControlsTestApp.Utilities;
 using System;
 using System.Collections.Generic;
 using System.Collections.ObjectModel;
+using System.Diagnostics;
 using System.Linq;
 using System.Threading;
 using Windows.Foundation;
@@ -39,6 +40,8 @@ using VirtualizingLayoutContext = Microsoft.UI.Xaml.Controls.VirtualizingLayoutC
 using ElementRealizationOptions = Microsoft.UI.Xaml.Controls.ElementRealizationOptions;
 using LayoutContext = Microsoft.UI.Xaml.Controls.LayoutContext;
 using LayoutPanel = Microsoft.UI.Xaml.Controls.LayoutPanel;
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
+using FocusNavigationDirection = Windows.UI.Xaml.Input.FocusNavigationDirection;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
 {
@@ -192,6 +195,102 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateCachedLayoutPropertiesTrackEffectiveValue()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var stackLayout = new StackLayout();
+                var gridLayout = new UniformGridLayout();
+                var flowLayout = new FlowLayout();
+
+                Log.Comment("Default values");
+                Verify.AreEqual(0.0, stackLayout.Spacing);
+                Verify.AreEqual(Orientation.Horizontal, gridLayout.Orientation);
+                Verify.AreEqual(0.0, gridLayout.MinRowSpacing);
+                Verify.AreEqual(0.0, flowLayout.MinColumnSpacing);
+
+                Log.Comment("Values set through the property wrappers");
+                stackLayout.Spacing = 10;
+                gridLayout.Orientation = Orientation.Vertical;
+                gridLayout.MinRowSpacing = 5;
+                flowLayout.MinColumnSpacing = 7;
+                Verify.AreEqual(10.0, stackLayout.Spacing);
+                Verify.AreEqual(Orientation.Vertical, gridLayout.Orientation);
+                Verify.AreEqual(5.0, gridLayout.MinRowSpacing);
+                Verify.AreEqual(7.0, flowLayout.MinColumnSpacing);
+
+                Log.Comment("Values set through the dependency properties");
+                stackLayout.SetValue(StackLayout.SpacingProperty, 20.0);
+                gridLayout.SetValue(UniformGridLayout.MinColumnSpacingProperty, 3.0);
+                Verify.AreEqual(20.0, stackLayout.Spacing);
+                Verify.AreEqual(3.0, gridLayout.MinColumnSpacing);
+
+                Log.Comment("Cleared values fall back to the default");
+                stackLayout.ClearValue(StackLayout.SpacingProperty);
+                gridLayout.ClearValue(UniformGridLayout.OrientationProperty);
+                flowLayout.ClearValue(FlowLayout.MinColumnSpacingProperty);
+                Verify.AreEqual(0.0, stackLayout.Spacing);
+                Verify.AreEqual(Orientation.Horizontal, gridLayout.Orientation);
+                Verify.AreEqual(0.0, flowLayout.MinColumnSpacing);
+
+                Log.Comment("Layout picks up the cached spacing");
+                var repeater = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, 3),
+                    Layout = stackLayout,
+                    ItemTemplate = GetDataTemplate("<Button Content='{Binding}' Height='50' />"),
+                };
+
+                Content = repeater;
+                stackLayout.SetValue(StackLayout.SpacingProperty, 10.0);
+                Content.UpdateLayout();
+
+                for (int i = 0; i < 3; i++)
+                {
+                    var layoutBounds = LayoutInformation.GetLayoutSlot(repeater.TryGetElement(i));
+                    Verify.AreEqual(i * 60.0, layoutBounds.Y);
+                }
+            });
+        }
+
+        [TestMethod]
+        public void ValidateCachedLayoutPropertyGetterCost()
+        {
+            const int iterations = 100000;
+
+            RunOnUIThread.Execute(() =>
+            {
+                var gridLayout = new UniformGridLayout() { MinRowSpacing = 5, MinColumnSpacing = 5 };
+                double sum = 0;
+
+                // The property wrapper returns the cached field while GetValue goes through the
+                // property system and unboxes, which is what every getter did before caching.
+                var stopwatch = Stopwatch.StartNew();
+                for (int i = 0; i < iterations; i++)
+                {
+                    sum += gridLayout.MinRowSpacing;
+                }
+                stopwatch.Stop();
+                var cachedTime = stopwatch.Elapsed;
+
+                stopwatch.Restart();
+                for (int i = 0; i < iterations; i++)
+                {
+                    sum += (double)gridLayout.GetValue(UniformGridLayout.MinRowSpacingProperty);
+                }
+                stopwatch.Stop();
+                var propertySystemTime = stopwatch.Elapsed;
+
+                Log.Comment(string.Format("{0} reads: cached getter {1:F3}ms, GetValue {2:F3}ms",
+                    iterations,
+                    cachedTime.TotalMilliseconds,
+                    propertySystemTime.TotalMilliseconds));
+
+                Verify.AreEqual(iterations * 2 * 5.0, sum);
+            });
+        }
+
         private ItemsRepeaterScrollHost CreateAndInitializeRepeater(
            object itemsSource,
            VirtualizingLayout layout,
@@ -221,6 +320,45 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             };
         }
 
+        [TestMethod]
+        public void ValidateFlowLayoutNeighborIndex()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment("Stack: one item per line, vertical scrolling.");
+                Verify.AreEqual(6, RepeaterTestHooks.GetFlowLayoutNeighborIndex(5, 100, 1, FocusNavigationDirection.Down, true, 0));
+                Verify.AreEqual(4, RepeaterTestHooks.GetFlowLayoutNeighborIndex(5, 100, 1, FocusNavigationDirection.Up, true, 0));
+                Verify.AreEqual(-1, RepeaterTestHooks.GetFlowLayoutNeighborIndex(5, 100, 1, FocusNavigationDirection.Left, true, 0));
+                Verify.AreEqual(-1, RepeaterTestHooks.GetFlowLayoutNeighborIndex(0, 100, 1, FocusNavigationDirection.Up, true, 0));
+                Verify.AreEqual(-1, RepeaterTestHooks.GetFlowLayoutNeighborIndex(99, 100, 1, FocusNavigationDirection.Down, true, 0));
+
+                Log.Comment("Stack: page navigation moves by a page and stops at the ends.");
+                Verify.AreEqual(15, RepeaterTestHooks.GetFlowLayoutNeighborIndex(5, 100, 1, FocusNavigationDirection.Down, true, 10));
+                Verify.AreEqual(99, RepeaterTestHooks.GetFlowLayoutNeighborIndex(95, 100, 1, FocusNavigationDirection.Down, true, 10));
+                Verify.AreEqual(0, RepeaterTestHooks.GetFlowLayoutNeighborIndex(5, 100, 1, FocusNavigationDirection.Up, true, 10));
+                Verify.AreEqual(-1, RepeaterTestHooks.GetFlowLayoutNeighborIndex(99, 100, 1, FocusNavigationDirection.Down, true, 10));
+
+                Log.Comment("Stack: horizontal scrolling.");
+                Verify.AreEqual(6, RepeaterTestHooks.GetFlowLayoutNeighborIndex(5, 100, 1, FocusNavigationDirection.Right, false, 0));
+                Verify.AreEqual(-1, RepeaterTestHooks.GetFlowLayoutNeighborIndex(5, 100, 1, FocusNavigationDirection.Down, false, 0));
+
+                Log.Comment("Grid: 4 items per line, 10 items (last line has 2 items), vertical scrolling.");
+                Verify.AreEqual(6, RepeaterTestHooks.GetFlowLayoutNeighborIndex(5, 10, 4, FocusNavigationDirection.Right, true, 0));
+                Verify.AreEqual(4, RepeaterTestHooks.GetFlowLayoutNeighborIndex(5, 10, 4, FocusNavigationDirection.Left, true, 0));
+                Verify.AreEqual(-1, RepeaterTestHooks.GetFlowLayoutNeighborIndex(4, 10, 4, FocusNavigationDirection.Left, true, 0));
+                Verify.AreEqual(-1, RepeaterTestHooks.GetFlowLayoutNeighborIndex(9, 10, 4, FocusNavigationDirection.Right, true, 0));
+                Verify.AreEqual(9, RepeaterTestHooks.GetFlowLayoutNeighborIndex(5, 10, 4, FocusNavigationDirection.Down, true, 0));
+                Verify.AreEqual(9, RepeaterTestHooks.GetFlowLayoutNeighborIndex(7, 10, 4, FocusNavigationDirection.Down, true, 0));
+                Verify.AreEqual(3, RepeaterTestHooks.GetFlowLayoutNeighborIndex(7, 10, 4, FocusNavigationDirection.Up, true, 0));
+                Verify.AreEqual(-1, RepeaterTestHooks.GetFlowLayoutNeighborIndex(2, 10, 4, FocusNavigationDirection.Up, true, 0));
+                Verify.AreEqual(-1, RepeaterTestHooks.GetFlowLayoutNeighborIndex(5, 10, 4, FocusNavigationDirection.Right, true, 2));
+
+                Log.Comment("Invalid input.");
+                Verify.AreEqual(-1, RepeaterTestHooks.GetFlowLayoutNeighborIndex(10, 10, 4, FocusNavigationDirection.Up, true, 0));
+                Verify.AreEqual(-1, RepeaterTestHooks.GetFlowLayoutNeighborIndex(0, 10, 4, FocusNavigationDirection.Next, true, 0));
+            });
+        }
+
         private DataTemplate GetDataTemplate(string content)
         {
             return (DataTemplate)XamlReader.Load(
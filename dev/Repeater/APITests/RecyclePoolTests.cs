@@ -4,9 +4,11 @@
 using Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests.Common;
 using Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests.Common.Mocks;
 using MUXControlsTestApp.Utilities;
+using System;
 using System.Collections.ObjectModel;
 using System.Linq;
 using System.Runtime.InteropServices;
+using System.Threading;
 using Windows.UI.Xaml;
 using Windows.UI.Xaml.Controls;
 using Windows.UI.Xaml.Markup;
@@ -26,6 +28,7 @@ using ItemsRepeater = Microsoft.UI.Xaml.Controls.ItemsRepeater;
 using RecyclePool = Microsoft.UI.Xaml.Controls.RecyclePool;
 using StackLayout = Microsoft.UI.Xaml.Controls.StackLayout;
 using ItemsRepeaterScrollHost = Microsoft.UI.Xaml.Controls.ItemsRepeaterScrollHost;
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
 {
@@ -209,5 +212,86 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
                 Verify.IsNull(recycled2.Parent);
             });
         }
+
+        [TestMethod]
+        public void ValidatePrewarmingReducesElementLoadsDuringFirstScroll()
+        {
+            const int prewarmElementCount = 30;
+            int loadCountWithoutPrewarming = GetElementLoadCountDuringFirstScroll(prewarmElementCount: 0);
+            int loadCountWithPrewarming = GetElementLoadCountDuringFirstScroll(prewarmElementCount);
+
+            Log.Comment(string.Format("Templates loaded on demand: {0} without prewarming, {1} with prewarming",
+                loadCountWithoutPrewarming,
+                loadCountWithPrewarming));
+            Verify.IsGreaterThan(loadCountWithoutPrewarming, 0);
+            Verify.IsLessThan(loadCountWithPrewarming, loadCountWithoutPrewarming);
+        }
+
+        private int GetElementLoadCountDuringFirstScroll(int prewarmElementCount)
+        {
+            const int itemCount = 1000;
+            const int itemHeight = 50;
+            const int scrollFrameCount = 20;
+            ItemsRepeater repeater = null;
+            ScrollViewer scrollViewer = null;
+            DataTemplate itemTemplate = null;
+            int elementLoadCount = 0;
+            var prewarmCompleted = new ManualResetEvent(false);
+            Windows.Foundation.TypedEventHandler<object, object> buildTreeCompletedHandler = (sender, args) => prewarmCompleted.Set();
+
+            RunOnUIThread.Execute(() =>
+            {
+                // A new template per run so that the runs do not share a recycle pool.
+                itemTemplate = (DataTemplate)XamlReader.Load(
+                    @"<DataTemplate xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation'>
+                        <TextBlock Height='50' Text='{Binding}' />
+                    </DataTemplate>");
+                repeater = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, itemCount),
+                    ItemTemplate = itemTemplate,
+                    PrewarmElementCount = prewarmElementCount,
+                };
+                scrollViewer = new ScrollViewer() { Content = repeater };
+
+                if (prewarmElementCount > 0)
+                {
+                    RepeaterTestHooks.BuildTreeCompleted += buildTreeCompletedHandler;
+                }
+
+                Content = new ItemsRepeaterScrollHost()
+                {
+                    Width = 400,
+                    Height = 400,
+                    ScrollViewer = scrollViewer
+                };
+            });
+
+            IdleSynchronizer.Wait();
+
+            if (prewarmElementCount > 0)
+            {
+                Verify.IsTrue(prewarmCompleted.WaitOne(TimeSpan.FromMilliseconds(2000)), "Waiting for prewarming to complete");
+            }
+
+            RunOnUIThread.Execute(() =>
+            {
+                RepeaterTestHooks.BuildTreeCompleted -= buildTreeCompletedHandler;
+
+                var pool = RecyclePool.GetPoolInstance(itemTemplate);
+                Verify.IsGreaterThanOrEqual(pool != null ? pool.GetElementCount(string.Empty) : 0, prewarmElementCount);
+
+                RepeaterTestHooks.ResetElementLoadCount();
+                for (int frame = 0; frame < scrollFrameCount; frame++)
+                {
+                    scrollViewer.ChangeView(null, (frame + 1) * 2 * itemHeight, null, disableAnimation: true);
+                    Content.UpdateLayout();
+                }
+
+                elementLoadCount = RepeaterTestHooks.GetElementLoadCount();
+            });
+
+            return elementLoadCount;
+        }
     }
 }
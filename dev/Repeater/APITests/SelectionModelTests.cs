@@ -24,6 +24,7 @@ using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
 using SelectionModel = Microsoft.UI.Xaml.Controls.SelectionModel;
 using IndexPath = Microsoft.UI.Xaml.Controls.IndexPath;
 using SelectionModelSelectionChangedEventArgs = Microsoft.UI.Xaml.Controls.SelectionModelSelectionChangedEventArgs;
+using SelectionModelIndexRange = Microsoft.UI.Xaml.Controls.SelectionModelIndexRange;
 using SelectionModelChildrenRequestedEventArgs = Microsoft.UI.Xaml.Controls.SelectionModelChildrenRequestedEventArgs;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
@@ -855,6 +856,210 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateSelectionChangedDeltasSingleSelect()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var selectionModel = new SelectionModel() { SingleSelect = true };
+                selectionModel.Source = CreateNestedData(1 /* levels */ , 3 /* groupsAtLevel */, 4 /* countAtLeaf */);
+
+                ValidateSelectionChangedDeltas(selectionModel, "Select 1.1", () => selectionModel.Select(1, 1));
+                ValidateSelectionChangedDeltas(selectionModel, "Select 2.3", () => selectionModel.Select(2, 3));
+                ValidateSelectionChangedDeltas(selectionModel, "Select 2.3 again", () => selectionModel.Select(2, 3));
+                ValidateSelectionChangedDeltas(selectionModel, "SelectAt 0.0", () => selectionModel.SelectAt(Path(0, 0)));
+                ValidateSelectionChangedDeltas(selectionModel, "Select 1", () => selectionModel.Select(1));
+                ValidateSelectionChangedDeltas(selectionModel, "Deselect 1", () => selectionModel.Deselect(1));
+            });
+        }
+
+        [TestMethod]
+        public void ValidateSelectionChangedDeltasMultipleSelect()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var selectionModel = new SelectionModel();
+                selectionModel.Source = CreateNestedData(2 /* levels */ , 3 /* groupsAtLevel */, 4 /* countAtLeaf */);
+
+                ValidateSelectionChangedDeltas(selectionModel, "SelectAt 1.0.1", () => selectionModel.SelectAt(Path(1, 0, 1)));
+                ValidateSelectionChangedDeltas(selectionModel, "SelectAt 1.0.2", () => selectionModel.SelectAt(Path(1, 0, 2)));
+                ValidateSelectionChangedDeltas(selectionModel, "SelectAt 2.1.0", () => selectionModel.SelectAt(Path(2, 1, 0)));
+                ValidateSelectionChangedDeltas(selectionModel, "SelectAt 2.1.0 again", () => selectionModel.SelectAt(Path(2, 1, 0)));
+                ValidateSelectionChangedDeltas(selectionModel, "DeselectAt 1.0.1", () => selectionModel.DeselectAt(Path(1, 0, 1)));
+                ValidateSelectionChangedDeltas(selectionModel, "Select 0", () => selectionModel.Select(0));
+                ValidateSelectionChangedDeltas(selectionModel, "ClearSelection", () => selectionModel.ClearSelection());
+                ValidateSelectionChangedDeltas(selectionModel, "SelectAll", () => selectionModel.SelectAll());
+                ValidateSelectionChangedDeltas(selectionModel, "DeselectAt 0.2.3", () => selectionModel.DeselectAt(Path(0, 2, 3)));
+                ValidateSelectionChangedDeltas(selectionModel, "Switch to SingleSelect", () => selectionModel.SingleSelect = true);
+            });
+        }
+
+        [TestMethod]
+        public void ValidateSelectionChangedDeltasExtendedSelect()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var selectionModel = new SelectionModel();
+                selectionModel.Source = CreateNestedData(1 /* levels */ , 4 /* groupsAtLevel */, 5 /* countAtLeaf */);
+
+                selectionModel.SetAnchorIndex(0, 3);
+                ValidateSelectionChangedDeltas(selectionModel, "SelectRangeFromAnchor 2.1", () => selectionModel.SelectRangeFromAnchor(2, 1));
+                ValidateSelectionChangedDeltas(selectionModel, "SelectRangeFromAnchor 1.2", () => selectionModel.SelectRangeFromAnchor(1, 2));
+                selectionModel.SetAnchorIndex(1, 1);
+                ValidateSelectionChangedDeltas(selectionModel, "DeselectRangeFromAnchor 1.4", () => selectionModel.DeselectRangeFromAnchor(1, 4));
+                ValidateSelectionChangedDeltas(selectionModel, "SelectRange 0.0 - 1.2", () => selectionModel.SelectRange(Path(0, 0), Path(1, 2)));
+                ValidateSelectionChangedDeltas(selectionModel, "DeselectRange 0.4 - 3.1", () => selectionModel.DeselectRange(Path(0, 4), Path(3, 1)));
+                selectionModel.AnchorIndex = Path(3, 4);
+                ValidateSelectionChangedDeltas(selectionModel, "SelectRangeFromAnchorTo 2.2", () => selectionModel.SelectRangeFromAnchorTo(Path(2, 2)));
+            });
+        }
+
+        [TestMethod]
+        public void ValidateSelectionChangedDeltasAfterSourceCollectionChange()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new ObservableCollection<int>(Enumerable.Range(0, 10));
+                var selectionModel = new SelectionModel();
+                selectionModel.Source = data;
+                selectionModel.Select(3);
+
+                int selectionChangedRaisedCount = 0;
+                selectionModel.SelectionChanged += (sender, args) =>
+                {
+                    selectionChangedRaisedCount++;
+                    Log.Comment("Indices shifted, no delta is expected.");
+                    Verify.IsNull(args.AddedRanges);
+                    Verify.IsNull(args.RemovedRanges);
+                };
+
+                data.Insert(0, 100);
+                Verify.AreEqual(1, selectionChangedRaisedCount);
+                ValidateSelection(selectionModel, new List<IndexPath>() { Path(4) }, new List<IndexPath>() { Path() });
+            });
+        }
+
+        [TestMethod]
+        public void ValidatePropertyChangedEventIsRaisedOnlyForChangedValues()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var selectionModel = new SelectionModel();
+                selectionModel.Source = Enumerable.Range(0, 10).ToList();
+
+                var raisedProperties = new List<string>();
+                selectionModel.PropertyChanged += (sender, args) =>
+                {
+                    if (args.PropertyName != "AnchorIndex")
+                    {
+                        raisedProperties.Add(args.PropertyName);
+                    }
+                };
+
+                Log.Comment("Selecting 3 changes everything.");
+                selectionModel.Select(3);
+                VerifyRaisedProperties(raisedProperties, "SelectedIndex", "SelectedIndices", "SelectedItem", "SelectedItems");
+
+                Log.Comment("Selecting 5 does not change SelectedIndex/SelectedItem.");
+                raisedProperties.Clear();
+                selectionModel.Select(5);
+                VerifyRaisedProperties(raisedProperties, "SelectedIndices", "SelectedItems");
+
+                Log.Comment("Selecting 5 again does not change anything.");
+                raisedProperties.Clear();
+                var selectedIndices = selectionModel.SelectedIndices;
+                selectionModel.Select(5);
+                VerifyRaisedProperties(raisedProperties);
+                Verify.IsTrue(ReferenceEquals(selectedIndices, selectionModel.SelectedIndices), "SelectedIndices view is kept when nothing changed");
+
+                Log.Comment("Deselecting 3 makes 5 the SelectedIndex.");
+                raisedProperties.Clear();
+                selectionModel.Deselect(3);
+                VerifyRaisedProperties(raisedProperties, "SelectedIndex", "SelectedIndices", "SelectedItem", "SelectedItems");
+                Verify.AreEqual(0, Path(5).CompareTo(selectionModel.SelectedIndex));
+            });
+        }
+
+        [TestMethod]
+        public void ValidateSelectionChangedReportsRanges()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var selectionModel = new SelectionModel();
+                selectionModel.Source = Enumerable.Range(0, 100000).ToList();
+
+                IReadOnlyList<SelectionModelIndexRange> added = null;
+                IReadOnlyList<SelectionModelIndexRange> removed = null;
+                selectionModel.SelectionChanged += (sender, args) =>
+                {
+                    added = args.AddedRanges;
+                    removed = args.RemovedRanges;
+                };
+
+                Log.Comment("Selecting everything is reported as a single range.");
+                selectionModel.SelectAll();
+                Verify.AreEqual(1, added.Count);
+                Verify.AreEqual(0, added[0].ParentIndex.GetSize());
+                Verify.AreEqual(0, added[0].FirstIndex);
+                Verify.AreEqual(99999, added[0].LastIndex);
+                Verify.AreEqual(0, removed.Count);
+
+                Log.Comment("Deselecting the middle of it is reported as a single range too.");
+                selectionModel.SetAnchorIndex(10);
+                selectionModel.DeselectRangeFromAnchor(89999);
+                Verify.AreEqual(0, added.Count);
+                Verify.AreEqual(1, removed.Count);
+                Verify.AreEqual(10, removed[0].FirstIndex);
+                Verify.AreEqual(89999, removed[0].LastIndex);
+            });
+        }
+
+        [TestMethod]
+        public void ValidateSelectedIndexPropertyChangedWithNestedSelection()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var selectionModel = new SelectionModel();
+                selectionModel.Source = CreateNestedData(1 /* levels */ , 3 /* groupsAtLevel */, 4 /* countAtLeaf */);
+
+                var raisedProperties = new List<string>();
+                selectionModel.PropertyChanged += (sender, args) =>
+                {
+                    if (args.PropertyName == "SelectedIndex")
+                    {
+                        raisedProperties.Add(args.PropertyName);
+                    }
+                };
+
+                selectionModel.Select(0, 2);
+                VerifyRaisedProperties(raisedProperties, "SelectedIndex");
+                Verify.AreEqual(0, Path(0, 2).CompareTo(selectionModel.SelectedIndex));
+
+                Log.Comment("Selecting 2.0 comes after 0.2, SelectedIndex does not change.");
+                raisedProperties.Clear();
+                selectionModel.Select(2, 0);
+                VerifyRaisedProperties(raisedProperties);
+
+                Log.Comment("Indices at the root are listed before the ones of their groups, selecting 1 makes it the SelectedIndex.");
+                raisedProperties.Clear();
+                selectionModel.Select(1);
+                VerifyRaisedProperties(raisedProperties, "SelectedIndex");
+                Verify.AreEqual(0, Path(1).CompareTo(selectionModel.SelectedIndex));
+
+                Log.Comment("Deselecting 1 makes 0.2 the SelectedIndex again.");
+                raisedProperties.Clear();
+                selectionModel.Deselect(1);
+                VerifyRaisedProperties(raisedProperties, "SelectedIndex");
+                Verify.AreEqual(0, Path(0, 2).CompareTo(selectionModel.SelectedIndex));
+
+                Log.Comment("Deselecting 0.2 makes 2.0 the SelectedIndex.");
+                raisedProperties.Clear();
+                selectionModel.Deselect(0, 2);
+                VerifyRaisedProperties(raisedProperties, "SelectedIndex");
+                Verify.AreEqual(0, Path(2, 0).CompareTo(selectionModel.SelectedIndex));
+            });
+        }
+
         [TestMethod]
         public void CanExtendSelectionModelINPC()
         {
@@ -995,6 +1200,65 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             manager.AnchorIndex = index;
         }
 
+        private void ValidateSelectionChangedDeltas(SelectionModel selectionModel, string operationName, Action operation)
+        {
+            Log.Comment("Validating SelectionChanged deltas for " + operationName);
+            var before = selectionModel.SelectedIndices.ToList();
+            var added = new List<IndexPath>();
+            var removed = new List<IndexPath>();
+            int selectionChangedRaisedCount = 0;
+            Windows.Foundation.TypedEventHandler<SelectionModel, SelectionModelSelectionChangedEventArgs> handler = (sender, args) =>
+            {
+                selectionChangedRaisedCount++;
+                added.AddRange(ExpandRanges(args.AddedRanges));
+                removed.AddRange(ExpandRanges(args.RemovedRanges));
+            };
+
+            selectionModel.SelectionChanged += handler;
+            operation();
+            selectionModel.SelectionChanged -= handler;
+
+            var after = selectionModel.SelectedIndices.ToList();
+            Verify.AreEqual(1, selectionChangedRaisedCount, "SelectionChanged raised once");
+            VerifySameIndices(after.Where(index => !Contains(before, index)).ToList(), added, "AddedRanges");
+            VerifySameIndices(before.Where(index => !Contains(after, index)).ToList(), removed, "RemovedRanges");
+        }
+
+        private List<IndexPath> ExpandRanges(IReadOnlyList<SelectionModelIndexRange> ranges)
+        {
+            var indices = new List<IndexPath>();
+            foreach (var range in ranges)
+            {
+                var parent = Enumerable.Range(0, range.ParentIndex.GetSize()).Select(i => range.ParentIndex.GetAt(i));
+                for (int index = range.FirstIndex; index <= range.LastIndex; index++)
+                {
+                    indices.Add(Path(parent.Concat(new[] { index }).ToArray()));
+                }
+            }
+
+            return indices;
+        }
+
+        private void VerifySameIndices(List<IndexPath> expected, List<IndexPath> actual, string name)
+        {
+            Log.Comment(name + ": " + string.Join(", ", actual.Select(index => index.ToString())));
+            Verify.AreEqual(expected.Count, actual.Count, name + " count");
+            foreach (var index in expected)
+            {
+                Verify.IsTrue(Contains(actual, index), name + " contains " + index);
+            }
+        }
+
+        private void VerifyRaisedProperties(List<string> raisedProperties, params string[] expectedProperties)
+        {
+            Log.Comment("Raised: " + string.Join(", ", raisedProperties));
+            Verify.AreEqual(expectedProperties.Length, raisedProperties.Count);
+            foreach (var property in expectedProperties)
+            {
+                Verify.IsTrue(raisedProperties.Contains(property), property + " was raised");
+            }
+        }
+
         private void ValidateSelection(
             SelectionModel selectionModel,
             List<IndexPath> expectedSelected,
@@ -50,6 +50,7 @@ using IRepeaterScrollingSurface = Microsoft.UI.Private.Controls.IRepeaterScrolli
 using ConfigurationChangedEventHandler = Microsoft.UI.Private.Controls.ConfigurationChangedEventHandler;
 using PostArrangeEventHandler = Microsoft.UI.Private.Controls.PostArrangeEventHandler;
 using ViewportChangedEventHandler = Microsoft.UI.Private.Controls.ViewportChangedEventHandler;
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
 
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
@@ -586,6 +587,84 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void NestedRepeatersShareCacheBuildBudget()
+        {
+            if (!PlatformConfiguration.IsOsVersionGreaterThanOrEqual(OSVersion.Redstone5))
+            {
+                Log.Warning("Skipping NestedRepeatersShareCacheBuildBudget because nested repeaters only share their cache buffer when using EffectiveViewport.");
+                return;
+            }
+
+            const int groupCount = 50;
+            const int itemsPerGroup = 10;
+            ItemsRepeater repeater = null;
+            var innerRepeaters = new HashSet<ItemsRepeater>();
+            var realizedItemCount = 0;
+
+            RunOnUIThread.Execute(() =>
+            {
+                var root = (Grid)XamlReader.Load(TestUtilities.ProcessTestXamlForRepo(
+                     @"<Grid xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation' xmlns:x='http://schemas.microsoft.com/winfx/2006/xaml' xmlns:controls='using:Microsoft.UI.Xaml.Controls'> 
+                         <Grid.Resources>
+                           <DataTemplate x:Key='ItemTemplate'>
+                             <Border Height='50' Background='LightGray'>
+                               <TextBlock Text='{Binding}' />
+                             </Border>
+                           </DataTemplate>
+                           <DataTemplate x:Key='GroupTemplate'>
+                             <StackPanel>
+                               <TextBlock Text='{Binding Name}' />
+                               <controls:ItemsRepeater ItemsSource='{Binding}' ItemTemplate='{StaticResource ItemTemplate}' />
+                             </StackPanel>
+                           </DataTemplate>
+                         </Grid.Resources>
+                         <controls:Scroller x:Name='Scroller' Width='400' Height='600' IsChildAvailableWidthConstrained='True'>
+                           <controls:ItemsRepeater x:Name='ItemsRepeater' ItemTemplate='{StaticResource GroupTemplate}' />
+                         </controls:Scroller>
+                       </Grid>"));
+
+                repeater = (ItemsRepeater)root.FindName("ItemsRepeater");
+                repeater.ItemsSource = Enumerable.Range(0, groupCount).Select(i => new NamedGroup<string>(
+                    "Group #" + i,
+                    Enumerable.Range(0, itemsPerGroup).Select(j => string.Format("Item #{0}.{1}", i, j)))).ToList();
+
+                repeater.ElementPrepared += (sender, args) =>
+                {
+                    var innerRepeater = (ItemsRepeater)((StackPanel)args.Element).Children[1];
+                    if (innerRepeaters.Add(innerRepeater))
+                    {
+                        innerRepeater.ElementPrepared += delegate { ++realizedItemCount; };
+                        innerRepeater.ElementClearing += delegate { --realizedItemCount; };
+                    }
+                };
+
+                RepeaterTestHooks.ResetCacheBuildActionCount();
+                Content = root;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                var cacheBuildActionCount = RepeaterTestHooks.GetCacheBuildActionCount();
+                Log.Comment("Realized group count: " + repeater.Children.Count);
+                Log.Comment("Realized item count: " + realizedItemCount);
+                Log.Comment("Cache build action count: " + cacheBuildActionCount);
+
+                // The outer repeater grows its cache buffer by 40 pixels per side until it reaches
+                // VerticalCacheLength (2) times its viewport. Inner repeaters don't build a cache of their own.
+                var maxCacheBufferPerSide = repeater.VerticalCacheLength * 600 / 2;
+                var expectedMaxCacheBuildActionCount = (int)Math.Ceiling(maxCacheBufferPerSide / 40) + 2;
+                Verify.IsLessThanOrEqual(cacheBuildActionCount, expectedMaxCacheBuildActionCount);
+
+                // The inner repeaters only realize the items that are in the outer repeater's realization window.
+                var realizationWindowHeight = 600 + 2 * maxCacheBufferPerSide;
+                var maxRealizedItemCount = (int)Math.Ceiling(realizationWindowHeight / 50) + 2 * repeater.Children.Count;
+                Verify.IsLessThanOrEqual(realizedItemCount, maxRealizedItemCount);
+            });
+        }
+
         [TestMethod]
         public void CanRegisterElementsWithScrollingSurfaces()
         {
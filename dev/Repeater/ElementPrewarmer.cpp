@@ -0,0 +1,145 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "ItemsRepeater.common.h"
+#include "QPCTimer.h"
+#include "BuildTreeScheduler.h"
+#include "ItemsRepeater.h"
+#include "ItemTemplateWrapper.h"
+#include "RecyclePool.h"
+#include "ElementPrewarmer.h"
+
+ElementPrewarmer::ElementPrewarmer(ItemsRepeater* owner) :
+    m_owner(owner)
+{
+    // ItemsRepeater is not fully constructed yet. Don't interact with it.
+}
+
+void ElementPrewarmer::Start()
+{
+    m_targets.clear();
+
+    const int elementCount = m_owner->PrewarmElementCount();
+    if (elementCount > 0)
+    {
+        const auto itemTemplate = m_owner->ItemTemplate();
+        if (auto dataTemplate = itemTemplate.try_as<winrt::DataTemplate>())
+        {
+            AddTarget(dataTemplate, ItemTemplateWrapper::EnsureRecyclePool(dataTemplate), L"" /* key */, false /* isKeyedTemplate */, elementCount);
+        }
+        else if (auto factory = itemTemplate.try_as<winrt::RecyclingElementFactory>())
+        {
+            const auto recyclePool = factory.RecyclePool();
+            const auto templates = factory.Templates();
+            if (recyclePool && templates)
+            {
+                for (const auto& keyTemplatePair : templates)
+                {
+                    AddTarget(keyTemplatePair.Value(), recyclePool, keyTemplatePair.Key(), true /* isKeyedTemplate */, elementCount);
+                }
+            }
+        }
+    }
+
+    if (!m_targets.empty())
+    {
+        m_lastVisibleWindow = m_owner->VisibleWindow();
+        RegisterForCallback();
+    }
+}
+
+void ElementPrewarmer::Stop()
+{
+    // A pending callback finds nothing to do and does not register again.
+    m_targets.clear();
+}
+
+void ElementPrewarmer::AddTarget(
+    const winrt::DataTemplate& dataTemplate,
+    const winrt::RecyclePool& recyclePool,
+    const winrt::hstring& key,
+    bool isKeyedTemplate,
+    int elementCount)
+{
+    if (dataTemplate)
+    {
+        const int remainingCount = elementCount - recyclePool.GetElementCount(key);
+        if (remainingCount > 0)
+        {
+            m_targets.emplace_back(dataTemplate, recyclePool, key, isKeyedTemplate, remainingCount);
+        }
+    }
+}
+
+void ElementPrewarmer::CreateElement(PrewarmTarget& target)
+{
+    const auto element = target.m_dataTemplate.LoadContent().as<winrt::UIElement>();
+
+    if (target.m_isKeyedTemplate)
+    {
+        RecyclePool::SetReuseKey(element, target.m_key);
+    }
+    else
+    {
+        element.SetValue(RecyclePool::GetOriginTemplateProperty(), target.m_dataTemplate);
+    }
+
+    // Elements are put without owner so that any repeater sharing the pool can pick them up
+    // without a reparenting cost.
+    target.m_recyclePool.PutElement(element, target.m_key);
+    --target.m_remainingCount;
+}
+
+void ElementPrewarmer::DoPrewarmWorkCallback()
+{
+    m_registeredForCallback = false;
+
+    if (m_targets.empty())
+    {
+        return;
+    }
+
+    const auto visibleWindow = m_owner->VisibleWindow();
+    if (visibleWindow != m_lastVisibleWindow)
+    {
+        // The view moved since the last tick, most likely because the user is scrolling or zooming.
+        // Creating elements now would delay the ones coming into view, so wait for the view to settle.
+        m_lastVisibleWindow = visibleWindow;
+    }
+    else if (!BuildTreeScheduler::ShouldYield())
+    {
+        do
+        {
+            auto& target = m_targets.back();
+            CreateElement(target);
+            if (target.m_remainingCount == 0)
+            {
+                m_targets.pop_back();
+            }
+        } while (!m_targets.empty() && !BuildTreeScheduler::ShouldYield());
+    }
+
+    if (!m_targets.empty())
+    {
+        RegisterForCallback();
+    }
+}
+
+void ElementPrewarmer::RegisterForCallback()
+{
+    if (!m_registeredForCallback)
+    {
+        m_registeredForCallback = true;
+        BuildTreeScheduler::RegisterWork(
+            s_prewarmWorkPriority,
+            [weakOwner = m_owner->get_weak()]()
+        {
+            if (auto owner = weakOwner.get())
+            {
+                owner->ElementPrewarmer().DoPrewarmWorkCallback();
+            }
+        });
+    }
+}
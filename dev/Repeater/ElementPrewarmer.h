@@ -0,0 +1,54 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+class ItemsRepeater;
+
+// Internal component that fills the recycle pools of the ItemsRepeater's templates
+// with PrewarmElementCount elements per template once the repeater is loaded. Elements are
+// created in BuildTreeScheduler's spare budget and creation pauses while the view is moving,
+// so that prewarming never competes with the elements the user is about to see.
+// Only DataTemplate and RecyclingElementFactory item templates can be prewarmed since the
+// templates of a DataTemplateSelector or of a custom IElementFactory are not known upfront.
+class ElementPrewarmer final
+{
+public:
+    ElementPrewarmer(ItemsRepeater* owner);
+
+    void Start();
+    void Stop();
+
+private:
+    struct PrewarmTarget
+    {
+        PrewarmTarget(const winrt::DataTemplate& dataTemplate, const winrt::RecyclePool& recyclePool, const winrt::hstring& key, bool isKeyedTemplate, int remainingCount) :
+            m_dataTemplate(dataTemplate),
+            m_recyclePool(recyclePool),
+            m_key(key),
+            m_isKeyedTemplate(isKeyedTemplate),
+            m_remainingCount(remainingCount)
+        {}
+
+        winrt::DataTemplate m_dataTemplate{ nullptr };
+        winrt::RecyclePool m_recyclePool{ nullptr };
+        winrt::hstring m_key{};
+        // True for RecyclingElementFactory templates, which identify their elements by ReuseKey
+        // rather than by origin template.
+        bool m_isKeyedTemplate{ false };
+        int m_remainingCount{};
+    };
+
+    void AddTarget(const winrt::DataTemplate& dataTemplate, const winrt::RecyclePool& recyclePool, const winrt::hstring& key, bool isKeyedTemplate, int elementCount);
+    void CreateElement(PrewarmTarget& target);
+    void DoPrewarmWorkCallback();
+    void RegisterForCallback();
+
+    // Lowest priority so that phasing and any other scheduled work goes first.
+    static constexpr int s_prewarmWorkPriority = std::numeric_limits<int>::max();
+
+    ItemsRepeater* m_owner{ nullptr };
+    std::vector<PrewarmTarget> m_targets{};
+    winrt::Rect m_lastVisibleWindow{};
+    bool m_registeredForCallback{ false };
+};
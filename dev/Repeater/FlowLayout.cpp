@@ -374,14 +374,6 @@ void FlowLayout::OnPropertyChanged(const winrt::DependencyPropertyChangedEventAr
         ScrollOrientation scrollOrientation = (orientation == winrt::Orientation::Horizontal) ? ScrollOrientation::Vertical : ScrollOrientation::Horizontal;
         OrientationBasedMeasures::SetScrollOrientation(scrollOrientation);
     }
-    else if (property == s_MinColumnSpacingProperty)
-    {
-        m_minColumnSpacing = unbox_value<double>(args.NewValue());
-    }
-    else if (property == s_MinRowSpacingProperty)
-    {
-        m_minRowSpacing = unbox_value<double>(args.NewValue());
-    }
     else if (property == s_LineAlignmentProperty)
     {
         m_lineAlignment = unbox_value<winrt::FlowLayoutLineAlignment>(args.NewValue());
@@ -145,17 +145,15 @@ private:
 
     double LineSpacing()
     {
-        return ScrollOrientation() == ScrollOrientation::Vertical ? m_minColumnSpacing : m_minRowSpacing;
+        return ScrollOrientation() == ScrollOrientation::Vertical ? MinColumnSpacing() : MinRowSpacing();
     }
 
     double MinItemSpacing()
     {
-        return ScrollOrientation() == ScrollOrientation::Vertical ? m_minRowSpacing : m_minColumnSpacing;
+        return ScrollOrientation() == ScrollOrientation::Vertical ? MinRowSpacing() : MinColumnSpacing();
     }
 
     // Fields
-    double m_minRowSpacing{};
-    double m_minColumnSpacing{};
     winrt::FlowLayoutLineAlignment m_lineAlignment{ winrt::FlowLayoutLineAlignment::Start };
 
     // !!! WARNING !!!
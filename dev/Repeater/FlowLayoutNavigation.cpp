@@ -0,0 +1,74 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <pch.h>
+#include "FlowLayoutNavigation.h"
+
+/* static */
+int FlowLayoutNavigation::GetNeighborIndex(
+    int index,
+    int itemCount,
+    int itemsPerLine,
+    winrt::FocusNavigationDirection direction,
+    bool isVerticalScrolling,
+    int linesPerPage)
+{
+    if (index < 0 || index >= itemCount || itemsPerLine < 1)
+    {
+        return -1;
+    }
+
+    const bool isUpOrDown = direction == winrt::FocusNavigationDirection::Up || direction == winrt::FocusNavigationDirection::Down;
+    const bool isLeftOrRight = direction == winrt::FocusNavigationDirection::Left || direction == winrt::FocusNavigationDirection::Right;
+    if (!isUpOrDown && !isLeftOrRight)
+    {
+        return -1;
+    }
+
+    const int step = (direction == winrt::FocusNavigationDirection::Up || direction == winrt::FocusNavigationDirection::Left) ? -1 : 1;
+    const bool isMajorNavigation = isUpOrDown == isVerticalScrolling;
+    const int minorDelta = isMajorNavigation ? 0 : step;
+    const int majorDelta = isMajorNavigation ? step : 0;
+
+    const int line = index / itemsPerLine;
+    const int indexInLine = index - line * itemsPerLine;
+
+    if (minorDelta != 0)
+    {
+        // Moving within the line. Page navigation only applies to the scrolling direction.
+        const int targetIndexInLine = indexInLine + minorDelta;
+        const int targetIndex = line * itemsPerLine + targetIndexInLine;
+        if (linesPerPage > 0 || targetIndexInLine < 0 || targetIndexInLine >= itemsPerLine || targetIndex >= itemCount)
+        {
+            return -1;
+        }
+
+        return targetIndex;
+    }
+
+    const int lineCount = (itemCount + itemsPerLine - 1) / itemsPerLine;
+    int targetLine = line + majorDelta * std::max(1, linesPerPage);
+    if (linesPerPage > 0)
+    {
+        targetLine = std::max(0, std::min(lineCount - 1, targetLine));
+    }
+
+    if (targetLine < 0 || targetLine >= lineCount || targetLine == line)
+    {
+        return -1;
+    }
+
+    // The last line may be shorter than the others, in which case we go to its last item.
+    return std::min(itemCount - 1, targetLine * itemsPerLine + indexInLine);
+}
+
+/* static */
+int FlowLayoutNavigation::GetLinesPerPage(double viewportMajorSize, double lineMajorSizeWithSpacing)
+{
+    if (lineMajorSizeWithSpacing <= 0 || !std::isfinite(viewportMajorSize))
+    {
+        return 1;
+    }
+
+    return std::max(1, static_cast<int>(viewportMajorSize / lineMajorSizeWithSpacing));
+}
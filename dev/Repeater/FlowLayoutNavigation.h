@@ -0,0 +1,26 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Directional navigation over the items of a line-based layout (StackLayout is a layout with
+// one item per line, UniformGridLayout has ItemsPerLine items per line). The neighbour of an
+// item is computed from its index alone, so it does not need the elements in between to be
+// realized and does not depend on any XAML object.
+class FlowLayoutNavigation
+{
+public:
+    // Returns the index of the item reached when navigating from index in the given direction, or -1
+    // if navigation leaves the collection or the line the item is in. When linesPerPage is positive,
+    // this is page navigation: we move by that many lines and stop at the first or last line.
+    static int GetNeighborIndex(
+        int index,
+        int itemCount,
+        int itemsPerLine,
+        winrt::FocusNavigationDirection direction,
+        bool isVerticalScrolling,
+        int linesPerPage);
+
+    // Returns the number of whole lines that fit in a viewport, and at least one.
+    static int GetLinesPerPage(double viewportMajorSize, double lineMajorSizeWithSpacing);
+};
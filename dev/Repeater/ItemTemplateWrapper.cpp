@@ -5,6 +5,7 @@
 #include "ItemTemplateWrapper.h"
 #include "RecyclePool.h"
 #include "ItemsRepeater.common.h"
+#include "RepeaterTestHooks.h"
 
 ItemTemplateWrapper::ItemTemplateWrapper(winrt::DataTemplate const& dataTemplate)
 {
@@ -54,6 +55,7 @@ winrt::UIElement ItemTemplateWrapper::GetElement(winrt::ElementFactoryGetArgs co
     {
         // no element was found in recycle pool, create a new element
         element = selectedTemplate.LoadContent().as<winrt::FrameworkElement>();
+        RepeaterTestHooks::NotifyElementLoaded();
 
         // Associate template with element
         element.SetValue(RecyclePool::GetOriginTemplateProperty(), selectedTemplate);
@@ -68,15 +70,21 @@ void ItemTemplateWrapper::RecycleElement(winrt::ElementFactoryRecycleArgs const&
     winrt::DataTemplate selectedTemplate = m_dataTemplate? 
         m_dataTemplate:
         element.GetValue(RecyclePool::GetOriginTemplateProperty()).as<winrt::DataTemplate>();
-    auto recyclePool = RecyclePool::GetPoolInstance(selectedTemplate);
+    auto recyclePool = EnsureRecyclePool(selectedTemplate);
+    recyclePool.PutElement(args.Element(), L"" /* key */, args.Parent());
+}
+
+#pragma endregion
+
+winrt::RecyclePool ItemTemplateWrapper::EnsureRecyclePool(winrt::DataTemplate const& dataTemplate)
+{
+    auto recyclePool = RecyclePool::GetPoolInstance(dataTemplate);
     if (!recyclePool)
     {
         // No Recycle pool in the template, create one.
         recyclePool = winrt::make<RecyclePool>();
-        RecyclePool::SetPoolInstance(selectedTemplate, recyclePool);
+        RecyclePool::SetPoolInstance(dataTemplate, recyclePool);
     }
 
-    recyclePool.PutElement(args.Element(), L"" /* key */, args.Parent());
+    return recyclePool;
 }
-
-#pragma endregion
@@ -23,6 +23,9 @@ public:
     void RecycleElement(winrt::ElementFactoryRecycleArgs const& args);
 #pragma endregion
 
+    // Returns the recycle pool attached to the template, after creating it if needed.
+    static winrt::RecyclePool EnsureRecyclePool(winrt::DataTemplate const& dataTemplate);
+
 private:
     winrt::DataTemplate m_dataTemplate{ nullptr };
     winrt::DataTemplateSelector m_dataTemplateSelector{ nullptr };
@@ -13,6 +13,7 @@
 #include "ViewportManagerDownlevel.h"
 #include "RuntimeProfiler.h"
 #include "ItemTemplateWrapper.h"
+#include "VirtualizingLayout.h"
 
 // Change to 'true' to turn on debugging outputs in Output window
 bool RepeaterTrace::s_IsDebugOutputEnabled{ false };
@@ -388,6 +389,13 @@ void ItemsRepeater::OnPropertyChanged(const winrt::DependencyPropertyChangedEven
     {
         m_viewportManager->VerticalCacheLength(unbox_value<double>(args.NewValue()));
     }
+    else if (property == s_PrewarmElementCountProperty)
+    {
+        if (IsLoaded())
+        {
+            m_elementPrewarmer.Start();
+        }
+    }
 }
 
 void ItemsRepeater::OnElementPrepared(const winrt::UIElement& element, int index)
@@ -476,6 +484,10 @@ void ItemsRepeater::OnLoaded(const winrt::IInspectable& /*sender*/, const winrt:
         m_viewportManager->ResetScrollers();
     }
     ++_loadedCounter;
+
+    // Loaded is raised after the first layout pass, so the elements created from now on
+    // only benefit the elements brought into view later.
+    m_elementPrewarmer.Start();
 }
 
 void ItemsRepeater::OnUnloaded(const winrt::IInspectable& /*sender*/, const winrt::RoutedEventArgs& /*args*/)
@@ -485,6 +497,7 @@ void ItemsRepeater::OnUnloaded(const winrt::IInspectable& /*sender*/, const winr
     if (_unloadedCounter == _loadedCounter)
     {
         m_viewportManager->ResetScrollers();
+        m_elementPrewarmer.Stop();
     }
 }
 
@@ -609,6 +622,11 @@ void ItemsRepeater::OnItemTemplateChanged(const winrt::IElementFactory& oldValue
         }
     }
 
+    if (IsLoaded())
+    {
+        m_elementPrewarmer.Start();
+    }
+
     InvalidateMeasure();
 }
 
@@ -718,6 +736,37 @@ void ItemsRepeater::InvalidateArrangeForLayout(winrt::Layout const&, winrt::IIns
     InvalidateArrange();
 }
 
+int ItemsRepeater::GetNeighborIndex(int index, winrt::FocusNavigationDirection direction, bool isPageNavigation, winrt::Size const& viewportSize)
+{
+    if (m_isLayoutInProgress)
+    {
+        return -1;
+    }
+
+    if (auto layout = Layout())
+    {
+        if (auto virtualizingLayout = layout.try_as<winrt::VirtualizingLayout>())
+        {
+            // Layouts reason in terms of start and end of the line, which are swapped in right-to-left.
+            if (FlowDirection() == winrt::FlowDirection::RightToLeft)
+            {
+                if (direction == winrt::FocusNavigationDirection::Left)
+                {
+                    direction = winrt::FocusNavigationDirection::Right;
+                }
+                else if (direction == winrt::FocusNavigationDirection::Right)
+                {
+                    direction = winrt::FocusNavigationDirection::Left;
+                }
+            }
+
+            return winrt::get_self<VirtualizingLayout>(virtualizingLayout)->GetNeighborIndex(GetLayoutContext(), index, direction, isPageNavigation, viewportSize);
+        }
+    }
+
+    return -1;
+}
+
 winrt::VirtualizingLayoutContext ItemsRepeater::GetLayoutContext()
 {
     if (!m_layoutContext)
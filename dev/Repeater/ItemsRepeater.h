@@ -4,6 +4,7 @@
 #pragma once
 
 #include "AnimationManager.h"
+#include "ElementPrewarmer.h"
 #include "ViewManager.h"
 #include "VirtualizationInfo.h"
 #include "ItemsRepeaterElementPreparedEventArgs.h"
@@ -68,6 +69,7 @@ public:
     winrt::Microsoft::UI::Xaml::Controls::IElementFactoryShim ItemTemplateShim() { return m_itemTemplateWrapper; };
     ViewManager& ViewManager() { return m_viewManager; }
     AnimationManager& AnimationManager() { return m_animationManager; }
+    ElementPrewarmer& ElementPrewarmer() { return m_elementPrewarmer; }
 
     winrt::UIElement GetElementImpl(int index, bool forceCreate, bool suppressAutoRecycle);
     void ClearElementImpl(const winrt::UIElement& element);
@@ -79,6 +81,10 @@ public:
 
     winrt::UIElement GetOrCreateElementImpl(int index);
 
+    // Asks the layout which item directional navigation from the item at index should reach.
+    // Returns -1 if the layout cannot answer without a focus search.
+    int GetNeighborIndex(int index, winrt::FocusNavigationDirection direction, bool isPageNavigation, winrt::Size const& viewportSize);
+
     static winrt::com_ptr<VirtualizationInfo> TryGetVirtualizationInfo(const winrt::UIElement& element);
     static winrt::com_ptr<VirtualizationInfo> GetVirtualizationInfo(const winrt::UIElement& element);
     static winrt::com_ptr<VirtualizationInfo> CreateAndInitializeVirtualizationInfo(const winrt::UIElement& element);
@@ -89,6 +95,7 @@ public:
     winrt::Rect RealizationWindow() const { return m_viewportManager->GetLayoutRealizationWindow(); }
     winrt::UIElement SuggestedAnchor() const { return m_viewportManager->SuggestedAnchor(); }
     winrt::UIElement MadeAnchor() const { return m_viewportManager->MadeAnchor(); }
+    std::shared_ptr<::ViewportManager> const& GetViewportManager() const { return m_viewportManager; }
     winrt::Point LayoutOrigin() const { return m_layoutOrigin; }
     void LayoutOrigin(winrt::Point value) { m_layoutOrigin = value; }
 
@@ -132,11 +139,13 @@ private:
 
     winrt::VirtualizingLayoutContext GetLayoutContext();
     bool IsProcessingCollectionChange() const { return m_processingItemsSourceChange != nullptr; }
+    bool IsLoaded() const { return _loadedCounter > _unloadedCounter; }
 
     winrt::IIterable<winrt::DependencyObject> CreateChildrenInTabFocusOrderIterable();
 
     ::AnimationManager m_animationManager{ this };
     ::ViewManager m_viewManager{ this };
+    ::ElementPrewarmer m_elementPrewarmer{ this };
     std::shared_ptr<::ViewportManager> m_viewportManager{ nullptr };
 
     tracker_ref<winrt::ItemsSourceView> m_itemsSourceView{ this };
@@ -71,13 +71,10 @@ int32_t LayoutContextAdapter::GetElementIndexCore(winrt::UIElement const& elemen
 {
     if (auto context = m_nonVirtualizingContext.get())
     {
-        auto children = context.Children();
-        for (unsigned int i = 0; i < children.Size(); i++)
+        uint32_t index{};
+        if (context.Children().IndexOf(element, index))
         {
-            if (children.GetAt(i) == element)
-            {
-                return i;
-            }
+            return static_cast<int32_t>(index);
         }
     }
     
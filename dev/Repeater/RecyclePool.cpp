@@ -36,6 +36,13 @@ winrt::UIElement RecyclePool::TryGetElement(
     return TryGetElementCore(key, owner);
 }
 
+int32_t RecyclePool::GetElementCount(
+    winrt::hstring const& key)
+{
+    auto iterator = m_elements.find(key);
+    return iterator != m_elements.end() ? static_cast<int32_t>(iterator->second.size()) : 0;
+}
+
 #pragma endregion
 
 #pragma region IRecyclePoolOverrides
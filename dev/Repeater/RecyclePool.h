@@ -22,6 +22,8 @@ public:
     winrt::UIElement TryGetElement(
         winrt::hstring const& key,
         winrt::UIElement const& owner);
+    int32_t GetElementCount(
+        winrt::hstring const& key);
 #pragma endregion
 
 #pragma region IRecyclePoolOverrides
@@ -9,6 +9,7 @@
 #include "RecyclingElementFactory.h"
 #include "ItemsRepeater.h"
 #include "RecyclePool.h"
+#include "RepeaterTestHooks.h"
 
 CppWinRTActivatableClassWithBasicFactory(RecyclingElementFactory);
 
@@ -117,6 +118,7 @@ winrt::UIElement RecyclingElementFactory::GetElementCore(winrt::ElementFactoryGe
 
         auto dataTemplate = m_templates.get().Lookup(templateKey);
         element = dataTemplate.LoadContent().as<winrt::FrameworkElement>();
+        RepeaterTestHooks::NotifyElementLoaded();
 
         // Associate ReuseKey with element
         RecyclePool::SetReuseKey(element, templateKey);
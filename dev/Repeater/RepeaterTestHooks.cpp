@@ -7,6 +7,8 @@
 #include "layout.h"
 #include "ElementFactoryGetArgs.h"
 #include "ElementFactoryRecycleArgs.h"
+#include "FlowLayoutNavigation.h"
+#include "UniformGridLayoutGeometry.h"
 
 
 winrt::event_token RepeaterTestHooks::BuildTreeCompletedImpl(
@@ -67,4 +69,17 @@ void RepeaterTestHooks::SetLayoutId(winrt::IInspectable const& layout, const hst
     {
         instance->LayoutId(id);
     }
-}
\ No newline at end of file
+}
+
+/* static */
+int RepeaterTestHooks::GetFlowLayoutNeighborIndex(int index, int itemCount, int itemsPerLine, winrt::FocusNavigationDirection const& direction, bool isVerticalScrolling, int linesPerPage)
+{
+    return FlowLayoutNavigation::GetNeighborIndex(index, itemCount, itemsPerLine, direction, isVerticalScrolling, linesPerPage);
+}
+
+void RepeaterTestHooks::GetUniformGridLayoutIndexRangeInMajorWindow(double itemMajorSize, double lineSpacing, int itemsPerLine, int itemCount, double majorStart, double majorEnd, int32_t& firstIndex, int32_t& lastIndex)
+{
+    // Items are one unit wide with no spacing so that the available minor size is the number of items per line.
+    const UniformGridLayoutGeometry geometry(1.0, itemMajorSize, 0.0, lineSpacing, static_cast<float>(itemsPerLine), itemCount);
+    geometry.GetIndexRangeInMajorWindow(majorStart, majorEnd, firstIndex, lastIndex);
+}
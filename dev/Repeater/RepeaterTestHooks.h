@@ -30,8 +30,22 @@ public:
     static hstring GetLayoutId(winrt::IInspectable const& layout);
     static void SetLayoutId(winrt::IInspectable const& layout, const hstring& id);
 
+    static int GetCacheBuildActionCount();
+    static void ResetCacheBuildActionCount();
+    static void NotifyCacheBuildActionCompleted();
+
+    // Counts the templates loaded on demand by the element factories, as opposed to prewarmed ones.
+    static int GetElementLoadCount();
+    static void ResetElementLoadCount();
+    static void NotifyElementLoaded();
+
+    static int GetFlowLayoutNeighborIndex(int index, int itemCount, int itemsPerLine, winrt::FocusNavigationDirection const& direction, bool isVerticalScrolling, int linesPerPage);
+    static void GetUniformGridLayoutIndexRangeInMajorWindow(double itemMajorSize, double lineSpacing, int itemsPerLine, int itemCount, double majorStart, double majorEnd, int32_t& firstIndex, int32_t& lastIndex);
+
 private:
     static RepeaterTestHooks* s_testHooks;
+    static int s_cacheBuildActionCount;
+    static int s_elementLoadCount;
 
     static void EnsureHooks();
 
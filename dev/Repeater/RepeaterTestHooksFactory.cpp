@@ -6,6 +6,8 @@
 #include "RepeaterTestHooksFactory.h"
 
 RepeaterTestHooks* RepeaterTestHooks::s_testHooks = nullptr;
+int RepeaterTestHooks::s_cacheBuildActionCount = 0;
+int RepeaterTestHooks::s_elementLoadCount = 0;
 
 void RepeaterTestHooks::EnsureHooks()
 {
@@ -36,3 +38,45 @@ void RepeaterTestHooks::NotifyBuildTreeCompleted()
         s_testHooks->NotifyBuildTreeCompletedImpl();
     }
 }
+
+int RepeaterTestHooks::GetCacheBuildActionCount()
+{
+    EnsureHooks();
+    return s_cacheBuildActionCount;
+}
+
+void RepeaterTestHooks::ResetCacheBuildActionCount()
+{
+    EnsureHooks();
+    s_cacheBuildActionCount = 0;
+}
+
+void RepeaterTestHooks::NotifyCacheBuildActionCompleted()
+{
+    // Only count once a test is using the hooks.
+    if (s_testHooks)
+    {
+        ++s_cacheBuildActionCount;
+    }
+}
+
+int RepeaterTestHooks::GetElementLoadCount()
+{
+    EnsureHooks();
+    return s_elementLoadCount;
+}
+
+void RepeaterTestHooks::ResetElementLoadCount()
+{
+    EnsureHooks();
+    s_elementLoadCount = 0;
+}
+
+void RepeaterTestHooks::NotifyElementLoaded()
+{
+    // Only count once a test is using the hooks.
+    if (s_testHooks)
+    {
+        ++s_elementLoadCount;
+    }
+}
@@ -0,0 +1,171 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "SelectionChangeSet.h"
+
+void SelectionChangeSet::RecordSelected(const std::vector<int>& path, const IndexRange& range)
+{
+    Record(m_added, m_removed, path, range);
+}
+
+void SelectionChangeSet::RecordDeselected(const std::vector<int>& path, const IndexRange& range)
+{
+    Record(m_removed, m_added, path, range);
+}
+
+void SelectionChangeSet::Clear()
+{
+    m_added.clear();
+    m_removed.clear();
+    m_isInvalidated = false;
+}
+
+bool SelectionChangeSet::TryGetFirstSelected(const std::vector<int>& previousPath, int previousIndex, std::vector<int>& path, int& index) const
+{
+    if (m_isInvalidated)
+    {
+        return false;
+    }
+
+    // The path map is ordered the way SelectedIndices walks the nodes, a node's path sorts before its children's.
+    const bool hasPrevious = previousIndex >= 0;
+    if (!m_added.empty())
+    {
+        const auto& firstAddedPath = m_added.begin()->first;
+        const int firstAddedIndex = m_added.begin()->second.front().Begin();
+        if (!hasPrevious ||
+            firstAddedPath < previousPath ||
+            (firstAddedPath == previousPath && firstAddedIndex < previousIndex))
+        {
+            path = firstAddedPath;
+            index = firstAddedIndex;
+            return true;
+        }
+    }
+
+    if (hasPrevious && Contains(m_removed, previousPath, previousIndex))
+    {
+        return false;
+    }
+
+    path = previousPath;
+    index = previousIndex;
+    return true;
+}
+
+/* static */
+void SelectionChangeSet::Record(RangeSetsByPath& target, RangeSetsByPath& opposite, const std::vector<int>& path, const IndexRange& range)
+{
+    // Whatever part of the range is pending in the opposite set is a round trip
+    // within this batch and cancels out. The rest is a real change.
+    RangeSet cancelled;
+    const auto oppositeIt = opposite.find(path);
+    if (oppositeIt != opposite.end())
+    {
+        cancelled = Exclude(oppositeIt->second, range);
+        if (oppositeIt->second.empty())
+        {
+            opposite.erase(oppositeIt);
+        }
+    }
+
+    int next = range.Begin();
+    auto& targetSet = target[path];
+    for (auto& piece : cancelled)
+    {
+        if (piece.Begin() > next)
+        {
+            Include(targetSet, IndexRange(next, piece.Begin() - 1));
+        }
+
+        next = piece.End() + 1;
+    }
+
+    if (next <= range.End())
+    {
+        Include(targetSet, IndexRange(next, range.End()));
+    }
+
+    if (targetSet.empty())
+    {
+        target.erase(path);
+    }
+}
+
+/* static */
+void SelectionChangeSet::Include(RangeSet& set, const IndexRange& range)
+{
+    int begin = range.Begin();
+    int end = range.End();
+
+    // Swallow every range that overlaps or touches the new one.
+    auto first = std::lower_bound(set.begin(), set.end(), begin, [](const IndexRange& r, int value) { return r.End() + 1 < value; });
+    auto last = first;
+    while (last != set.end() && last->Begin() <= end + 1)
+    {
+        begin = std::min(begin, last->Begin());
+        end = std::max(end, last->End());
+        ++last;
+    }
+
+    set.insert(set.erase(first, last), IndexRange(begin, end));
+}
+
+/* static */
+SelectionChangeSet::RangeSet SelectionChangeSet::Exclude(RangeSet& set, const IndexRange& range)
+{
+    RangeSet excluded;
+    RangeSet remaining;
+
+    auto first = std::lower_bound(set.begin(), set.end(), range.Begin(), [](const IndexRange& r, int value) { return r.End() < value; });
+    auto last = first;
+    while (last != set.end() && last->Begin() <= range.End())
+    {
+        if (last->Begin() < range.Begin())
+        {
+            remaining.emplace_back(last->Begin(), range.Begin() - 1);
+        }
+
+        excluded.emplace_back(std::max(last->Begin(), range.Begin()), std::min(last->End(), range.End()));
+
+        if (last->End() > range.End())
+        {
+            remaining.emplace_back(range.End() + 1, last->End());
+        }
+
+        ++last;
+    }
+
+    set.insert(set.erase(first, last), remaining.begin(), remaining.end());
+    return excluded;
+}
+
+/* static */
+bool SelectionChangeSet::Contains(const RangeSetsByPath& sets, const std::vector<int>& path, int index)
+{
+    const auto it = sets.find(path);
+    if (it != sets.end())
+    {
+        const auto& set = it->second;
+        const auto range = std::lower_bound(set.begin(), set.end(), index, [](const IndexRange& r, int value) { return r.End() < value; });
+        return range != set.end() && range->Contains(index);
+    }
+
+    return false;
+}
+
+/* static */
+std::vector<SelectionChangeSet::Entry> SelectionChangeSet::Flatten(const RangeSetsByPath& sets)
+{
+    std::vector<Entry> entries;
+    for (auto& pathAndSet : sets)
+    {
+        for (auto& range : pathAndSet.second)
+        {
+            entries.push_back(Entry{ pathAndSet.first, range });
+        }
+    }
+
+    return entries;
+}
@@ -0,0 +1,56 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+#include "IndexRange.h"
+
+// Accumulates the net effect of the selection operations performed on the SelectionNode tree
+// between two SelectionChanged notifications. Nodes only report indices whose state actually flips,
+// so selecting an index that was deselected earlier in the same batch (or the other way around)
+// cancels out and the resulting added/removed sets match a before/after diff of SelectedIndices.
+// Ranges are kept per node path as sorted, disjoint lists so that large range operations
+// (SelectAll, SelectRange...) stay cheap to record.
+class SelectionChangeSet final
+{
+public:
+    struct Entry
+    {
+        std::vector<int> Path;
+        IndexRange Range;
+    };
+
+    void RecordSelected(const std::vector<int>& path, const IndexRange& range);
+    void RecordDeselected(const std::vector<int>& path, const IndexRange& range);
+
+    // Used when the source collection changed underneath the selection. Indices shift in that
+    // case so the recorded ranges no longer describe the change.
+    void Invalidate() { m_isInvalidated = true; }
+    void Clear();
+
+    bool IsInvalidated() const { return m_isInvalidated; }
+    bool IsEmpty() const { return m_added.empty() && m_removed.empty(); }
+
+    std::vector<Entry> Added() const { return Flatten(m_added); }
+    std::vector<Entry> Removed() const { return Flatten(m_removed); }
+
+    // Works out the first selected index after these changes from the one before them, in SelectedIndices
+    // order: by node path first, then by index within the node. An index of -1 means nothing is selected.
+    // Returns false when the changes alone can't tell, i.e. when they are invalidated or when the previous
+    // first index got deselected and nothing before it got selected.
+    bool TryGetFirstSelected(const std::vector<int>& previousPath, int previousIndex, std::vector<int>& path, int& index) const;
+
+private:
+    // Sorted, disjoint and non adjacent ranges.
+    using RangeSet = std::vector<IndexRange>;
+    using RangeSetsByPath = std::map<std::vector<int>, RangeSet>;
+
+    static void Record(RangeSetsByPath& target, RangeSetsByPath& opposite, const std::vector<int>& path, const IndexRange& range);
+    static void Include(RangeSet& set, const IndexRange& range);
+    static RangeSet Exclude(RangeSet& set, const IndexRange& range);
+    static std::vector<Entry> Flatten(const RangeSetsByPath& sets);
+    static bool Contains(const RangeSetsByPath& sets, const std::vector<int>& path, int index);
+
+    RangeSetsByPath m_added;
+    RangeSetsByPath m_removed;
+    bool m_isInvalidated{ false };
+};
@@ -87,8 +87,7 @@ void SelectionModel::SingleSelect(bool value)
             auto firstSelectionIndexPath = selectedIndices.GetAt(0);
             ClearSelection(true /* resetAnchor */, false /*raiseSelectionChanged */);
             SelectWithPathImpl(firstSelectionIndexPath, true /* select */, false /* raiseSelectionChanged */);
-            // Setting SelectedIndex will raise SelectionChanged event.
-            SelectedIndex(firstSelectionIndexPath);
+            OnSelectionChanged();
         }
 
         RaisePropertyChanged(L"SingleSelect");
@@ -514,9 +513,25 @@ void SelectionModel::RaisePropertyChanged(std::wstring_view const& name)
 
 void SelectionModel::OnSelectionInvalidatedDueToCollectionChange()
 {
+    m_pendingChanges.Invalidate();
     OnSelectionChanged();
 }
 
+void SelectionModel::OnNodeSelectionChanged(const std::vector<int>& nodePath, const std::vector<IndexRange>& ranges, bool select)
+{
+    for (auto& range : ranges)
+    {
+        if (select)
+        {
+            m_pendingChanges.RecordSelected(nodePath, range);
+        }
+        else
+        {
+            m_pendingChanges.RecordDeselected(nodePath, range);
+        }
+    }
+}
+
 winrt::IInspectable SelectionModel::ResolvePath(const winrt::IInspectable& data)
 {
     winrt::IInspectable resolved = nullptr;
@@ -577,27 +592,92 @@ void SelectionModel::ClearSelection(bool resetAnchor, bool raiseSelectionChanged
 
 void SelectionModel::OnSelectionChanged()
 {
-    m_selectedIndicesCached = nullptr;
-    m_selectedItemsCached = nullptr;
+    // A collection change shifts indices and can replace items, so in that case
+    // everything is considered changed.
+    const bool isInvalidated = m_pendingChanges.IsInvalidated();
+    const bool hasChanged = isInvalidated || !m_pendingChanges.IsEmpty();
+    if (hasChanged)
+    {
+        m_selectedIndicesCached = nullptr;
+        m_selectedItemsCached = nullptr;
+    }
+
+    // SelectedIndex is worked out from the pending changes, so before they are handed to the event args.
+    const bool hasPropertyChangedListeners = static_cast<bool>(m_propertyChangedEventSource);
+    bool selectedIndexChanged = false;
+    if (!hasPropertyChangedListeners)
+    {
+        m_isLastSelectedIndexValid = false;
+    }
+    else if (hasChanged)
+    {
+        selectedIndexChanged = UpdateLastSelectedIndex();
+    }
 
-    // Raise SelectionChanged event
+    // Raise SelectionChanged event. The args are not cached since they carry the
+    // changes of this notification only.
     if (m_selectionChangedEventSource)
     {
-        if (!m_selectionChangedEventArgs)
+        auto args = winrt::make<SelectionModelSelectionChangedEventArgs>(m_pendingChanges);
+        m_pendingChanges.Clear();
+        m_selectionChangedEventSource(*this, args);
+    }
+    else
+    {
+        m_pendingChanges.Clear();
+    }
+
+    if (hasPropertyChangedListeners && hasChanged)
+    {
+        if (selectedIndexChanged)
         {
-            m_selectionChangedEventArgs = tracker_ref<winrt::SelectionModelSelectionChangedEventArgs>(this, winrt::make<SelectionModelSelectionChangedEventArgs>());
+            RaisePropertyChanged(L"SelectedIndex");
         }
+        RaisePropertyChanged(L"SelectedIndices");
 
-        m_selectionChangedEventSource(*this, m_selectionChangedEventArgs.get());
+        if (m_rootNode->Source())
+        {
+            if (selectedIndexChanged)
+            {
+                RaisePropertyChanged(L"SelectedItem");
+            }
+            RaisePropertyChanged(L"SelectedItems");
+        }
     }
+}
+
+// Updates the SelectedIndex last reported to PropertyChanged listeners and returns whether it changed.
+// Walking the selection to find the first selected index is only needed when the pending changes can't tell.
+bool SelectionModel::UpdateLastSelectedIndex()
+{
+    std::vector<int> nodePath;
+    int indexInNode = -1;
 
-    RaisePropertyChanged(L"SelectedIndex");
-    RaisePropertyChanged(L"SelectedIndices");
-    if (m_rootNode->Source())
+    if (!m_isLastSelectedIndexValid ||
+        !m_pendingChanges.TryGetFirstSelected(m_lastSelectedNodePath, m_lastSelectedIndexInNode, nodePath, indexInNode))
     {
-        RaisePropertyChanged(L"SelectedItem");
-        RaisePropertyChanged(L"SelectedItems");
+        if (const auto selectedIndex = SelectedIndex())
+        {
+            const int size = selectedIndex.GetSize();
+            for (int i = 0; i < size - 1; i++)
+            {
+                nodePath.push_back(selectedIndex.GetAt(i));
+            }
+            indexInNode = selectedIndex.GetAt(size - 1);
+        }
     }
+
+    // A collection change can shift or replace the selected item even if the index stayed the same.
+    const bool changed =
+        m_pendingChanges.IsInvalidated() ||
+        !m_isLastSelectedIndexValid ||
+        indexInNode != m_lastSelectedIndexInNode ||
+        nodePath != m_lastSelectedNodePath;
+
+    m_lastSelectedNodePath = std::move(nodePath);
+    m_lastSelectedIndexInNode = indexInNode;
+    m_isLastSelectedIndexValid = true;
+    return changed;
 }
 
 void SelectionModel::SelectImpl(int index, bool select)
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "SelectionModel.g.h"
+#include "SelectionChangeSet.h"
 
 struct SelectedItemInfo
 {
@@ -90,12 +91,14 @@ public:
 
     winrt::IInspectable ResolvePath(const winrt::IInspectable& data);
     void OnSelectionInvalidatedDueToCollectionChange();
+    void OnNodeSelectionChanged(const std::vector<int>& nodePath, const std::vector<IndexRange>& ranges, bool select);
     std::shared_ptr<SelectionNode> SharedLeafNode() { return m_leafNode; }
 
 private:
     void RaisePropertyChanged(std::wstring_view const& name);
     void ClearSelection(bool resetAnchor, bool raiseSelectionChanged);
     void OnSelectionChanged();
+    bool UpdateLastSelectedIndex();
 
     void SelectImpl(int index, bool select);
     void SelectWithGroupImpl(int groupIndex, int itemIndex, bool select);
@@ -110,13 +113,21 @@ private:
     winrt::IVectorView<winrt::IndexPath> m_selectedIndicesCached{ nullptr };
     winrt::IVectorView<winrt::IInspectable> m_selectedItemsCached{ nullptr };
 
+    // Net changes since the last SelectionChanged, reported by the nodes as they change.
+    SelectionChangeSet m_pendingChanges;
+    // SelectedIndex as last reported to PropertyChanged listeners, only tracked while there are listeners.
+    // It is kept as the path of its node and its index in that node (-1 if nothing is selected) so that
+    // it can be updated from m_pendingChanges.
+    std::vector<int> m_lastSelectedNodePath;
+    int m_lastSelectedIndexInNode{ -1 };
+    bool m_isLastSelectedIndexValid{ false };
+
     event_source<winrt::TypedEventHandler<winrt::SelectionModel, winrt::SelectionModelChildrenRequestedEventArgs>> m_getChildrenEventSource{ this };
     event_source<winrt::TypedEventHandler<winrt::SelectionModel, winrt::SelectionModelSelectionChangedEventArgs>> m_selectionChangedEventSource{ this };
     event_source<winrt::PropertyChangedEventHandler> m_propertyChangedEventSource{ this };
 
     // Cached Event args to avoid creation cost every time
     tracker_ref<winrt::SelectionModelChildrenRequestedEventArgs> m_childrenRequestedEventArgs{ this };
-    tracker_ref<winrt::SelectionModelSelectionChangedEventArgs> m_selectionChangedEventArgs{ this };
 
     // use just one instance of a leaf node to avoid creating a bunch of these.
     std::shared_ptr<SelectionNode> m_leafNode;
@@ -0,0 +1,39 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "ItemsRepeater.common.h"
+#include "SelectionModelIndexRange.h"
+#include "IndexPath.h"
+
+SelectionModelIndexRange::SelectionModelIndexRange(const std::vector<int>& parentPath, int firstIndex, int lastIndex) :
+    m_parentPath(parentPath),
+    m_firstIndex(firstIndex),
+    m_lastIndex(lastIndex)
+{
+}
+
+#pragma region ISelectionModelIndexRange
+
+winrt::IndexPath SelectionModelIndexRange::ParentIndex()
+{
+    if (!m_parentIndex)
+    {
+        m_parentIndex = winrt::make<IndexPath>(m_parentPath);
+    }
+
+    return m_parentIndex;
+}
+
+int32_t SelectionModelIndexRange::FirstIndex()
+{
+    return m_firstIndex;
+}
+
+int32_t SelectionModelIndexRange::LastIndex()
+{
+    return m_lastIndex;
+}
+
+#pragma endregion
@@ -0,0 +1,26 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "SelectionModelIndexRange.g.h"
+
+class SelectionModelIndexRange :
+    public winrt::implementation::SelectionModelIndexRangeT<SelectionModelIndexRange>
+{
+public:
+    SelectionModelIndexRange(const std::vector<int>& parentPath, int firstIndex, int lastIndex);
+
+#pragma region ISelectionModelIndexRange
+    winrt::IndexPath ParentIndex();
+    int32_t FirstIndex();
+    int32_t LastIndex();
+#pragma endregion
+
+private:
+    // The IndexPath is only created if the handler asks for it.
+    std::vector<int> m_parentPath;
+    winrt::IndexPath m_parentIndex{ nullptr };
+    int m_firstIndex;
+    int m_lastIndex;
+};
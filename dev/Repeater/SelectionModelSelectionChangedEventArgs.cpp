@@ -5,7 +5,51 @@
 #include "common.h"
 #include "ItemsRepeater.common.h"
 #include "SelectionModelSelectionChangedEventArgs.h"
+#include "SelectionModelIndexRange.h"
+#include "Vector.h"
+
+SelectionModelSelectionChangedEventArgs::SelectionModelSelectionChangedEventArgs(const SelectionChangeSet& changes) :
+    m_isInvalidated(changes.IsInvalidated())
+{
+    if (!m_isInvalidated)
+    {
+        m_added = changes.Added();
+        m_removed = changes.Removed();
+    }
+}
 
 #pragma region ISelectionModelSelectionChangedEventArgs
 
-#pragma endregion
\ No newline at end of file
+winrt::IVectorView<winrt::SelectionModelIndexRange> SelectionModelSelectionChangedEventArgs::AddedRanges()
+{
+    if (!m_addedRanges && !m_isInvalidated)
+    {
+        m_addedRanges = CreateRanges(m_added);
+    }
+
+    return m_addedRanges;
+}
+
+winrt::IVectorView<winrt::SelectionModelIndexRange> SelectionModelSelectionChangedEventArgs::RemovedRanges()
+{
+    if (!m_removedRanges && !m_isInvalidated)
+    {
+        m_removedRanges = CreateRanges(m_removed);
+    }
+
+    return m_removedRanges;
+}
+
+#pragma endregion
+
+/* static */
+winrt::IVectorView<winrt::SelectionModelIndexRange> SelectionModelSelectionChangedEventArgs::CreateRanges(const std::vector<SelectionChangeSet::Entry>& entries)
+{
+    auto ranges = winrt::make<Vector<winrt::SelectionModelIndexRange>>();
+    for (auto& entry : entries)
+    {
+        ranges.Append(winrt::make<SelectionModelIndexRange>(entry.Path, entry.Range.Begin(), entry.Range.End()));
+    }
+
+    return ranges.GetView();
+}
@@ -3,10 +3,27 @@
 
 #pragma once
 
+#include "SelectionChangeSet.h"
 #include "SelectionModelSelectionChangedEventArgs.g.h"
 
 class SelectionModelSelectionChangedEventArgs :
     public winrt::implementation::SelectionModelSelectionChangedEventArgsT<SelectionModelSelectionChangedEventArgs>
 {
 public:
-};
\ No newline at end of file
+    SelectionModelSelectionChangedEventArgs(const SelectionChangeSet& changes);
+
+#pragma region ISelectionModelSelectionChangedEventArgs
+    winrt::IVectorView<winrt::SelectionModelIndexRange> AddedRanges();
+    winrt::IVectorView<winrt::SelectionModelIndexRange> RemovedRanges();
+#pragma endregion
+
+private:
+    // The ranges are only created if the handler asks for them.
+    static winrt::IVectorView<winrt::SelectionModelIndexRange> CreateRanges(const std::vector<SelectionChangeSet::Entry>& entries);
+
+    bool m_isInvalidated{ false };
+    std::vector<SelectionChangeSet::Entry> m_added;
+    std::vector<SelectionChangeSet::Entry> m_removed;
+    winrt::IVectorView<winrt::SelectionModelIndexRange> m_addedRanges{ nullptr };
+    winrt::IVectorView<winrt::SelectionModelIndexRange> m_removedRanges{ nullptr };
+};
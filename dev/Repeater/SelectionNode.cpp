@@ -321,18 +321,21 @@ void SelectionNode::AddRange(const IndexRange& addRange, bool raiseOnSelectionCh
     // TODO: Optimize by merging adjacent ranges (Task 14107720)
 
     int oldCount = SelectedCount();
+    std::vector<IndexRange> newlySelected;
 
     for (int i = addRange.Begin(); i <= addRange.End(); i++)
     {
         if (!IsSelected(i))
         {
             m_selectedCount++;
+            AppendToRanges(newlySelected, i);
         }
     }
 
     if (oldCount != m_selectedCount)
     {
         m_selected.emplace_back(addRange);
+        m_manager->OnNodeSelectionChanged(IndexPathFromRoot(), newlySelected, true /* select */);
 
         if (raiseOnSelectionChanged)
         {
@@ -344,6 +347,7 @@ void SelectionNode::AddRange(const IndexRange& addRange, bool raiseOnSelectionCh
 void SelectionNode::RemoveRange(const IndexRange& removeRange, bool raiseOnSelectionChanged)
 {
     int oldCount = m_selectedCount;
+    std::vector<IndexRange> newlyDeselected;
 
     // TODO: Prevent overlap of Ranges in _selected (Task 14107720)
     for (int i = removeRange.Begin(); i <= removeRange.End(); i++)
@@ -351,11 +355,14 @@ void SelectionNode::RemoveRange(const IndexRange& removeRange, bool raiseOnSelec
         if (IsSelected(i))
         {
             m_selectedCount--;
+            AppendToRanges(newlyDeselected, i);
         }
     }
 
     if (oldCount != m_selectedCount)
     {
+        m_manager->OnNodeSelectionChanged(IndexPathFromRoot(), newlyDeselected, false /* select */);
+
         // Build up a both a list of Ranges to remove and ranges to add
         std::vector<IndexRange> toRemove;
         std::vector<IndexRange> toAdd;
@@ -421,14 +428,47 @@ void SelectionNode::RemoveRange(const IndexRange& removeRange, bool raiseOnSelec
 }
 
 void SelectionNode::ClearSelection()
+{
+    std::vector<int> path;
+    if (m_selected.size() > 0 || m_childrenNodes.size() > 0)
+    {
+        path = IndexPathFromRoot();
+    }
+
+    ClearSelection(path);
+}
+
+void SelectionNode::ClearSelection(std::vector<int>& path)
 {
     // Deselect all items
     if (m_selected.size() > 0)
     {
+        // m_selected can contain overlapping ranges, report the deduplicated indices.
+        std::vector<IndexRange> deselected;
+        for (int index : SelectedIndices())
+        {
+            AppendToRanges(deselected, index);
+        }
+
+        m_manager->OnNodeSelectionChanged(path, deselected, false /* select */);
         m_selected.clear();
         OnSelectionChanged();
     }
 
+    // The children are about to be thrown away along with their selection. Clear them
+    // first while their position in this node is still known so that their deselected
+    // indices get reported too.
+    for (int i = 0; i < static_cast<int>(m_childrenNodes.size()); i++)
+    {
+        auto& child = m_childrenNodes[i];
+        if (child && child != m_manager->SharedLeafNode())
+        {
+            path.push_back(i);
+            child->ClearSelection(path);
+            path.pop_back();
+        }
+    }
+
     m_selectedCount = 0;
     AnchorIndex(-1);
 
@@ -671,6 +711,42 @@ bool SelectionNode::OnItemsRemoved(int index, int count)
     return selectionInvalidated;
 }
 
+// The path of this node is not stored since it changes whenever items get inserted
+// or removed in an ancestor. It is recomputed when a selection change is reported.
+std::vector<int> SelectionNode::IndexPathFromRoot()
+{
+    std::vector<int> path;
+    auto node = this;
+    while (auto parent = node->m_parent)
+    {
+        const auto& siblings = parent->m_childrenNodes;
+        const auto it = std::find_if(siblings.cbegin(), siblings.cend(), [node](const std::shared_ptr<SelectionNode>& sibling) { return sibling.get() == node; });
+        if (it == siblings.cend())
+        {
+            break;
+        }
+
+        path.push_back(static_cast<int>(it - siblings.cbegin()));
+        node = parent;
+    }
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+/* static */
+void SelectionNode::AppendToRanges(std::vector<IndexRange>& ranges, int index)
+{
+    if (ranges.size() > 0 && ranges.back().End() == index - 1)
+    {
+        ranges.back() = IndexRange(ranges.back().Begin(), index);
+    }
+    else
+    {
+        ranges.emplace_back(index, index);
+    }
+}
+
 void SelectionNode::OnSelectionChanged()
 {
     m_selectedIndicesCacheIsValid = false;
@@ -47,6 +47,7 @@ public:
     void Clear();
     bool SelectRange(const IndexRange& range, bool select);
     SelectionState EvaluateIsSelectedBasedOnChildrenNodes();
+    std::vector<int> IndexPathFromRoot();
     static winrt::IReference<bool> ConvertToNullableBool(SelectionState isSelected);
 
 private:
@@ -56,6 +57,8 @@ private:
     void AddRange(const IndexRange& addRange, bool raiseOnSelectionChanged);
     void RemoveRange(const IndexRange& removeRange, bool raiseOnSelectionChanged);
     void ClearSelection();
+    void ClearSelection(std::vector<int>& path);
+    static void AppendToRanges(std::vector<IndexRange>& ranges, int index);
     bool Select(int index, bool select, bool raiseOnSelectionChanged);
     void OnSourceListChanged(const winrt::IInspectable& dataSource, const winrt::NotifyCollectionChangedEventArgs& args);
     bool OnItemsAdded(int index, int count);
@@ -10,6 +10,7 @@
 #include "StackLayout.h"
 #include "RuntimeProfiler.h"
 #include "VirtualizingLayoutContext.h"
+#include "FlowLayoutNavigation.h"
 
 #pragma region IFlowLayout
 
@@ -62,7 +63,7 @@ winrt::Size StackLayout::MeasureOverride(
         context,
         false, /* isWrapping*/
         0 /* minItemSpacing */,
-        m_itemSpacing,
+        Spacing(),
         GetScrollOrientation(),
         LayoutId());
     return { desiredSize.Width, desiredSize.Height };
@@ -113,9 +114,9 @@ winrt::FlowLayoutAnchorInfo StackLayout::GetAnchorForRealizationRect(
         const auto state = GetAsStackState(context.LayoutState());
         const auto lastExtent = state->FlowAlgorithm().LastExtent();
 
-        const double averageElementSize = GetAverageElementSize(availableSize, context, state) + m_itemSpacing;
+        const double averageElementSize = GetAverageElementSize(availableSize, context, state) + Spacing();
         const double realizationWindowOffsetInExtent = realizationRect.*MajorStart() - lastExtent.*MajorStart();
-        const double majorSize = lastExtent.*MajorSize() == 0 ? std::max(0.0, averageElementSize * itemsCount - m_itemSpacing) : lastExtent.*MajorSize();
+        const double majorSize = lastExtent.*MajorSize() == 0 ? std::max(0.0, averageElementSize * itemsCount - Spacing()) : lastExtent.*MajorSize();
         if (itemsCount > 0 &&
             realizationRect.*MajorSize() >= 0 &&
             // MajorSize = 0 will account for when a nested repeater is outside the realization rect but still being measured. Also,
@@ -150,10 +151,10 @@ winrt::Rect StackLayout::GetExtent(
     // Constants
     const int itemsCount = context.ItemCount();
     const auto stackState = GetAsStackState(context.LayoutState());
-    const double averageElementSize = GetAverageElementSize(availableSize, context, stackState) + m_itemSpacing;
+    const double averageElementSize = GetAverageElementSize(availableSize, context, stackState) + Spacing();
 
     extent.*MinorSize() = static_cast<float>(stackState->MaxArrangeBounds());
-    extent.*MajorSize() = std::max(0.0f, static_cast<float>(itemsCount * averageElementSize - m_itemSpacing));
+    extent.*MajorSize() = std::max(0.0f, static_cast<float>(itemsCount * averageElementSize - Spacing()));
     if (itemsCount > 0)
     {
         if (firstRealized)
@@ -248,7 +249,7 @@ winrt::FlowLayoutAnchorInfo StackLayout::Algorithm_GetAnchorForTargetElement(
     {
         index = targetIndex;
         const auto state = GetAsStackState(context.LayoutState());
-        const double averageElementSize = GetAverageElementSize(availableSize, context, state) + m_itemSpacing;
+        const double averageElementSize = GetAverageElementSize(availableSize, context, state) + Spacing();
         offset = index * averageElementSize + state->FlowAlgorithm().LastExtent().*MajorStart();
     }
 
@@ -297,6 +298,42 @@ void StackLayout::Algorithm_OnElementMeasured(
 
 #pragma endregion
 
+int StackLayout::GetNeighborIndex(
+    winrt::VirtualizingLayoutContext const& context,
+    int index,
+    winrt::FocusNavigationDirection direction,
+    bool isPageNavigation,
+    winrt::Size const& viewportSize)
+{
+    const auto layoutState = context.LayoutState();
+    if (!layoutState)
+    {
+        return -1;
+    }
+
+    int linesPerPage = 0;
+    if (isPageNavigation)
+    {
+        // Use the same estimation as the extent so that a page lands where scrolling by a page would.
+        const auto stackState = GetAsStackState(layoutState);
+        if (stackState->TotalElementsMeasured() == 0)
+        {
+            return -1;
+        }
+
+        const double averageElementSize = round(stackState->TotalElementSize() / stackState->TotalElementsMeasured()) + Spacing();
+        linesPerPage = FlowLayoutNavigation::GetLinesPerPage(viewportSize.*Major(), averageElementSize);
+    }
+
+    return FlowLayoutNavigation::GetNeighborIndex(
+        index,
+        context.ItemCount(),
+        1 /* itemsPerLine */,
+        direction,
+        GetScrollOrientation() == ScrollOrientation::Vertical,
+        linesPerPage);
+}
+
 void StackLayout::OnPropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args)
 {
     auto property = args.Property();
@@ -309,10 +346,6 @@ void StackLayout::OnPropertyChanged(const winrt::DependencyPropertyChangedEventA
         ScrollOrientation scrollOrientation = (orientation == winrt::Orientation::Horizontal) ? ScrollOrientation::Horizontal : ScrollOrientation::Vertical;
         OrientationBasedMeasures::SetScrollOrientation(scrollOrientation);
     }
-    else if (property == s_SpacingProperty)
-    {
-        m_itemSpacing = unbox_value<double>(args.NewValue());
-    }
 
     InvalidateLayout();
 }
@@ -93,6 +93,13 @@ public:
         const winrt::VirtualizingLayoutContext& /*context*/) override {}
 #pragma endregion
 
+    int GetNeighborIndex(
+        winrt::VirtualizingLayoutContext const& context,
+        int index,
+        winrt::FocusNavigationDirection direction,
+        bool isPageNavigation,
+        winrt::Size const& viewportSize) override;
+
     void OnPropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args);
 
 private:
@@ -116,9 +123,6 @@ private:
         return GetAsStackState(context.LayoutState())->FlowAlgorithm();
     }
 
-    // Fields
-    double m_itemSpacing{};
-
     // !!! WARNING !!!
     // Any storage here needs to be related to layout configuration. 
     // layout specific state needs to be stored in StackLayoutState.
@@ -9,6 +9,7 @@
 #include "UniformGridLayout.h"
 #include "RuntimeProfiler.h"
 #include "VirtualizingLayoutContext.h"
+#include "FlowLayoutNavigation.h"
 
 #pragma region IGridLayout
 
@@ -56,12 +57,18 @@ winrt::Size UniformGridLayout::MeasureOverride(
     winrt::VirtualizingLayoutContext const& context,
     winrt::Size const& availableSize)
 {
+    auto gridState = GetAsGridState(context.LayoutState());
+
     // Set the width and height on the grid state. If the user already set them then use the preset. 
     // If not, we have to measure the first element and get back a size which we're going to be using for the rest of the items.
-    auto gridState = GetAsGridState(context.LayoutState());
     gridState->EnsureElementSize(availableSize, context, m_minItemWidth, m_minItemHeight, m_itemsStretch, Orientation(), MinRowSpacing(), MinColumnSpacing());
 
-    auto desiredSize = GetFlowAlgorithm(context).Measure(
+    // All items share the same size, so the position of any item is a function of the number of items per line.
+    // Compute that once here and let every callback for this pass use the snapshot kept on the grid state,
+    // since a layout can be shared by several ItemsRepeaters.
+    gridState->Geometry(GetGeometry(availableSize, *gridState, context.ItemCount()));
+
+    auto desiredSize = gridState->FlowAlgorithm().Measure(
         availableSize,
         context,
         true, /* isWrapping*/
@@ -81,7 +88,8 @@ winrt::Size UniformGridLayout::ArrangeOverride(
     winrt::VirtualizingLayoutContext const& context,
     winrt::Size const& finalSize)
 {
-    auto value = GetFlowAlgorithm(context).Arrange(
+    auto gridState = GetAsGridState(context.LayoutState());
+    auto value = gridState->FlowAlgorithm().Arrange(
         finalSize,
         context,
         static_cast<FlowLayoutAlgorithm::LineAlignment>(m_itemsJustification),
@@ -94,11 +102,11 @@ void UniformGridLayout::OnItemsChangedCore(
     winrt::IInspectable const& source,
     winrt::NotifyCollectionChangedEventArgs const& args)
 {
-    GetFlowAlgorithm(context).OnItemsSourceChanged(source, args, context);
+    auto gridState = GetAsGridState(context.LayoutState());
+    gridState->FlowAlgorithm().OnItemsSourceChanged(source, args, context);
     // Always invalidate layout to keep the view accurate.
     InvalidateLayout();
 
-    auto gridState = GetAsGridState(context.LayoutState());
     gridState->ClearElementOnDataSourceChange(context, args);
 }
 #pragma endregion
@@ -123,28 +131,32 @@ bool UniformGridLayout::Algorithm_ShouldBreakLine(int /*index*/, double remainin
 }
 
 winrt::FlowLayoutAnchorInfo UniformGridLayout::Algorithm_GetAnchorForRealizationRect(
-    const winrt::Size & availableSize,
+    const winrt::Size & /*availableSize*/,
     const winrt::VirtualizingLayoutContext & context)
 {
     winrt::Rect bounds = winrt::Rect{ NAN, NAN, NAN, NAN };
     int anchorIndex = -1;
 
-    int itemsCount = context.ItemCount();
+    const auto gridState = GetAsGridState(context.LayoutState());
+    const auto& geometry = gridState->Geometry();
     auto realizationRect = context.RealizationRect();
-    if (itemsCount > 0 && realizationRect.*MajorSize() > 0)
+    if (geometry.ItemCount() > 0 && realizationRect.*MajorSize() > 0)
     {
-        const auto gridState = GetAsGridState(context.LayoutState());
         const auto lastExtent = gridState->FlowAlgorithm().LastExtent();
-        const int itemsPerLine = std::max(1, static_cast<int>(availableSize.*Minor() / GetMinorSizeWithSpacing(context)));
-        const double majorSize = (itemsCount / itemsPerLine) * GetMajorSizeWithSpacing(context);
+        const double majorSize = (geometry.ItemCount() / geometry.ItemsPerLine()) * geometry.MajorSizeWithSpacing();
         const double realizationWindowStartWithinExtent = realizationRect.*MajorStart() - lastExtent.*MajorStart();
         if ((realizationWindowStartWithinExtent + realizationRect.*MajorSize()) >= 0 && realizationWindowStartWithinExtent <= majorSize)
         {
-            const double offset = std::max(0.0f, realizationRect.*MajorStart() - lastExtent.*MajorStart());
-            const int anchorRowIndex = static_cast<int>(offset / GetMajorSizeWithSpacing(context));
-
-            anchorIndex = std::max(0, std::min(itemsCount - 1, anchorRowIndex * itemsPerLine));
-            bounds = GetLayoutRectForDataIndex(availableSize, anchorIndex, lastExtent, context);
+            int firstIndex = -1;
+            int lastIndex = -1;
+            geometry.GetIndexRangeInMajorWindow(
+                std::max(0.0, realizationWindowStartWithinExtent),
+                realizationWindowStartWithinExtent + realizationRect.*MajorSize(),
+                firstIndex,
+                lastIndex);
+
+            anchorIndex = std::max(0, std::min(geometry.ItemCount() - 1, firstIndex));
+            bounds = GetLayoutRectForDataIndex(anchorIndex, lastExtent, geometry);
         }
     }
 
@@ -165,11 +177,13 @@ winrt::FlowLayoutAnchorInfo UniformGridLayout::Algorithm_GetAnchorForTargetEleme
     int count = context.ItemCount();
     if (targetIndex >= 0 && targetIndex < count)
     {
-        int itemsPerLine = std::max(1, static_cast<int>(availableSize.*Minor() / GetMinorSizeWithSpacing(context)));
-        int indexOfFirstInLine = (targetIndex / itemsPerLine) * itemsPerLine;
+        // Targeting an element can happen before this pass' geometry snapshot exists (e.g. from MakeAnchor),
+        // so compute it for the size we are given.
+        const auto gridState = GetAsGridState(context.LayoutState());
+        const auto geometry = GetGeometry(availableSize, *gridState, count);
+        int indexOfFirstInLine = geometry.FirstIndexInLine(targetIndex);
         index = indexOfFirstInLine;
-        auto state = GetAsGridState(context.LayoutState());
-        offset = GetLayoutRectForDataIndex(availableSize, indexOfFirstInLine, state->FlowAlgorithm().LastExtent(), context).*MajorStart();
+        offset = GetLayoutRectForDataIndex(indexOfFirstInLine, gridState->FlowAlgorithm().LastExtent(), geometry).*MajorStart();
     }
 
     return winrt::FlowLayoutAnchorInfo
@@ -193,27 +207,22 @@ winrt::Rect UniformGridLayout::Algorithm_GetExtent(
 
     auto extent = winrt::Rect{};
 
-
-    // Constants
-    const int itemsCount = context.ItemCount();
-    const float availableSizeMinor = availableSize.*Minor();
-    const int itemsPerLine = std::max(1, std::isfinite(availableSizeMinor) ?
-        static_cast<int>(availableSizeMinor / GetMinorSizeWithSpacing(context)) : itemsCount);
-    const float lineSize = GetMajorSizeWithSpacing(context);
+    const auto gridState = GetAsGridState(context.LayoutState());
+    const auto& geometry = gridState->Geometry();
+    const int itemsCount = geometry.ItemCount();
+    const int itemsPerLine = geometry.ItemsPerLine();
+    const float lineSize = geometry.MajorSizeWithSpacing();
 
     if (itemsCount > 0)
     {
-        extent.*MinorSize() =
-            std::isfinite(availableSizeMinor) ?
-            availableSizeMinor :
-            std::max(0.0f, itemsCount * GetMinorSizeWithSpacing(context) - static_cast<float>(MinItemSpacing()));
-        extent.*MajorSize() = std::max(0.0f, (itemsCount / itemsPerLine) * lineSize - static_cast<float>(LineSpacing()));
+        extent.*MinorSize() = geometry.ExtentMinorSize(availableSize.*Minor());
+        extent.*MajorSize() = geometry.ExtentMajorSize();
 
         if (firstRealized)
         {
             MUX_ASSERT(lastRealized);
 
-            extent.*MajorStart() = firstRealizedLayoutBounds.*MajorStart() - (firstRealizedItemIndex / itemsPerLine) * lineSize;
+            extent.*MajorStart() = firstRealizedLayoutBounds.*MajorStart() - geometry.LineIndexOf(firstRealizedItemIndex) * lineSize;
             int remainingItems = itemsCount - lastRealizedItemIndex - 1;
             extent.*MajorSize() = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + (remainingItems / itemsPerLine) * lineSize;
         }
@@ -235,6 +244,34 @@ winrt::Rect UniformGridLayout::Algorithm_GetExtent(
 
 #pragma endregion
 
+int UniformGridLayout::GetNeighborIndex(
+    winrt::VirtualizingLayoutContext const& context,
+    int index,
+    winrt::FocusNavigationDirection direction,
+    bool isPageNavigation,
+    winrt::Size const& viewportSize)
+{
+    const auto layoutState = context.LayoutState();
+    if (!layoutState)
+    {
+        return -1;
+    }
+
+    const auto gridState = GetAsGridState(layoutState);
+    const auto& geometry = gridState->Geometry();
+    const int linesPerPage = isPageNavigation ?
+        FlowLayoutNavigation::GetLinesPerPage(viewportSize.*Major(), geometry.MajorSizeWithSpacing()) :
+        0;
+
+    return FlowLayoutNavigation::GetNeighborIndex(
+        index,
+        context.ItemCount(),
+        geometry.ItemsPerLine(),
+        direction,
+        GetScrollOrientation() == ScrollOrientation::Vertical,
+        linesPerPage);
+}
+
 void UniformGridLayout::OnPropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args)
 {
     auto property = args.Property();
@@ -247,14 +284,6 @@ void UniformGridLayout::OnPropertyChanged(const winrt::DependencyPropertyChanged
         ScrollOrientation scrollOrientation = (orientation == winrt::Orientation::Horizontal) ? ScrollOrientation::Vertical : ScrollOrientation::Horizontal;
         OrientationBasedMeasures::SetScrollOrientation(scrollOrientation);
     }
-    else if (property == s_MinColumnSpacingProperty)
-    {
-        m_minColumnSpacing = unbox_value<double>(args.NewValue());
-    }
-    else if (property == s_MinRowSpacingProperty)
-    {
-        m_minRowSpacing = unbox_value<double>(args.NewValue());
-    }
     else if (property == s_ItemsJustificationProperty)
     {
         m_itemsJustification = unbox_value<winrt::UniformGridLayoutItemsJustification>(args.NewValue());
@@ -277,42 +306,31 @@ void UniformGridLayout::OnPropertyChanged(const winrt::DependencyPropertyChanged
 
 #pragma region private helpers
 
-float UniformGridLayout::GetMinorSizeWithSpacing(winrt::VirtualizingLayoutContext const& context)
-{
-    auto minItemSpacing = MinItemSpacing();
-    auto gridState = GetAsGridState(context.LayoutState());
-    return GetScrollOrientation() == ScrollOrientation::Vertical ?
-        static_cast<float>(gridState->EffectiveItemWidth() + minItemSpacing) :
-        static_cast<float>(gridState->EffectiveItemHeight() + minItemSpacing);
-}
-
-float UniformGridLayout::GetMajorSizeWithSpacing(winrt::VirtualizingLayoutContext const& context)
+UniformGridLayoutGeometry UniformGridLayout::GetGeometry(
+    const winrt::Size& availableSize,
+    const UniformGridLayoutState& gridState,
+    int itemCount)
 {
-    auto lineSpacing = LineSpacing();
-    auto gridState = GetAsGridState(context.LayoutState());
-    return GetScrollOrientation() == ScrollOrientation::Vertical ?
-        static_cast<float>(gridState->EffectiveItemHeight() + lineSpacing) :
-        static_cast<float>(gridState->EffectiveItemWidth() + lineSpacing);
+    const bool isVertical = GetScrollOrientation() == ScrollOrientation::Vertical;
+    return UniformGridLayoutGeometry(
+        isVertical ? gridState.EffectiveItemWidth() : gridState.EffectiveItemHeight(),
+        isVertical ? gridState.EffectiveItemHeight() : gridState.EffectiveItemWidth(),
+        MinItemSpacing(),
+        LineSpacing(),
+        availableSize.*Minor(),
+        itemCount);
 }
 
 winrt::Rect UniformGridLayout::GetLayoutRectForDataIndex(
-    const winrt::Size& availableSize,
     int index,
-    const winrt::Rect& lastExtent, 
-    const winrt::VirtualizingLayoutContext& context)
+    const winrt::Rect& lastExtent,
+    const UniformGridLayoutGeometry& geometry)
 {
-    int itemsPerLine = std::max(1, static_cast<int>(availableSize.*Minor() / GetMinorSizeWithSpacing(context)));
-    int rowIndex = static_cast<int>(index / itemsPerLine);
-    int indexInRow = index - (rowIndex * itemsPerLine);
-
-    auto gridState = GetAsGridState(context.LayoutState());
-    winrt::Rect bounds = MinorMajorRect(
-        indexInRow * GetMinorSizeWithSpacing(context) + lastExtent.*MinorStart(),
-        rowIndex * GetMajorSizeWithSpacing(context) + lastExtent.*MajorStart(),
-        GetScrollOrientation() == ScrollOrientation::Vertical ? static_cast<float>(gridState->EffectiveItemWidth()) : static_cast<float>(gridState->EffectiveItemHeight()),
-        GetScrollOrientation() == ScrollOrientation::Vertical ? static_cast<float>(gridState->EffectiveItemHeight()) : static_cast<float>(gridState->EffectiveItemWidth()));
-
-    return bounds;
+    return MinorMajorRect(
+        geometry.MinorStartOf(index) + lastExtent.*MinorStart(),
+        geometry.MajorStartOf(index) + lastExtent.*MajorStart(),
+        geometry.ItemMinorSize(),
+        geometry.ItemMajorSize());
 }
 
 #pragma endregion
@@ -69,25 +69,26 @@ public:
         const winrt::VirtualizingLayoutContext& /*context*/)override {}
 #pragma endregion
 
+    int GetNeighborIndex(
+        winrt::VirtualizingLayoutContext const& context,
+        int index,
+        winrt::FocusNavigationDirection direction,
+        bool isPageNavigation,
+        winrt::Size const& viewportSize) override;
+
     void OnPropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args);
 
 private:
     // Methods
-    float GetMinorSizeWithSpacing(winrt::VirtualizingLayoutContext const& context);
-    float GetMajorSizeWithSpacing(winrt::VirtualizingLayoutContext const& context);
+    UniformGridLayoutGeometry GetGeometry(const winrt::Size& availableSize, const UniformGridLayoutState& gridState, int itemCount);
 
-    winrt::Rect GetLayoutRectForDataIndex(const winrt::Size& availableSize, int index, const winrt::Rect& lastExtent, const winrt::VirtualizingLayoutContext& context);
+    winrt::Rect GetLayoutRectForDataIndex(int index, const winrt::Rect& lastExtent, const UniformGridLayoutGeometry& geometry);
 
     winrt::com_ptr<UniformGridLayoutState> GetAsGridState(const winrt::IInspectable& state)
     {
         return winrt::get_self<UniformGridLayoutState>(state.as<winrt::UniformGridLayoutState>())->get_strong();
     }
 
-    ::FlowLayoutAlgorithm& GetFlowAlgorithm(const winrt::VirtualizingLayoutContext& context)
-    {
-        return GetAsGridState(context.LayoutState())->FlowAlgorithm();
-    }
-
     void InvalidateLayout()
     {
         __super::InvalidateMeasure();
@@ -95,20 +96,17 @@ private:
 
     double LineSpacing()
     {
-        return Orientation() == winrt::Orientation::Horizontal ? m_minRowSpacing: m_minColumnSpacing;
-
+        return Orientation() == winrt::Orientation::Horizontal ? MinRowSpacing() : MinColumnSpacing();
     }
 
     double MinItemSpacing()
     {
-        return Orientation() == winrt::Orientation::Horizontal ? m_minColumnSpacing: m_minRowSpacing;
+        return Orientation() == winrt::Orientation::Horizontal ? MinColumnSpacing() : MinRowSpacing();
     }
 
     // Fields
     double m_minItemWidth{NAN};
     double m_minItemHeight{NAN};
-    double m_minRowSpacing{};
-    double m_minColumnSpacing{};
     winrt::UniformGridLayoutItemsJustification m_itemsJustification{ winrt::UniformGridLayoutItemsJustification::Start };
     winrt::UniformGridLayoutItemsStretch m_itemsStretch{ winrt::UniformGridLayoutItemsStretch::None };
     // !!! WARNING !!!
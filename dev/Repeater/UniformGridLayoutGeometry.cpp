@@ -0,0 +1,83 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <pch.h>
+#include "UniformGridLayoutGeometry.h"
+
+UniformGridLayoutGeometry::UniformGridLayoutGeometry(
+    double itemMinorSize,
+    double itemMajorSize,
+    double minItemSpacing,
+    double lineSpacing,
+    float availableMinor,
+    int itemCount) :
+    m_itemMinorSize(static_cast<float>(itemMinorSize)),
+    m_itemMajorSize(static_cast<float>(itemMajorSize)),
+    m_minItemSpacing(static_cast<float>(minItemSpacing)),
+    m_lineSpacing(static_cast<float>(lineSpacing)),
+    m_minorSizeWithSpacing(static_cast<float>(itemMinorSize + minItemSpacing)),
+    m_majorSizeWithSpacing(static_cast<float>(itemMajorSize + lineSpacing)),
+    m_itemCount(itemCount)
+{
+    const bool canWrap = std::isfinite(availableMinor) && m_minorSizeWithSpacing > 0;
+    m_itemsPerLine = std::max(1, canWrap ? static_cast<int>(availableMinor / m_minorSizeWithSpacing) : itemCount);
+}
+
+bool UniformGridLayoutGeometry::operator==(const UniformGridLayoutGeometry& rhs) const
+{
+    return m_itemMinorSize == rhs.m_itemMinorSize &&
+        m_itemMajorSize == rhs.m_itemMajorSize &&
+        m_minItemSpacing == rhs.m_minItemSpacing &&
+        m_lineSpacing == rhs.m_lineSpacing &&
+        m_itemsPerLine == rhs.m_itemsPerLine &&
+        m_itemCount == rhs.m_itemCount;
+}
+
+int UniformGridLayoutGeometry::LineCount() const
+{
+    return (m_itemCount + m_itemsPerLine - 1) / m_itemsPerLine;
+}
+
+float UniformGridLayoutGeometry::MinorStartOf(int index) const
+{
+    const int indexInLine = index - FirstIndexInLine(index);
+    return indexInLine * m_minorSizeWithSpacing;
+}
+
+float UniformGridLayoutGeometry::MajorStartOf(int index) const
+{
+    return LineIndexOf(index) * m_majorSizeWithSpacing;
+}
+
+void UniformGridLayoutGeometry::GetIndexRangeInMajorWindow(double majorStart, double majorEnd, int& firstIndex, int& lastIndex) const
+{
+    firstIndex = -1;
+    lastIndex = -1;
+
+    const int lineCount = LineCount();
+    if (lineCount > 0 && m_majorSizeWithSpacing > 0 && majorEnd >= 0 && majorStart <= lineCount * m_majorSizeWithSpacing)
+    {
+        // A window starting exactly at the end of the extent still touches the last line.
+        const int firstLine = std::min(lineCount - 1, std::max(0, static_cast<int>(majorStart / m_majorSizeWithSpacing)));
+        const int lastLine = std::min(lineCount - 1, static_cast<int>(majorEnd / m_majorSizeWithSpacing));
+        if (firstLine <= lastLine)
+        {
+            firstIndex = std::min(m_itemCount - 1, firstLine * m_itemsPerLine);
+            lastIndex = std::min(m_itemCount - 1, (lastLine + 1) * m_itemsPerLine - 1);
+        }
+    }
+}
+
+float UniformGridLayoutGeometry::ExtentMinorSize(float availableMinor) const
+{
+    return std::isfinite(availableMinor) ?
+        availableMinor :
+        std::max(0.0f, m_itemCount * m_minorSizeWithSpacing - m_minItemSpacing);
+}
+
+float UniformGridLayoutGeometry::ExtentMajorSize() const
+{
+    // Matches the estimation FlowLayoutAlgorithm has always used for the grid: only full lines are accounted for,
+    // the realized range corrects the estimate once elements are laid out.
+    return std::max(0.0f, (m_itemCount / m_itemsPerLine) * m_majorSizeWithSpacing - m_lineSpacing);
+}
@@ -0,0 +1,56 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Closed-form geometry for UniformGridLayout. Since every item in the grid has the same size,
+// the line and position of any index is a simple function of the number of items per line.
+// All values are expressed in minor (non-virtualizing) and major (virtualizing) terms so that
+// this type has no dependency on the scroll orientation or on any XAML object.
+class UniformGridLayoutGeometry
+{
+public:
+    UniformGridLayoutGeometry() = default;
+    UniformGridLayoutGeometry(
+        double itemMinorSize,
+        double itemMajorSize,
+        double minItemSpacing,
+        double lineSpacing,
+        float availableMinor,
+        int itemCount);
+
+    bool operator==(const UniformGridLayoutGeometry& rhs) const;
+    bool operator!=(const UniformGridLayoutGeometry& rhs) const { return !(*this == rhs); }
+
+    int ItemCount() const { return m_itemCount; }
+    int ItemsPerLine() const { return m_itemsPerLine; }
+    int LineCount() const;
+    float ItemMinorSize() const { return m_itemMinorSize; }
+    float ItemMajorSize() const { return m_itemMajorSize; }
+    float MinorSizeWithSpacing() const { return m_minorSizeWithSpacing; }
+    float MajorSizeWithSpacing() const { return m_majorSizeWithSpacing; }
+
+    int LineIndexOf(int index) const { return index / m_itemsPerLine; }
+    int FirstIndexInLine(int index) const { return LineIndexOf(index) * m_itemsPerLine; }
+
+    // Offsets are relative to the start of the extent.
+    float MinorStartOf(int index) const;
+    float MajorStartOf(int index) const;
+
+    // Returns the inclusive range of indices whose lines intersect [majorStart, majorEnd].
+    // Both values are -1 if no line intersects the range.
+    void GetIndexRangeInMajorWindow(double majorStart, double majorEnd, int& firstIndex, int& lastIndex) const;
+
+    float ExtentMinorSize(float availableMinor) const;
+    float ExtentMajorSize() const;
+
+private:
+    float m_itemMinorSize{};
+    float m_itemMajorSize{};
+    float m_minItemSpacing{};
+    float m_lineSpacing{};
+    float m_minorSizeWithSpacing{};
+    float m_majorSizeWithSpacing{};
+    int m_itemsPerLine{ 1 };
+    int m_itemCount{};
+};
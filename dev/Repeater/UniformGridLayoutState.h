@@ -7,6 +7,7 @@
 
 #include "UniformGridLayoutState.g.h"
 #include "FlowLayoutAlgorithm.h"
+#include "UniformGridLayoutGeometry.h"
 
 class UniformGridLayoutState :
     public ReferenceTracker<UniformGridLayoutState, winrt::implementation::UniformGridLayoutStateT, winrt::composing>
@@ -18,8 +19,12 @@ public:
     void UninitializeForContext(const winrt::VirtualizingLayoutContext& context);
 
     ::FlowLayoutAlgorithm& FlowAlgorithm() { return m_flowAlgorithm; }
-    double EffectiveItemWidth() { return m_effectiveItemWidth; }
-    double EffectiveItemHeight() { return m_effectiveItemHeight; }
+    double EffectiveItemWidth() const { return m_effectiveItemWidth; }
+    double EffectiveItemHeight() const { return m_effectiveItemHeight; }
+
+    // Snapshot of the grid geometry for the current layout pass.
+    const UniformGridLayoutGeometry& Geometry() const { return m_geometry; }
+    void Geometry(const UniformGridLayoutGeometry& value) { m_geometry = value; }
 
     // If it's realized then we shouldn't be caching it
     void EnsureFirstElementOwnership(winrt::VirtualizingLayoutContext const& context);
@@ -39,6 +44,7 @@ private:
     ::FlowLayoutAlgorithm m_flowAlgorithm{ this };
     double m_effectiveItemWidth{ 0.0 };
     double m_effectiveItemHeight{ 0.0 };
+    UniformGridLayoutGeometry m_geometry{};
 
     void SetSize(const winrt::UIElement& UIElement,
         const double itemWidth,
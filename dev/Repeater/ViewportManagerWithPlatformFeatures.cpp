@@ -7,6 +7,7 @@
 #include "ViewportManagerWithPlatformFeatures.h"
 #include "ItemsRepeater.h"
 #include "layout.h"
+#include "RepeaterTestHooks.h"
 
 // Pixel delta by which to inflate the cache buffer on each side.  Rather than fill the entire
 // cache buffer all at once, we chunk the work to make the UI thread more responsive.  We inflate
@@ -120,10 +121,14 @@ winrt::Rect ViewportManagerWithPlatformFeatures::GetLayoutRealizationWindow() co
     auto realizationWindow = GetLayoutVisibleWindow();
     if (HasScroller())
     {
-        realizationWindow.X -= static_cast<float>(m_horizontalCacheBufferPerSide);
-        realizationWindow.Y -= static_cast<float>(m_verticalCacheBufferPerSide);
-        realizationWindow.Width += static_cast<float>(m_horizontalCacheBufferPerSide) * 2.0f;
-        realizationWindow.Height += static_cast<float>(m_verticalCacheBufferPerSide) * 2.0f;
+        double horizontalCacheBufferPerSide{};
+        double verticalCacheBufferPerSide{};
+        GetCacheBufferPerSide(horizontalCacheBufferPerSide, verticalCacheBufferPerSide);
+
+        realizationWindow.X -= static_cast<float>(horizontalCacheBufferPerSide);
+        realizationWindow.Y -= static_cast<float>(verticalCacheBufferPerSide);
+        realizationWindow.Width += static_cast<float>(horizontalCacheBufferPerSide) * 2.0f;
+        realizationWindow.Height += static_cast<float>(verticalCacheBufferPerSide) * 2.0f;
     }
 
     return realizationWindow;
@@ -177,6 +182,9 @@ void ViewportManagerWithPlatformFeatures::OnLayoutChanged(bool isVirtualizing)
     if (m_managingViewportDisabled)
     {
         m_effectiveViewportChangedRevoker.revoke();
+
+        // We no longer have a cache buffer to share.
+        DetachNestedViewportManagers();
     }
     else if (!m_effectiveViewportChangedRevoker)
     {
@@ -218,7 +226,9 @@ void ViewportManagerWithPlatformFeatures::OnOwnerArranged()
         // Bug 17411076: EffectiveViewport: registering for effective viewport in arrange should invalidate viewport
         // EnsureScroller();
 
-        if (HasScroller())
+        // Nested repeaters use the cache buffer of their parent repeater, which is
+        // responsible for growing it.
+        if (HasScroller() && !IsNested())
         {
             const double maximumHorizontalCacheBufferPerSide = m_maximumHorizontalCacheLength * m_visibleWindow.Width / 2.0;
             const double maximumVerticalCacheBufferPerSide = m_maximumVerticalCacheLength * m_visibleWindow.Height / 2.0;
@@ -363,6 +373,8 @@ void ViewportManagerWithPlatformFeatures::OnCompositionTargetRendering(const win
 
 void ViewportManagerWithPlatformFeatures::ResetScrollers()
 {
+    DetachFromParentViewportManager();
+    DetachNestedViewportManagers();
     m_scroller.set(nullptr);
     m_effectiveViewportChangedRevoker.revoke();
     m_ensuredScroller = false;
@@ -371,9 +383,11 @@ void ViewportManagerWithPlatformFeatures::ResetScrollers()
 void ViewportManagerWithPlatformFeatures::OnCacheBuildActionCompleted()
 {
     m_cacheBuildAction.set(nullptr);
+    RepeaterTestHooks::NotifyCacheBuildActionCompleted();
     if (!m_managingViewportDisabled)
     {
         m_owner->InvalidateMeasure();
+        InvalidateNestedViewportManagers();
     }
 }
 
@@ -402,6 +416,7 @@ void ViewportManagerWithPlatformFeatures::EnsureScroller()
     {
         ResetScrollers();
 
+        std::shared_ptr<ViewportManagerWithPlatformFeatures> parentViewportManager;
         auto parent = CachedVisualTreeHelpers::GetParent(*m_owner);
         while (parent)
         {
@@ -411,9 +426,24 @@ void ViewportManagerWithPlatformFeatures::EnsureScroller()
                 break;
             }
 
+            if (!parentViewportManager)
+            {
+                if (const auto parentRepeater = parent.try_as<winrt::ItemsRepeater>())
+                {
+                    // All the repeaters of the process use the same type of viewport manager.
+                    parentViewportManager = std::static_pointer_cast<ViewportManagerWithPlatformFeatures>(
+                        winrt::get_self<ItemsRepeater>(parentRepeater)->GetViewportManager());
+                }
+            }
+
             parent = CachedVisualTreeHelpers::GetParent(parent);
         }
 
+        if (m_scroller && parentViewportManager)
+        {
+            AttachToParentViewportManager(parentViewportManager);
+        }
+
         if (!m_scroller)
         {
             // We usually update the viewport in the post arrange handler. But, since we don't have
@@ -464,7 +494,7 @@ void ViewportManagerWithPlatformFeatures::ResetCacheBuffer()
     m_horizontalCacheBufferPerSide = 0.0;
     m_verticalCacheBufferPerSide = 0.0;
 
-    if (!m_managingViewportDisabled)
+    if (!m_managingViewportDisabled && !IsNested())
     {
         // We need to start building the realization buffer again.
         RegisterCacheBuildWork();
@@ -499,6 +529,97 @@ void ViewportManagerWithPlatformFeatures::RegisterCacheBuildWork()
     }
 }
 
+void ViewportManagerWithPlatformFeatures::GetCacheBufferPerSide(double& horizontalCacheBufferPerSide, double& verticalCacheBufferPerSide) const
+{
+    if (const auto parent = m_parentViewportManager.lock())
+    {
+        // The nested repeater gets the slice of its parent's cache buffer that it can use,
+        // without going over its own maximum cache length.
+        double parentHorizontalCacheBufferPerSide{};
+        double parentVerticalCacheBufferPerSide{};
+        parent->GetCacheBufferPerSide(parentHorizontalCacheBufferPerSide, parentVerticalCacheBufferPerSide);
+
+        horizontalCacheBufferPerSide = std::min(parentHorizontalCacheBufferPerSide, m_maximumHorizontalCacheLength * m_visibleWindow.Width / 2.0);
+        verticalCacheBufferPerSide = std::min(parentVerticalCacheBufferPerSide, m_maximumVerticalCacheLength * m_visibleWindow.Height / 2.0);
+    }
+    else
+    {
+        horizontalCacheBufferPerSide = m_horizontalCacheBufferPerSide;
+        verticalCacheBufferPerSide = m_verticalCacheBufferPerSide;
+    }
+}
+
+void ViewportManagerWithPlatformFeatures::AttachToParentViewportManager(std::shared_ptr<ViewportManagerWithPlatformFeatures> const& parent)
+{
+    // A parent that does not manage its viewport (non-virtualizing layout) has no cache buffer to share.
+    if (parent->m_managingViewportDisabled || !parent->HasScroller())
+    {
+        return;
+    }
+
+    m_parentViewportManager = parent;
+    parent->m_nestedViewportManagers.push_back(weak_from_this());
+
+    // Our own cache buffer is not used while we are nested.
+    m_horizontalCacheBufferPerSide = 0.0;
+    m_verticalCacheBufferPerSide = 0.0;
+}
+
+void ViewportManagerWithPlatformFeatures::DetachFromParentViewportManager()
+{
+    if (const auto parent = m_parentViewportManager.lock())
+    {
+        auto& nested = parent->m_nestedViewportManagers;
+        nested.erase(
+            std::remove_if(nested.begin(), nested.end(), [this](const auto& weakNested)
+            {
+                const auto nestedViewportManager = weakNested.lock();
+                return !nestedViewportManager || nestedViewportManager.get() == this;
+            }),
+            nested.end());
+    }
+
+    m_parentViewportManager.reset();
+}
+
+void ViewportManagerWithPlatformFeatures::DetachNestedViewportManagers()
+{
+    // The nested repeaters go back to looking for their scroller, and to their own cache buffer, on their next measure.
+    const auto nestedViewportManagers = std::move(m_nestedViewportManagers);
+    m_nestedViewportManagers.clear();
+
+    for (const auto& weakNested : nestedViewportManagers)
+    {
+        if (const auto nested = weakNested.lock())
+        {
+            nested->ResetScrollers();
+            nested->m_owner->InvalidateMeasure();
+        }
+    }
+}
+
+void ViewportManagerWithPlatformFeatures::InvalidateNestedViewportManagers()
+{
+    for (auto it = m_nestedViewportManagers.begin(); it != m_nestedViewportManagers.end();)
+    {
+        if (const auto nested = it->lock())
+        {
+            if (!nested->m_managingViewportDisabled)
+            {
+                nested->m_owner->InvalidateMeasure();
+            }
+
+            // Nested repeaters don't build their own cache, so we also take care of their nested repeaters.
+            nested->InvalidateNestedViewportManagers();
+            ++it;
+        }
+        else
+        {
+            it = m_nestedViewportManagers.erase(it);
+        }
+    }
+}
+
 void ViewportManagerWithPlatformFeatures::TryInvalidateMeasure()
 {
     // Don't invalidate measure if we have an invalid window.
@@ -13,7 +13,15 @@ class ItemsRepeater;
 // We also do not use the IRepeaterScrollingSurface internal API used by ViewManager.
 // Not that this class is used when built in the OS build (under wuxc) and ViewManager
 // is used when building in MUX to keep down level support.
-class ViewportManagerWithPlatformFeatures : public ViewportManager
+//
+// When a repeater is nested under another repeater inside the same scroller (for example
+// a grouped list), the nested repeater does not grow a cache buffer of its own. Instead it
+// realizes the slice of the outer repeater's cache buffer that overlaps with its own viewport
+// and the outer repeater invalidates its nested repeaters each time its cache grows. This way
+// N visible groups cost one cache build work item per tick instead of N.
+class ViewportManagerWithPlatformFeatures :
+    public ViewportManager,
+    public std::enable_shared_from_this<ViewportManagerWithPlatformFeatures>
 {
 public:
     ViewportManagerWithPlatformFeatures(ItemsRepeater* owner);
@@ -57,6 +65,12 @@ private:
     void ResetCacheBuffer();
     void ValidateCacheLength(double cacheLength);
     void RegisterCacheBuildWork();
+    void GetCacheBufferPerSide(double& horizontalCacheBufferPerSide, double& verticalCacheBufferPerSide) const;
+    bool IsNested() const { return !m_parentViewportManager.expired(); }
+    void AttachToParentViewportManager(std::shared_ptr<ViewportManagerWithPlatformFeatures> const& parent);
+    void DetachFromParentViewportManager();
+    void DetachNestedViewportManagers();
+    void InvalidateNestedViewportManagers();
     void TryInvalidateMeasure();
     winrt::Rect GetLayoutVisibleWindowDiscardAnchor() const;
 
@@ -95,6 +109,10 @@ private:
     double m_horizontalCacheBufferPerSide{};
     double m_verticalCacheBufferPerSide{};
 
+    // Budget sharing between nested repeaters.
+    std::weak_ptr<ViewportManagerWithPlatformFeatures> m_parentViewportManager;
+    std::vector<std::weak_ptr<ViewportManagerWithPlatformFeatures>> m_nestedViewportManagers;
+
     bool m_isBringIntoViewInProgress{false};
     // For non-virtualizing layouts, we do not need to keep
     // updating viewports and invalidating measure often. So when
@@ -21,4 +21,16 @@ public:
 
     virtual void OnItemsChangedCore(winrt::VirtualizingLayoutContext const& context, winrt::IInspectable const& source, winrt::NotifyCollectionChangedEventArgs const& args);
 #pragma endregion
+
+    // Returns the index of the item that directional navigation from index should reach, or -1 if
+    // the layout does not know. Used by ScrollViewer to navigate without a focus search over the realized tree.
+    virtual int GetNeighborIndex(
+        winrt::VirtualizingLayoutContext const& /*context*/,
+        int /*index*/,
+        winrt::FocusNavigationDirection /*direction*/,
+        bool /*isPageNavigation*/,
+        winrt::Size const& /*viewportSize*/)
+    {
+        return -1;
+    }
 };
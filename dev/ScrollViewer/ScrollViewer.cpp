@@ -11,6 +11,9 @@
 #include "FocusHelper.h"
 #include "RegUtil.h"
 #include "ScrollViewerTestHooks.h"
+#ifdef REPEATER_INCLUDED
+#include "ItemsRepeater.h"
+#endif
 
 // Change to 'true' to turn on debugging outputs in Output window
 bool ScrollViewerTrace::s_IsDebugOutputEnabled{ false };
@@ -2000,6 +2003,16 @@ void ScrollViewer::HandleKeyDownForXYNavigation(winrt::KeyRoutedEventArgs args)
         navigationDirection = FocusHelper::GetNavigationDirection(originalKey);
     }
 
+#ifdef REPEATER_INCLUDED
+    if (shouldProcessKeyEvent &&
+        navigationDirection != winrt::FocusNavigationDirection::None &&
+        TryNavigateWithinItemsRepeater(navigationDirection, isPageNavigation))
+    {
+        isHandled = true;
+        shouldProcessKeyEvent = false;
+    }
+#endif
+
     if (shouldProcessKeyEvent)
     {
         bool shouldScroll = false;
@@ -2185,6 +2198,113 @@ winrt::DependencyObject ScrollViewer::GetNextFocusCandidate(winrt::FocusNavigati
     return winrt::FocusManager::FindNextElement(focusDirection, findNextElementOptions);
 }
 
+#ifdef REPEATER_INCLUDED
+// When the content is an ItemsRepeater, its layout may be able to tell which item comes next in the navigation
+// direction without running a focus search over the realized tree. That item is realized on demand, focused and
+// brought into view in one step, so it does not matter whether it was realized or far away from the viewport.
+bool ScrollViewer::TryNavigateWithinItemsRepeater(winrt::FocusNavigationDirection navigationDirection, bool isPageNavigation)
+{
+    MUX_ASSERT(m_scroller != nullptr);
+    MUX_ASSERT(navigationDirection != winrt::FocusNavigationDirection::None);
+
+    if (!SharedHelpers::IsRS4OrHigher())
+    {
+        // UIElement::StartBringIntoView is not available.
+        return false;
+    }
+
+    auto scroller = m_scroller.get().as<winrt::Scroller>();
+    auto repeater = scroller.Content().try_as<winrt::ItemsRepeater>();
+
+    if (!repeater)
+    {
+        return false;
+    }
+
+    // Find the item of the repeater that has focus. Items of a nested repeater are navigated with the regular focus search.
+    winrt::UIElement focusedItem = nullptr;
+    auto current = winrt::FocusManager::GetFocusedElement().try_as<winrt::DependencyObject>();
+    while (current)
+    {
+        auto parent = CachedVisualTreeHelpers::GetParent(current);
+        if (parent == repeater)
+        {
+            focusedItem = current.try_as<winrt::UIElement>();
+            break;
+        }
+        if (parent.try_as<winrt::ItemsRepeater>())
+        {
+            return false;
+        }
+        current = parent;
+    }
+
+    if (!focusedItem)
+    {
+        return false;
+    }
+
+    const int index = repeater.GetElementIndex(focusedItem);
+    if (index < 0)
+    {
+        return false;
+    }
+
+    const float zoomFactor = scroller.ZoomFactor();
+    const winrt::Size viewportSize{
+        static_cast<float>(scroller.ActualWidth()) / zoomFactor,
+        static_cast<float>(scroller.ActualHeight()) / zoomFactor };
+    const int nextIndex = winrt::get_self<ItemsRepeater>(repeater)->GetNeighborIndex(index, navigationDirection, isPageNavigation, viewportSize);
+
+    if (nextIndex < 0)
+    {
+        return false;
+    }
+
+    SCROLLVIEWER_TRACE_VERBOSE(*this, TRACE_MSG_METH_INT_INT, METH_NAME, this, index, nextIndex);
+
+    auto nextItem = repeater.GetOrCreateElement(nextIndex);
+
+    // The item may just have been realized. Lay it out so that it can be brought into view.
+    nextItem.UpdateLayout();
+
+    winrt::DependencyObject focusTarget = nullptr;
+    if (auto control = nextItem.try_as<winrt::Control>())
+    {
+        if (control.IsTabStop() && control.IsEnabled())
+        {
+            focusTarget = control;
+        }
+    }
+
+    if (!focusTarget)
+    {
+        focusTarget = winrt::FocusManager::FindFirstFocusableElement(nextItem);
+    }
+
+    if (!focusTarget)
+    {
+        return false;
+    }
+
+    if (auto focusTargetAsControl = focusTarget.try_as<winrt::Control>())
+    {
+        focusTargetAsControl.Focus(winrt::FocusState::Keyboard);
+    }
+    else
+    {
+        winrt::FocusManager::TryFocusAsync(focusTarget, winrt::FocusState::Keyboard);
+    }
+
+    // Bring the whole item into view, after the focus change so that this request is the one the Scroller honors.
+    winrt::BringIntoViewOptions options;
+    options.AnimationDesired(SharedHelpers::IsAnimationsEnabled());
+    nextItem.StartBringIntoView(options);
+
+    return true;
+}
+#endif
+
 bool ScrollViewer::DoScrollForKey(winrt::VirtualKey key, double scrollProportion)
 {
     SCROLLVIEWER_TRACE_VERBOSE(*this, TRACE_MSG_METH_DBL_INT, METH_NAME, this, scrollProportion, static_cast<int>(key));
@@ -259,6 +259,9 @@ private:
     bool CanScrollInDirection(winrt::FocusNavigationDirection drection);
 
     winrt::DependencyObject GetNextFocusCandidate(winrt::FocusNavigationDirection direction, bool isPageNavigation);
+#ifdef REPEATER_INCLUDED
+    bool TryNavigateWithinItemsRepeater(winrt::FocusNavigationDirection direction, bool isPageNavigation);
+#endif
 
     static constexpr std::wstring_view s_rootPartName{ L"PART_Root"sv };
     static constexpr std::wstring_view s_scrollerPartName{ L"PART_Scroller"sv };
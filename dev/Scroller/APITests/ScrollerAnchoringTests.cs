@@ -5,6 +5,7 @@ using Common;
 using MUXControlsTestApp.Utilities;
 using System;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.Linq;
 using System.Threading;
 using Windows.UI;
@@ -35,6 +36,7 @@ using ItemsSourceView = Microsoft.UI.Xaml.Controls.ItemsSourceView;
 using RecyclingElementFactory = Microsoft.UI.Xaml.Controls.RecyclingElementFactory;
 using RecyclePool = Microsoft.UI.Xaml.Controls.RecyclePool;
 using UniformGridLayout = Microsoft.UI.Xaml.Controls.UniformGridLayout;
+using IRepeaterScrollingSurface = Microsoft.UI.Private.Controls.IRepeaterScrollingSurface;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
 {
@@ -801,6 +803,84 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             }
         }
 
+        [TestMethod]
+        [TestProperty("Description", "Measures the cost of layout passes that evaluate many registered anchor candidates (VerticalAnchorRatio=0.5).")]
+        public void AnchoringWithManyAnchorCandidates()
+        {
+            const int c_anchorCandidateCount = 500;
+            const int c_layoutPassCount = 50;
+
+            Scroller scroller = null;
+            StackPanel stackPanel = null;
+            AutoResetEvent scrollerLoadedEvent = new AutoResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                stackPanel = new StackPanel();
+                InsertStackPanelChild(stackPanel, 0 /*operationCount*/, 0 /*newIndex*/, c_anchorCandidateCount /*newCount*/);
+
+                scroller = new Scroller();
+                scroller.ContentOrientation = ContentOrientation.Vertical;
+                scroller.Width = c_defaultAnchoringUIScrollerConstrainedSize;
+                scroller.Height = c_defaultAnchoringUIScrollerNonConstrainedSize;
+                scroller.HorizontalAnchorRatio = double.NaN;
+                scroller.VerticalAnchorRatio = 0.5;
+                scroller.Content = stackPanel;
+                scroller.Loaded += (object sender, RoutedEventArgs e) =>
+                {
+                    scrollerLoadedEvent.Set();
+                };
+
+                var scrollingSurface = (IRepeaterScrollingSurface)(object)scroller;
+                foreach (UIElement child in stackPanel.Children)
+                {
+                    scrollingSurface.RegisterAnchorCandidate(child);
+                }
+
+                MUXControlsTestApp.App.TestContentRoot = scroller;
+            });
+
+            WaitForEvent("Waiting for Loaded event", scrollerLoadedEvent);
+
+            double verticalOffset = 0.0;
+
+            RunOnUIThread.Execute(() =>
+            {
+                verticalOffset = (scroller.ExtentHeight - scroller.Height) / 2.0;
+            });
+
+            ScrollTo(scroller, 0.0, verticalOffset, AnimationMode.Disabled, SnapPointsMode.Ignore, false /*hookViewChanged*/);
+
+            double initialVerticalOffset = 0.0;
+
+            RunOnUIThread.Execute(() =>
+            {
+                FrameworkElement firstChild = (FrameworkElement)stackPanel.Children[0];
+                initialVerticalOffset = scroller.VerticalOffset;
+
+                var stopwatch = Stopwatch.StartNew();
+                for (int layoutPass = 0; layoutPass < c_layoutPassCount; layoutPass++)
+                {
+                    firstChild.Height += 1.0;
+                    scroller.UpdateLayout();
+                }
+                stopwatch.Stop();
+
+                Log.Comment(string.Format("{0} layout passes with {1} anchor candidates, average cost {2:F4}ms",
+                    c_layoutPassCount,
+                    c_anchorCandidateCount,
+                    stopwatch.Elapsed.TotalMilliseconds / c_layoutPassCount));
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment("Expecting the anchored offset to follow the growth of the first child");
+                Verify.IsGreaterThan(scroller.VerticalOffset, initialVerticalOffset);
+            });
+        }
+
         [TestMethod]
         [TestProperty("Description", "Verifies VerticalOffset adjusts when inserting and removing items at the beginning (VerticalAnchorRatio=0.5).")]
         public void AnchoringAtRepeaterMiddle()
@@ -5,6 +5,7 @@ using Common;
 using Microsoft.UI.Private.Controls;
 using MUXControlsTestApp.Utilities;
 using System;
+using System.Diagnostics;
 using System.Numerics;
 using System.Threading;
 using Windows.UI.Composition;
@@ -1157,6 +1158,136 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             }
         }
 
+        [TestMethod]
+        [TestProperty("Description",
+            "Verifies the InteractionTracker boundaries computed from the content alignment snapshot for all alignment combinations.")]
+        public void ComputeBoundaryPositionsForAllAlignments()
+        {
+            HorizontalAlignment[] horizontalAlignments = { HorizontalAlignment.Left, HorizontalAlignment.Center, HorizontalAlignment.Right, HorizontalAlignment.Stretch };
+            VerticalAlignment[] verticalAlignments = { VerticalAlignment.Top, VerticalAlignment.Center, VerticalAlignment.Bottom, VerticalAlignment.Stretch };
+            Vector2[] unzoomedExtents = { new Vector2(0.0f, 0.0f), new Vector2(100.0f, 50.0f), new Vector2(600.0f, 400.0f) };
+            Vector2[] contentLayoutOffsets = { new Vector2(0.0f, 0.0f), new Vector2(12.5f, -20.0f) };
+            float[] zoomFactors = { 0.5f, 1.0f, 3.0f };
+            Vector2 viewport = new Vector2((float)c_defaultUIScrollerWidth, (float)c_defaultUIScrollerHeight);
+
+            RunOnUIThread.Execute(() =>
+            {
+                foreach (HorizontalAlignment horizontalAlignment in horizontalAlignments)
+                {
+                    foreach (VerticalAlignment verticalAlignment in verticalAlignments)
+                    {
+                        foreach (Vector2 unzoomedExtent in unzoomedExtents)
+                        {
+                            foreach (Vector2 contentLayoutOffset in contentLayoutOffsets)
+                            {
+                                foreach (float zoomFactor in zoomFactors)
+                                {
+                                    Vector2 minPosition;
+                                    Vector2 maxPosition;
+
+                                    ScrollerTestHooks.ComputeBoundaryPositions(
+                                        horizontalAlignment, verticalAlignment, unzoomedExtent, viewport, zoomFactor, contentLayoutOffset, out minPosition, out maxPosition);
+
+                                    Vector2 expectedMinPosition = new Vector2(
+                                        GetExpectedMinPosition(BiDirectionalAlignmentFromHorizontalAlignment(horizontalAlignment), unzoomedExtent.X, viewport.X, zoomFactor) + contentLayoutOffset.X,
+                                        GetExpectedMinPosition(BiDirectionalAlignmentFromVerticalAlignment(verticalAlignment), unzoomedExtent.Y, viewport.Y, zoomFactor) + contentLayoutOffset.Y);
+                                    Vector2 expectedMaxPosition = new Vector2(
+                                        GetExpectedMaxPosition(BiDirectionalAlignmentFromHorizontalAlignment(horizontalAlignment), unzoomedExtent.X, viewport.X, zoomFactor) + contentLayoutOffset.X,
+                                        GetExpectedMaxPosition(BiDirectionalAlignmentFromVerticalAlignment(verticalAlignment), unzoomedExtent.Y, viewport.Y, zoomFactor) + contentLayoutOffset.Y);
+
+                                    Verify.AreEqual(expectedMinPosition, minPosition,
+                                        $"MinPosition for {horizontalAlignment}/{verticalAlignment}, extent {unzoomedExtent}, zoomFactor {zoomFactor}, offset {contentLayoutOffset}");
+                                    Verify.AreEqual(expectedMaxPosition, maxPosition,
+                                        $"MaxPosition for {horizontalAlignment}/{verticalAlignment}, extent {unzoomedExtent}, zoomFactor {zoomFactor}, offset {contentLayoutOffset}");
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+        }
+
+        [TestMethod]
+        [TestProperty("Description",
+            "Changes the Scroller.Content alignment and verifies the InteractionTracker boundaries follow, then measures their evaluation cost.")]
+        public void BoundaryPositionsFollowContentAlignment()
+        {
+            const int c_evaluationCount = 10000;
+            Scroller scroller = null;
+            Rectangle rectangleScrollerContent = null;
+            AutoResetEvent scrollerLoadedEvent = new AutoResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                rectangleScrollerContent = new Rectangle();
+                scroller = new Scroller();
+
+                SetupDefaultUI(scroller, rectangleScrollerContent, scrollerLoadedEvent);
+
+                // Making the content smaller than the viewport once zoomed out so that all alignments result in distinct boundaries.
+                rectangleScrollerContent.Width = c_defaultUIScrollerWidth / 2.0;
+                rectangleScrollerContent.Height = c_defaultUIScrollerHeight * 2.0;
+            });
+
+            WaitForEvent("Waiting for Loaded event", scrollerLoadedEvent);
+
+            foreach (HorizontalAlignment horizontalAlignment in new HorizontalAlignment[] { HorizontalAlignment.Left, HorizontalAlignment.Center, HorizontalAlignment.Right, HorizontalAlignment.Stretch })
+            {
+                foreach (VerticalAlignment verticalAlignment in new VerticalAlignment[] { VerticalAlignment.Top, VerticalAlignment.Center, VerticalAlignment.Bottom, VerticalAlignment.Stretch })
+                {
+                    RunOnUIThread.Execute(() =>
+                    {
+                        Log.Comment($"Covering alignments {horizontalAlignment}/{verticalAlignment}");
+                        rectangleScrollerContent.HorizontalAlignment = horizontalAlignment;
+                        rectangleScrollerContent.VerticalAlignment = verticalAlignment;
+                    });
+
+                    IdleSynchronizer.Wait();
+
+                    RunOnUIThread.Execute(() =>
+                    {
+                        float contentLayoutOffsetX = 0.0f;
+                        float contentLayoutOffsetY = 0.0f;
+                        Vector2 expectedMinPosition;
+                        Vector2 expectedMaxPosition;
+
+                        ScrollerTestHooks.GetContentLayoutOffsetX(scroller, out contentLayoutOffsetX);
+                        ScrollerTestHooks.GetContentLayoutOffsetY(scroller, out contentLayoutOffsetY);
+                        ScrollerTestHooks.ComputeBoundaryPositions(
+                            horizontalAlignment,
+                            verticalAlignment,
+                            new Vector2((float)scroller.ExtentWidth, (float)scroller.ExtentHeight),
+                            new Vector2((float)scroller.ViewportWidth, (float)scroller.ViewportHeight),
+                            scroller.ZoomFactor,
+                            new Vector2(contentLayoutOffsetX, contentLayoutOffsetY),
+                            out expectedMinPosition,
+                            out expectedMaxPosition);
+
+                        Vector2 minPosition = ScrollerTestHooks.GetMinPosition(scroller);
+                        Vector2 maxPosition = ScrollerTestHooks.GetMaxPosition(scroller);
+                        Log.Comment($"MinPosition {minPosition}, MaxPosition {maxPosition}");
+
+                        Verify.AreEqual(expectedMinPosition, minPosition);
+                        Verify.AreEqual(expectedMaxPosition, maxPosition);
+                    });
+                }
+            }
+
+            RunOnUIThread.Execute(() =>
+            {
+                var stopwatch = Stopwatch.StartNew();
+                for (int evaluation = 0; evaluation < c_evaluationCount; evaluation++)
+                {
+                    ScrollerTestHooks.GetMinPosition(scroller);
+                }
+                stopwatch.Stop();
+
+                Log.Comment(string.Format("{0} boundary evaluations, average cost {1:F4}ms",
+                    c_evaluationCount,
+                    stopwatch.Elapsed.TotalMilliseconds / c_evaluationCount));
+            });
+        }
+
         private void ValidateContentWithConstrainedWidth(
             Compositor compositor,
             Scroller scroller,
@@ -1400,6 +1531,36 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             return delta;
         }
 
+        private float GetExpectedMinPosition(BiDirectionalAlignment alignment, float unzoomedExtent, float viewport, float zoomFactor)
+        {
+            float scrollableSize = unzoomedExtent * zoomFactor - viewport;
+
+            switch (alignment)
+            {
+                case BiDirectionalAlignment.Near:
+                    return 0.0f;
+                case BiDirectionalAlignment.Far:
+                    return Math.Min(0.0f, scrollableSize);
+                default:
+                    return Math.Min(0.0f, scrollableSize / 2.0f);
+            }
+        }
+
+        private float GetExpectedMaxPosition(BiDirectionalAlignment alignment, float unzoomedExtent, float viewport, float zoomFactor)
+        {
+            float scrollableSize = unzoomedExtent * zoomFactor - viewport;
+
+            switch (alignment)
+            {
+                case BiDirectionalAlignment.Near:
+                    return 0.0f;
+                case BiDirectionalAlignment.Far:
+                    return scrollableSize < 0.0f ? -scrollableSize : scrollableSize;
+                default:
+                    return scrollableSize < 0.0f ? scrollableSize / 2.0f : scrollableSize;
+            }
+        }
+
         private BiDirectionalAlignment BiDirectionalAlignmentFromHorizontalAlignment(HorizontalAlignment horizontalAlignment)
         {
             switch (horizontalAlignment)
@@ -39,6 +39,7 @@ using InputKind = Microsoft.UI.Xaml.Controls.InputKind;
 using Scroller = Microsoft.UI.Xaml.Controls.Primitives.Scroller;
 using AnimationMode = Microsoft.UI.Xaml.Controls.AnimationMode;
 using SnapPointsMode = Microsoft.UI.Xaml.Controls.SnapPointsMode;
+using ScrollerTestHooks = Microsoft.UI.Private.Controls.ScrollerTestHooks;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
 {
@@ -885,6 +886,44 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        [TestProperty("Description", "Verifies the policy deciding which scroll pattern percent changes are raised to UIA clients.")]
+        public void VerifyAutomationPercentChangePolicy()
+        {
+            const double noScroll = -1.0;
+            const double step = 1.0;
+
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment("Unchanged values are never raised.");
+                Verify.IsFalse(ScrollerTestHooks.ShouldRaiseAutomationPercentChanged(50.0, 50.0, false /*isViewChanging*/, step));
+                Verify.IsFalse(ScrollerTestHooks.ShouldRaiseAutomationPercentChanged(50.0, 50.0, true /*isViewChanging*/, step));
+
+                Log.Comment("Any change is raised while idle.");
+                Verify.IsTrue(ScrollerTestHooks.ShouldRaiseAutomationPercentChanged(50.0, 50.01, false /*isViewChanging*/, step));
+
+                Log.Comment("Small changes are skipped while the view changes.");
+                Verify.IsFalse(ScrollerTestHooks.ShouldRaiseAutomationPercentChanged(50.0, 50.5, true /*isViewChanging*/, step));
+                Verify.IsFalse(ScrollerTestHooks.ShouldRaiseAutomationPercentChanged(50.0, 49.5, true /*isViewChanging*/, step));
+                Verify.IsTrue(ScrollerTestHooks.ShouldRaiseAutomationPercentChanged(50.0, 51.0, true /*isViewChanging*/, step));
+                Verify.IsTrue(ScrollerTestHooks.ShouldRaiseAutomationPercentChanged(50.0, 48.0, true /*isViewChanging*/, step));
+                Verify.IsFalse(ScrollerTestHooks.ShouldRaiseAutomationPercentChanged(50.0, 54.0, true /*isViewChanging*/, 5.0));
+
+                Log.Comment("Reaching an end and scrollability changes are raised while the view changes.");
+                Verify.IsTrue(ScrollerTestHooks.ShouldRaiseAutomationPercentChanged(0.5, 0.0, true /*isViewChanging*/, step));
+                Verify.IsTrue(ScrollerTestHooks.ShouldRaiseAutomationPercentChanged(99.5, 100.0, true /*isViewChanging*/, step));
+                Verify.IsTrue(ScrollerTestHooks.ShouldRaiseAutomationPercentChanged(noScroll, 0.0, true /*isViewChanging*/, step));
+                Verify.IsTrue(ScrollerTestHooks.ShouldRaiseAutomationPercentChanged(30.0, noScroll, true /*isViewChanging*/, step));
+
+                Log.Comment("The default step can be overridden.");
+                double defaultStep = ScrollerTestHooks.AutomationPercentChangeStep;
+                Verify.AreEqual(step, defaultStep);
+                ScrollerTestHooks.AutomationPercentChangeStep = 10.0;
+                Verify.AreEqual(10.0, ScrollerTestHooks.AutomationPercentChangeStep);
+                ScrollerTestHooks.AutomationPercentChangeStep = defaultStep;
+            });
+        }
+
         private void SetupDefaultUI(
             Scroller scroller,
             Rectangle rectangleScrollerContent,
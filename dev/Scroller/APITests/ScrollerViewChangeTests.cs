@@ -806,6 +806,165 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        [TestProperty("Description", "Performs consecutive ScrollBy calls with AnimationMode.Retarget while the first animation is in flight and verifies their deltas accumulate.")]
+        public void ConsecutiveRetargetedOffsetsChanges()
+        {
+            if (PlatformConfiguration.IsOsVersion(OSVersion.Redstone5))
+            {
+                // The workaround for RS5 bug 18827625 interrupts the in-flight animation before the next one starts,
+                // so each ScrollBy is applied to the current view rather than to the in-flight target.
+                Log.Warning("Skipping test on RS5 where retargeted offsets changes do not accumulate.");
+                return;
+            }
+
+            const double c_horizontalOffsetDelta = 100.0;
+            const int c_operationCount = 3;
+            Scroller scroller = null;
+            Rectangle rectangleScrollerContent = null;
+            AutoResetEvent scrollerLoadedEvent = new AutoResetEvent(false);
+            AutoResetEvent[] scrollerViewChangeOperationEvents = new AutoResetEvent[c_operationCount];
+            ScrollerOperation[] operations = new ScrollerOperation[c_operationCount];
+
+            for (int operationIndex = 0; operationIndex < c_operationCount; operationIndex++)
+            {
+                scrollerViewChangeOperationEvents[operationIndex] = new AutoResetEvent(false);
+            }
+
+            RunOnUIThread.Execute(() =>
+            {
+                rectangleScrollerContent = new Rectangle();
+                scroller = new Scroller();
+
+                SetupDefaultUI(scroller, rectangleScrollerContent, scrollerLoadedEvent);
+            });
+
+            WaitForEvent("Waiting for Loaded event", scrollerLoadedEvent);
+
+            RunOnUIThread.Execute(() =>
+            {
+                int retargetedOperationCount = 1;
+
+                scroller.ViewChanged += (sender, args) =>
+                {
+                    Log.Comment($"ViewChanged - HorizontalOffset={sender.HorizontalOffset}, VerticalOffset={sender.VerticalOffset}, ZoomFactor={sender.ZoomFactor}");
+
+                    if (retargetedOperationCount < c_operationCount)
+                    {
+                        // Extend the in-flight animation.
+                        operations[retargetedOperationCount] = StartScrollBy(
+                            sender,
+                            c_horizontalOffsetDelta,
+                            0.0,
+                            AnimationMode.Retarget,
+                            SnapPointsMode.Ignore,
+                            scrollerViewChangeOperationEvents[retargetedOperationCount]);
+                        retargetedOperationCount++;
+                    }
+                };
+
+                operations[0] = StartScrollBy(
+                    scroller,
+                    c_horizontalOffsetDelta,
+                    0.0,
+                    AnimationMode.Retarget,
+                    SnapPointsMode.Ignore,
+                    scrollerViewChangeOperationEvents[0]);
+            });
+
+            for (int operationIndex = 0; operationIndex < c_operationCount; operationIndex++)
+            {
+                WaitForEvent("Waiting for view change completion", scrollerViewChangeOperationEvents[operationIndex]);
+            }
+
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment("Final HorizontalOffset={0}, VerticalOffset={1}, ZoomFactor={2}",
+                    scroller.HorizontalOffset, scroller.VerticalOffset, scroller.ZoomFactor);
+
+                Verify.AreEqual(c_horizontalOffsetDelta * c_operationCount, scroller.HorizontalOffset);
+                Verify.AreEqual(0.0, scroller.VerticalOffset);
+                Verify.AreEqual(1.0f, scroller.ZoomFactor);
+                Verify.AreEqual(ScrollerViewChangeResult.Interrupted, operations[0].Result);
+                Verify.AreEqual(ScrollerViewChangeResult.Interrupted, operations[1].Result);
+                Verify.AreEqual(ScrollerViewChangeResult.Completed, operations[2].Result);
+            });
+        }
+
+        [TestMethod]
+        [TestProperty("Description",
+            "Verifies the trajectories used by AnimationMode.Retarget animations: boundary values, velocity continuity across retargeting, absence of overshoot and constant jerk. Then measures their evaluation cost.")]
+        public void RetargetingCurveTrajectories()
+        {
+            const int c_sampleCount = 100;
+            const int c_evaluationCount = 10000;
+            const double c_tolerance = 0.0001;
+            const double c_proposedDuration = 500.0;
+            double[] startVelocities = { -2.0, -0.1, 0.0, 0.1, 0.5, 2.0 };
+            double[] endValues = { -300.0, 0.0, 20.0, 300.0 };
+
+            RunOnUIThread.Execute(() =>
+            {
+                foreach (double startVelocity in startVelocities)
+                {
+                    foreach (double endValue in endValues)
+                    {
+                        double value, velocity, acceleration, jerk;
+                        double initialJerk;
+                        double duration = ScrollerTestHooks.ComputeRetargetingCurveDuration(0.0, startVelocity, endValue, c_proposedDuration);
+                        string curveDescription = $"curve from 0 at velocity {startVelocity} to {endValue} in {duration}ms";
+
+                        Verify.IsTrue(duration > 0.0 && duration <= c_proposedDuration, $"Duration of {curveDescription}");
+
+                        ScrollerTestHooks.EvaluateRetargetingCurve(0.0, startVelocity, endValue, duration, 0.0, out value, out velocity, out acceleration, out initialJerk);
+                        Verify.IsTrue(Math.Abs(value) < c_tolerance, $"Start value of {curveDescription}");
+                        Verify.IsTrue(Math.Abs(velocity - startVelocity) < c_tolerance, $"Start velocity of {curveDescription}");
+
+                        // The curve is at rest from its duration on, sample it just before so that its polynomial is checked.
+                        ScrollerTestHooks.EvaluateRetargetingCurve(0.0, startVelocity, endValue, duration, duration * (1.0 - 1e-6), out value, out velocity, out acceleration, out jerk);
+                        Verify.IsTrue(Math.Abs(value - endValue) < c_tolerance, $"End value of {curveDescription}");
+                        Verify.IsTrue(Math.Abs(velocity) < c_tolerance, $"End velocity of {curveDescription}");
+
+                        for (int sample = 1; sample < c_sampleCount; sample++)
+                        {
+                            double time = duration * sample / c_sampleCount;
+
+                            ScrollerTestHooks.EvaluateRetargetingCurve(0.0, startVelocity, endValue, duration, time, out value, out velocity, out acceleration, out jerk);
+                            Verify.IsTrue(Math.Abs(jerk - initialJerk) < c_tolerance, $"Jerk of {curveDescription} at {time}ms");
+
+                            if (startVelocity * endValue > 0.0)
+                            {
+                                // Moving towards the end value, the curve must not overshoot it.
+                                Verify.IsTrue(Math.Abs(value) <= Math.Abs(endValue) + c_tolerance, $"Value {value} of {curveDescription} at {time}ms");
+                            }
+
+                            // Retargeting at this time starts a new curve at the same value and velocity.
+                            double retargetedValue, retargetedVelocity;
+                            double retargetedEndValue = endValue + 100.0;
+                            double retargetedDuration = ScrollerTestHooks.ComputeRetargetingCurveDuration(value, velocity, retargetedEndValue, c_proposedDuration);
+
+                            ScrollerTestHooks.EvaluateRetargetingCurve(value, velocity, retargetedEndValue, retargetedDuration, 0.0, out retargetedValue, out retargetedVelocity, out acceleration, out jerk);
+                            Verify.IsTrue(Math.Abs(retargetedValue - value) < c_tolerance, $"Retargeted value of {curveDescription} at {time}ms");
+                            Verify.IsTrue(Math.Abs(retargetedVelocity - velocity) < c_tolerance, $"Retargeted velocity of {curveDescription} at {time}ms");
+                        }
+                    }
+                }
+
+                var stopwatch = Stopwatch.StartNew();
+                for (int evaluation = 0; evaluation < c_evaluationCount; evaluation++)
+                {
+                    double value, velocity, acceleration, jerk;
+
+                    ScrollerTestHooks.EvaluateRetargetingCurve(0.0, 0.5, 300.0, c_proposedDuration, evaluation % c_proposedDuration, out value, out velocity, out acceleration, out jerk);
+                }
+                stopwatch.Stop();
+
+                Log.Comment(string.Format("{0} curve evaluations, average cost {1:F4}ms",
+                    c_evaluationCount,
+                    stopwatch.Elapsed.TotalMilliseconds / c_evaluationCount));
+            });
+        }
+
         [TestMethod]
         [TestProperty("Description", "Performs consecutive non-animated zoomFactor changes.")]
         public void ConsecutiveZoomFactorJumps()
@@ -981,6 +981,8 @@ void Scroller::IdleStateEntered(
 
     UpdateState(winrt::InteractionState::Idle);
 
+    ResetRetargetingCurves(args.RequestId());
+
     if (!m_interactionTrackerAsyncOperations.empty())
     {
         int32_t requestId = args.RequestId();
@@ -1117,6 +1119,8 @@ void Scroller::InertiaStateEntered(
         }
     }
 
+    ResetRetargetingCurves(-1 /*requestId*/);
+
     UpdateState(winrt::InteractionState::Inertia);
 }
 
@@ -1128,6 +1132,8 @@ void Scroller::InteractingStateEntered(
     // On pre-RS5 versions, turn off the SnapPointBase::s_isInertiaFromImpulse boolean parameters on the snap points' composition expressions.
     UpdateIsInertiaFromImpulse(false /*isInertiaFromImpulse*/);
 
+    ResetRetargetingCurves(-1 /*requestId*/);
+
     UpdateState(winrt::InteractionState::Interaction);
 
     if (!m_interactionTrackerAsyncOperations.empty())
@@ -1346,139 +1352,48 @@ void Scroller::ComputeMinMaxPositions(float zoomFactor, _Out_opt_ winrt::float2*
 {
     MUX_ASSERT(minPosition || maxPosition);
 
-    if (minPosition)
-    {
-        *minPosition = winrt::float2::zero();
-    }
-
-    if (maxPosition)
-    {
-        *maxPosition = winrt::float2::zero();
-    }
-
-    const winrt::UIElement content = Content();
-
-    if (!content)
-    {
-        return;
-    }
-
-    const winrt::FrameworkElement contentAsFE = content.try_as<winrt::FrameworkElement>();
-
-    if (!contentAsFE)
-    {
-        return;
-    }
-
-    const winrt::Visual scrollerVisual = winrt::ElementCompositionPreview::GetElementVisual(*this);
-    float minPosX = 0.0f;
-    float minPosY = 0.0f;
-    float maxPosX = 0.0f;
-    float maxPosY = 0.0f;
-    float extentWidth = static_cast<float>(m_unzoomedExtentWidth);
-    float extentHeight = static_cast<float>(m_unzoomedExtentHeight);
-
-    if (contentAsFE.HorizontalAlignment() == winrt::HorizontalAlignment::Center ||
-        contentAsFE.HorizontalAlignment() == winrt::HorizontalAlignment::Stretch)
-    {
-        float scrollableWidth = extentWidth * zoomFactor - scrollerVisual.Size().x;
-
-        if (minPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableWidth < 0, minPosX is scrollableWidth / 2 so it is centered at idle.
-            // When the zoomed content is larger than the viewport, scrollableWidth > 0, minPosX is 0.
-            minPosX = std::min(0.0f, scrollableWidth / 2.0f);
-        }
-
-        if (maxPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableWidth < 0, maxPosX is scrollableWidth / 2 so it is centered at idle.
-            // When the zoomed content is larger than the viewport, scrollableWidth > 0, maxPosX is scrollableWidth.
-            maxPosX = scrollableWidth;
-            if (maxPosX < 0.0f)
-            {
-                maxPosX /= 2.0f;
-            }
-        }
-    }
-    else if (contentAsFE.HorizontalAlignment() == winrt::HorizontalAlignment::Right)
-    {
-        float scrollableWidth = extentWidth * zoomFactor - scrollerVisual.Size().x;
-
-        if (minPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableWidth < 0, minPosX is scrollableWidth so it is right-aligned at idle.
-            // When the zoomed content is larger than the viewport, scrollableWidth > 0, minPosX is 0.
-            minPosX = std::min(0.0f, scrollableWidth);
-        }
+    const ScrollerBoundaryGeometry& boundaryGeometry = EnsureBoundaryGeometry();
+    // The Scroller visual size is still read on each call since XAML updates it outside of this Scroller's arrange pass.
+    const winrt::float2 viewport = boundaryGeometry.HasContent() ? m_scrollerVisual.Size() : winrt::float2::zero();
 
-        if (maxPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableWidth < 0, maxPosX is -scrollableWidth so it is right-aligned at idle.
-            // When the zoomed content is larger than the viewport, scrollableWidth > 0, maxPosX is scrollableWidth.
-            maxPosX = scrollableWidth;
-            if (maxPosX < 0.0f)
-            {
-                maxPosX *= -1.0f;
-            }
-        }
-    }
+    boundaryGeometry.ComputeMinMaxPositions(
+        winrt::float2(static_cast<float>(m_unzoomedExtentWidth), static_cast<float>(m_unzoomedExtentHeight)),
+        viewport,
+        zoomFactor,
+        winrt::float2(m_contentLayoutOffsetX, m_contentLayoutOffsetY),
+        minPosition,
+        maxPosition);
+}
 
-    if (contentAsFE.VerticalAlignment() == winrt::VerticalAlignment::Center ||
-        contentAsFE.VerticalAlignment() == winrt::VerticalAlignment::Stretch)
+// Returns the snapshot of the Content alignment used by ComputeMinMaxPositions, after refreshing it if needed.
+const ScrollerBoundaryGeometry& Scroller::EnsureBoundaryGeometry()
+{
+    // Content alignment changes are only listened to after TH2, so the snapshot is not reused on older versions.
+    if (!m_isBoundaryGeometryValid || SharedHelpers::IsTH2OrLower())
     {
-        float scrollableHeight = extentHeight * zoomFactor - scrollerVisual.Size().y;
+        m_boundaryGeometry = ScrollerBoundaryGeometry{};
 
-        if (minPosition)
+        if (const winrt::FrameworkElement contentAsFE = Content().try_as<winrt::FrameworkElement>())
         {
-            // When the zoomed content is smaller than the viewport, scrollableHeight < 0, minPosY is scrollableHeight / 2 so it is centered at idle.
-            // When the zoomed content is larger than the viewport, scrollableHeight > 0, minPosY is 0.
-            minPosY = std::min(0.0f, scrollableHeight / 2.0f);
-        }
+            m_boundaryGeometry = ScrollerBoundaryGeometry{
+                ScrollerBoundaryGeometry::AlignmentFrom(contentAsFE.HorizontalAlignment()),
+                ScrollerBoundaryGeometry::AlignmentFrom(contentAsFE.VerticalAlignment()) };
 
-        if (maxPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableHeight < 0, maxPosY is scrollableHeight / 2 so it is centered at idle.
-            // When the zoomed content is larger than the viewport, scrollableHeight > 0, maxPosY is scrollableHeight.
-            maxPosY = scrollableHeight;
-            if (maxPosY < 0.0f)
+            if (!m_scrollerVisual)
             {
-                maxPosY /= 2.0f;
+                m_scrollerVisual = winrt::ElementCompositionPreview::GetElementVisual(*this);
             }
         }
-    }
-    else if (contentAsFE.VerticalAlignment() == winrt::VerticalAlignment::Bottom)
-    {
-        float scrollableHeight = extentHeight * zoomFactor - scrollerVisual.Size().y;
-
-        if (minPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableHeight < 0, minPosY is scrollableHeight so it is bottom-aligned at idle.
-            // When the zoomed content is larger than the viewport, scrollableHeight > 0, minPosY is 0.
-            minPosY = std::min(0.0f, scrollableHeight);
-        }
 
-        if (maxPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableHeight < 0, maxPosY is -scrollableHeight so it is bottom-aligned at idle.
-            // When the zoomed content is larger than the viewport, scrollableHeight > 0, maxPosY is scrollableHeight.
-            maxPosY = scrollableHeight;
-            if (maxPosY < 0.0f)
-            {
-                maxPosY *= -1.0f;
-            }
-        }
+        m_isBoundaryGeometryValid = true;
     }
 
-    if (minPosition)
-    {
-        *minPosition = winrt::float2(minPosX + m_contentLayoutOffsetX, minPosY + m_contentLayoutOffsetY);
-    }
+    return m_boundaryGeometry;
+}
 
-    if (maxPosition)
-    {
-        *maxPosition = winrt::float2(maxPosX + m_contentLayoutOffsetX, maxPosY + m_contentLayoutOffsetY);
-    }
+void Scroller::InvalidateBoundaryGeometry()
+{
+    m_isBoundaryGeometryValid = false;
 }
 
 // Returns an InteractionTracker Position based on the provided offsets
@@ -3148,10 +3063,15 @@ winrt::hstring Scroller::GetMaxPositionYExpression(
 winrt::CompositionAnimation Scroller::GetPositionAnimation(
     double zoomedHorizontalOffset,
     double zoomedVerticalOffset,
+    winrt::AnimationMode const& animationMode,
     InteractionTrackerAsyncOperationTrigger operationTrigger,
-    int32_t offsetsChangeId)
+    int32_t offsetsChangeId,
+    _Out_ bool* followsOffsetsCurves)
 {
     MUX_ASSERT(m_interactionTracker);
+    MUX_ASSERT(followsOffsetsCurves);
+
+    *followsOffsetsCurves = false;
 
     int64_t minDuration = s_offsetsChangeMinMs;
     int64_t maxDuration = s_offsetsChangeMaxMs;
@@ -3176,10 +3096,63 @@ winrt::CompositionAnimation Scroller::GetPositionAnimation(
         unitDuration = unitDurationTestOverride;
     }
 
+    const int64_t duration = std::clamp(distance * unitDuration, minDuration, maxDuration);
+
+    if (animationMode == winrt::AnimationMode::Retarget)
+    {
+        // The retargeting curves come to rest at their end value, so they must not extend beyond the scrollable range.
+        zoomedHorizontalOffset = std::clamp(zoomedHorizontalOffset, 0.0, ScrollableWidth());
+        zoomedVerticalOffset = std::clamp(zoomedVerticalOffset, 0.0, ScrollableHeight());
+    }
+
     winrt::float2 endPosition = ComputePositionFromOffsets(zoomedHorizontalOffset, zoomedVerticalOffset);
 
-    positionAnimation.InsertKeyFrame(1.0f, winrt::float3(endPosition, 0.0f));
-    positionAnimation.Duration(winrt::TimeSpan::duration(std::clamp(distance * unitDuration, minDuration, maxDuration) * 10000));
+    if (animationMode == winrt::AnimationMode::Retarget)
+    {
+        double startHorizontalOffset = m_zoomedHorizontalOffset;
+        double startVerticalOffset = m_zoomedVerticalOffset;
+        double startHorizontalVelocity = 0.0;
+        double startVerticalVelocity = 0.0;
+
+        if (IsOffsetsCurveInFlight())
+        {
+            // Start the new curves at the current value and velocity of the in-flight ones.
+            const double time = GetRetargetingCurveTime(m_offsetsCurveStartTime);
+
+            startHorizontalOffset = m_horizontalOffsetCurve.ValueAt(time);
+            startVerticalOffset = m_verticalOffsetCurve.ValueAt(time);
+            startHorizontalVelocity = m_horizontalOffsetCurve.VelocityAt(time);
+            startVerticalVelocity = m_verticalOffsetCurve.VelocityAt(time);
+        }
+
+        // Both dimensions share the animation duration, so the shortest non-overshooting duration is used for both curves.
+        const double curveDuration = std::max(1.0, std::min(
+            ScrollerRetargetingCurve::ComputeDuration(startHorizontalOffset, startHorizontalVelocity, zoomedHorizontalOffset, static_cast<double>(duration)),
+            ScrollerRetargetingCurve::ComputeDuration(startVerticalOffset, startVerticalVelocity, zoomedVerticalOffset, static_cast<double>(duration))));
+
+        m_horizontalOffsetCurve = ScrollerRetargetingCurve(startHorizontalOffset, startHorizontalVelocity, zoomedHorizontalOffset, curveDuration);
+        m_verticalOffsetCurve = ScrollerRetargetingCurve(startVerticalOffset, startVerticalVelocity, zoomedVerticalOffset, curveDuration);
+        m_offsetsCurveStartTime = std::chrono::steady_clock::now();
+
+        const winrt::CompositionEasingFunction linearEasingFunction = compositor.CreateLinearEasingFunction();
+
+        for (int keyFrameIndex = 1; keyFrameIndex < s_retargetingKeyFrameCount; keyFrameIndex++)
+        {
+            const float progress = static_cast<float>(keyFrameIndex) / s_retargetingKeyFrameCount;
+            const double time = progress * curveDuration;
+            const winrt::float2 position = ComputePositionFromOffsets(m_horizontalOffsetCurve.ValueAt(time), m_verticalOffsetCurve.ValueAt(time));
+
+            positionAnimation.InsertKeyFrame(progress, winrt::float3(position, 0.0f), linearEasingFunction);
+        }
+
+        positionAnimation.InsertKeyFrame(1.0f, winrt::float3(endPosition, 0.0f), linearEasingFunction);
+        positionAnimation.Duration(winrt::TimeSpan::duration(static_cast<int64_t>(curveDuration * 10000)));
+    }
+    else
+    {
+        positionAnimation.InsertKeyFrame(1.0f, winrt::float3(endPosition, 0.0f));
+        positionAnimation.Duration(winrt::TimeSpan::duration(duration * 10000));
+    }
 
     winrt::float2 currentPosition{ m_interactionTracker.Position().x, m_interactionTracker.Position().y };
 
@@ -3201,17 +3174,33 @@ winrt::CompositionAnimation Scroller::GetPositionAnimation(
                 currentPosition,
                 customAnimation ? customAnimation : positionAnimation);
         }
-        return customAnimation ? customAnimation : positionAnimation;
+
+        if (customAnimation && customAnimation.as<winrt::IUnknown>() != positionAnimation.as<winrt::IUnknown>())
+        {
+            return customAnimation;
+        }
+        *followsOffsetsCurves = animationMode == winrt::AnimationMode::Retarget;
+        return positionAnimation;
     }
 
-    return RaiseScrollAnimationStarting(positionAnimation, currentPosition, endPosition, offsetsChangeId);
+    winrt::CompositionAnimation animation = RaiseScrollAnimationStarting(positionAnimation, currentPosition, endPosition, offsetsChangeId);
+
+    // The curves only describe the trajectory when the animation was not replaced by a ScrollAnimationStarting handler.
+    *followsOffsetsCurves = animationMode == winrt::AnimationMode::Retarget && animation && animation.as<winrt::IUnknown>() == positionAnimation.as<winrt::IUnknown>();
+    return animation;
 }
 
 winrt::CompositionAnimation Scroller::GetZoomFactorAnimation(
     float zoomFactor,
     const winrt::float2& centerPoint,
-    int32_t zoomFactorChangeId)
+    winrt::AnimationMode const& animationMode,
+    int32_t zoomFactorChangeId,
+    _Out_ bool* followsZoomFactorCurve)
 {
+    MUX_ASSERT(followsZoomFactorCurve);
+
+    *followsZoomFactorCurve = false;
+
     int64_t minDuration = s_zoomFactorChangeMinMs;
     int64_t maxDuration = s_zoomFactorChangeMaxMs;
     int64_t unitDuration = s_zoomFactorChangeMsPerUnit;
@@ -3233,10 +3222,85 @@ winrt::CompositionAnimation Scroller::GetZoomFactorAnimation(
         unitDuration = unitDurationTestOverride;
     }
 
-    zoomFactorAnimation.InsertKeyFrame(1.0f, zoomFactor);
-    zoomFactorAnimation.Duration(winrt::TimeSpan::duration(std::clamp(distance * unitDuration, minDuration, maxDuration) * 10000));
+    const int64_t duration = std::clamp(distance * unitDuration, minDuration, maxDuration);
+
+    if (animationMode == winrt::AnimationMode::Retarget)
+    {
+        // The retargeting curve comes to rest at its end value, so it must not extend beyond the zoom factor boundaries.
+        zoomFactor = std::clamp(zoomFactor, static_cast<float>(MinZoomFactor()), static_cast<float>(MaxZoomFactor()));
+
+        double startZoomFactor = m_zoomFactor;
+        double startZoomFactorVelocity = 0.0;
 
-    return RaiseZoomAnimationStarting(zoomFactorAnimation, zoomFactor, centerPoint, zoomFactorChangeId);
+        if (IsZoomFactorCurveInFlight(centerPoint))
+        {
+            // Start the new curve at the current value and velocity of the in-flight one.
+            const double time = GetRetargetingCurveTime(m_zoomFactorCurveStartTime);
+
+            startZoomFactor = m_zoomFactorCurve.ValueAt(time);
+            startZoomFactorVelocity = m_zoomFactorCurve.VelocityAt(time);
+        }
+
+        const double curveDuration = std::max(1.0,
+            ScrollerRetargetingCurve::ComputeDuration(startZoomFactor, startZoomFactorVelocity, zoomFactor, static_cast<double>(duration)));
+
+        m_zoomFactorCurve = ScrollerRetargetingCurve(startZoomFactor, startZoomFactorVelocity, zoomFactor, curveDuration);
+        m_zoomFactorCurveCenterPoint = centerPoint;
+        m_zoomFactorCurveStartTime = std::chrono::steady_clock::now();
+
+        const winrt::CompositionEasingFunction linearEasingFunction = compositor.CreateLinearEasingFunction();
+
+        for (int keyFrameIndex = 1; keyFrameIndex < s_retargetingKeyFrameCount; keyFrameIndex++)
+        {
+            const float progress = static_cast<float>(keyFrameIndex) / s_retargetingKeyFrameCount;
+
+            zoomFactorAnimation.InsertKeyFrame(progress, static_cast<float>(m_zoomFactorCurve.ValueAt(progress * curveDuration)), linearEasingFunction);
+        }
+
+        zoomFactorAnimation.InsertKeyFrame(1.0f, zoomFactor, linearEasingFunction);
+        zoomFactorAnimation.Duration(winrt::TimeSpan::duration(static_cast<int64_t>(curveDuration * 10000)));
+    }
+    else
+    {
+        zoomFactorAnimation.InsertKeyFrame(1.0f, zoomFactor);
+        zoomFactorAnimation.Duration(winrt::TimeSpan::duration(duration * 10000));
+    }
+
+    winrt::CompositionAnimation animation = RaiseZoomAnimationStarting(zoomFactorAnimation, zoomFactor, centerPoint, zoomFactorChangeId);
+
+    // The curve only describes the trajectory when the animation was not replaced by a ZoomAnimationStarting handler.
+    *followsZoomFactorCurve = animationMode == winrt::AnimationMode::Retarget && animation && animation.as<winrt::IUnknown>() == zoomFactorAnimation.as<winrt::IUnknown>();
+    return animation;
+}
+
+bool Scroller::IsOffsetsCurveInFlight() const
+{
+    return m_offsetsCurveRequestId != 0 && m_offsetsCurveRequestId == m_latestInteractionTrackerRequest;
+}
+
+bool Scroller::IsZoomFactorCurveInFlight(const winrt::float2& centerPoint) const
+{
+    return m_zoomFactorCurveRequestId != 0 && m_zoomFactorCurveRequestId == m_latestInteractionTrackerRequest && m_zoomFactorCurveCenterPoint == centerPoint;
+}
+
+// Stops tracking the retargeting curves of the provided InteractionTracker request, or of all requests when requestId is -1.
+void Scroller::ResetRetargetingCurves(int requestId)
+{
+    if (requestId == -1 || requestId == m_offsetsCurveRequestId)
+    {
+        m_offsetsCurveRequestId = 0;
+    }
+
+    if (requestId == -1 || requestId == m_zoomFactorCurveRequestId)
+    {
+        m_zoomFactorCurveRequestId = 0;
+    }
+}
+
+// Returns the number of milliseconds elapsed since the provided curve start time.
+double Scroller::GetRetargetingCurveTime(const std::chrono::steady_clock::time_point& startTime)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
 }
 
 int Scroller::GetNextViewChangeId()
@@ -4086,6 +4150,8 @@ void Scroller::OnContentPropertyChanged(const winrt::DependencyObject& /*sender*
         if (args == winrt::FrameworkElement::HorizontalAlignmentProperty() ||
             args == winrt::FrameworkElement::VerticalAlignmentProperty())
         {
+            InvalidateBoundaryGeometry();
+
             // The ExtentWidth and ExtentHeight may have to be updated because of this alignment change.
             InvalidateMeasure();
 
@@ -5314,6 +5380,7 @@ void Scroller::UpdateContent(
     children.Clear();
 
     UnhookContentPropertyChanged(oldContent);
+    InvalidateBoundaryGeometry();
 
     if (newContent)
     {
@@ -5457,6 +5524,13 @@ void Scroller::UpdateState(
     if (state != m_state)
     {
         m_state = state;
+
+        if (state == winrt::InteractionState::Idle)
+        {
+            // Automation notifications are throttled while the view changes. Raise the final values.
+            UpdateScrollAutomationPatternProperties();
+        }
+
         RaiseStateChanged();
     }
 }
@@ -5867,6 +5941,7 @@ void Scroller::ChangeOffsetsPrivate(
         break;
     }
     case winrt::AnimationMode::Enabled:
+    case winrt::AnimationMode::Retarget:
     {
         switch (offsetsKind)
         {
@@ -5924,7 +5999,7 @@ void Scroller::ChangeOffsetsPrivate(
 
         HookCompositionTargetRendering();
 
-        if (animationMode == winrt::AnimationMode::Enabled)
+        if (animationMode != winrt::AnimationMode::Disabled)
         {
             // Workaround for RS5 InteractionTracker bug 18827625: Interrupt on-going TryUpdatePositionWithAnimation
             // operation before launching new one.
@@ -6099,6 +6174,7 @@ void Scroller::ChangeZoomFactorPrivate(
             break;
         }
         case winrt::AnimationMode::Enabled:
+        case winrt::AnimationMode::Retarget:
         {
             switch (zoomFactorKind)
             {
@@ -6145,7 +6221,7 @@ void Scroller::ChangeZoomFactorPrivate(
 
         HookCompositionTargetRendering();
 
-        if (animationMode == winrt::AnimationMode::Enabled)
+        if (animationMode != winrt::AnimationMode::Disabled)
         {
             // Workaround for RS5 InteractionTracker bug 18827625: Interrupt on-going TryUpdateScaleWithAnimation
             // operation before launching new one.
@@ -6673,10 +6749,19 @@ void Scroller::ProcessOffsetsChange(
 #endif
         case ScrollerViewKind::RelativeToCurrentView:
         {
-            if (snapPointsMode == winrt::SnapPointsMode::Default || animationMode == winrt::AnimationMode::Enabled)
+            if (snapPointsMode == winrt::SnapPointsMode::Default || animationMode != winrt::AnimationMode::Disabled)
             {
-                zoomedHorizontalOffset += m_zoomedHorizontalOffset;
-                zoomedVerticalOffset += m_zoomedVerticalOffset;
+                if (animationMode == winrt::AnimationMode::Retarget && IsOffsetsCurveInFlight())
+                {
+                    // Extend the target of the in-flight animation rather than the current view.
+                    zoomedHorizontalOffset += m_horizontalOffsetCurve.EndValue();
+                    zoomedVerticalOffset += m_verticalOffsetCurve.EndValue();
+                }
+                else
+                {
+                    zoomedHorizontalOffset += m_zoomedHorizontalOffset;
+                    zoomedVerticalOffset += m_zoomedVerticalOffset;
+                }
             }
             break;
         }
@@ -6725,16 +6810,22 @@ void Scroller::ProcessOffsetsChange(
             break;
         }
         case winrt::AnimationMode::Enabled:
+        case winrt::AnimationMode::Retarget:
         {
             SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH_METH, METH_NAME, this, L"TryUpdatePositionWithAnimation");
 
+            bool followsOffsetsCurves = false;
+
             m_latestInteractionTrackerRequest = m_interactionTracker.TryUpdatePositionWithAnimation(
                 GetPositionAnimation(
                     zoomedHorizontalOffset,
                     zoomedVerticalOffset,
+                    animationMode,
                     operationTrigger,
-                    offsetsChangeId));
+                    offsetsChangeId,
+                    &followsOffsetsCurves));
             m_lastInteractionTrackerAsyncOperationType = InteractionTrackerAsyncOperationType::TryUpdatePositionWithAnimation;
+            m_offsetsCurveRequestId = followsOffsetsCurves ? m_latestInteractionTrackerRequest : 0;
             break;
         }
     }
@@ -6848,6 +6939,10 @@ void Scroller::ProcessZoomFactorChange(
     winrt::float2 centerPoint2D = nullableCenterPoint == nullptr ?
         winrt::float2(static_cast<float>(m_viewportWidth / 2.0), static_cast<float>(m_viewportHeight / 2.0)) : nullableCenterPoint.Value();
     winrt::float3 centerPoint(centerPoint2D.x - m_contentLayoutOffsetX, centerPoint2D.y - m_contentLayoutOffsetY, 0.0f);
+    winrt::AnimationMode animationMode = options ? options.AnimationMode() : ScrollOptions::s_defaultAnimationMode;
+    winrt::SnapPointsMode snapPointsMode = options ? options.SnapPointsMode() : ScrollOptions::s_defaultSnapPointsMode;
+
+    animationMode = GetComputedAnimationMode(animationMode);
 
     switch (viewKind)
     {
@@ -6860,16 +6955,19 @@ void Scroller::ProcessZoomFactorChange(
 #endif
         case ScrollerViewKind::RelativeToCurrentView:
         {
-            zoomFactor += m_zoomFactor;
+            if (animationMode == winrt::AnimationMode::Retarget && IsZoomFactorCurveInFlight(centerPoint2D))
+            {
+                // Extend the target of the in-flight animation rather than the current view.
+                zoomFactor += static_cast<float>(m_zoomFactorCurve.EndValue());
+            }
+            else
+            {
+                zoomFactor += m_zoomFactor;
+            }
             break;
         }
     }
 
-    winrt::AnimationMode animationMode = options ? options.AnimationMode() : ScrollOptions::s_defaultAnimationMode;
-    winrt::SnapPointsMode snapPointsMode = options ? options.SnapPointsMode() : ScrollOptions::s_defaultSnapPointsMode;
-
-    animationMode = GetComputedAnimationMode(animationMode);
-
     if (snapPointsMode == winrt::SnapPointsMode::Default)
     {
         zoomFactor = static_cast<float>(ComputeValueAfterSnapPoints<winrt::ZoomSnapPointBase>(zoomFactor, m_sortedConsolidatedZoomSnapPoints));
@@ -6892,13 +6990,17 @@ void Scroller::ProcessZoomFactorChange(
             break;
         }
         case winrt::AnimationMode::Enabled:
+        case winrt::AnimationMode::Retarget:
         {
             SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH_METH, METH_NAME, this, L"TryUpdateScaleWithAnimation");
 
+            bool followsZoomFactorCurve = false;
+
             m_latestInteractionTrackerRequest = m_interactionTracker.TryUpdateScaleWithAnimation(
-                GetZoomFactorAnimation(zoomFactor, centerPoint2D, zoomFactorChangeId),
+                GetZoomFactorAnimation(zoomFactor, centerPoint2D, animationMode, zoomFactorChangeId, &followsZoomFactorCurve),
                 centerPoint);
             m_lastInteractionTrackerAsyncOperationType = InteractionTrackerAsyncOperationType::TryUpdateScaleWithAnimation;
+            m_zoomFactorCurveRequestId = followsZoomFactorCurve ? m_latestInteractionTrackerRequest : 0;
             break;
         }
     }
@@ -7003,14 +7105,18 @@ bool Scroller::InterruptViewChangeWithAnimation(InteractionTrackerAsyncOperation
 
         int interruptionId = 0;
 
+        // The interrupted animation stops following its retargeting curve, if any, so the next
+        // AnimationMode::Retarget request starts at rest.
         if (interactionTrackerAsyncOperationType == InteractionTrackerAsyncOperationType::TryUpdatePositionWithAnimation)
         {
             interruptionId = m_interactionTracker.TryUpdatePositionBy(winrt::float3(0.0f));
+            m_offsetsCurveRequestId = 0;
         }
         else
         {
             MUX_ASSERT(interactionTrackerAsyncOperationType == InteractionTrackerAsyncOperationType::TryUpdateScaleWithAnimation);
             interruptionId = m_interactionTracker.TryUpdateScale(m_zoomFactor, winrt::float3(0.0f));
+            m_zoomFactorCurveRequestId = 0;
         }
 
         SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH_INT, METH_NAME, this, interruptionId);
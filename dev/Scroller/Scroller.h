@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "FloatUtil.h"
 #include "InteractionTrackerAsyncOperation.h"
 #include "ScrollAnimationStartingEventArgs.h"
@@ -11,6 +13,8 @@
 #include "ZoomCompletedEventArgs.h"
 #include "ScrollerBringingIntoViewEventArgs.h"
 #include "ScrollerAnchorRequestedEventArgs.h"
+#include "ScrollerBoundaryGeometry.h"
+#include "ScrollerRetargetingCurve.h"
 #include "SnapPointWrapper.h"
 #include "ScrollerTrace.h"
 #include "ViewChange.h"
@@ -75,6 +79,9 @@ public:
     static constexpr int s_zoomFactorChangeMinMs{ 50 };
     static constexpr int s_zoomFactorChangeMaxMs{ 1000 };
 
+    // Number of linear key frames approximating the ScrollerRetargetingCurve trajectories of AnimationMode::Retarget animations.
+    static constexpr int s_retargetingKeyFrameCount{ 16 };
+
     // Number of ticks ellapsed before restarting the Translation and Scale animations to allow the Content
     // rasterization to be triggered after the Idle State is reached or a zoom factor change operation completed.
     static constexpr int s_translationAndZoomFactorAnimationsRestartTicks = 4;
@@ -294,6 +301,8 @@ private:
     float ComputeEndOfInertiaZoomFactor() const;
     winrt::float2 ComputeEndOfInertiaPosition();
     void ComputeMinMaxPositions(float zoomFactor, _Out_opt_ winrt::float2* minPosition, _Out_opt_ winrt::float2* maxPosition);
+    const ScrollerBoundaryGeometry& EnsureBoundaryGeometry();
+    void InvalidateBoundaryGeometry();
     winrt::float2 ComputePositionFromOffsets(double zoomedHorizontalOffset, double zoomedVerticalOffset);
     template <typename T> double ComputeValueAfterSnapPoints(double value, std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>> const& snapPointsSet);
     winrt::float2 ComputeCenterPointerForMouseWheelZooming(const winrt::UIElement& content, const winrt::Point& pointerPosition) const;
@@ -555,12 +564,19 @@ private:
     winrt::CompositionAnimation GetPositionAnimation(
         double zoomedHorizontalOffset,
         double zoomedVerticalOffset,
+        winrt::AnimationMode const& animationMode,
         InteractionTrackerAsyncOperationTrigger operationTrigger,
-        int32_t offsetsChangeId);
+        int32_t offsetsChangeId,
+        _Out_ bool* followsOffsetsCurves);
     winrt::CompositionAnimation GetZoomFactorAnimation(
         float zoomFactor,
         const winrt::float2& centerPoint,
-        int32_t zoomFactorChangeId);
+        winrt::AnimationMode const& animationMode,
+        int32_t zoomFactorChangeId,
+        _Out_ bool* followsZoomFactorCurve);
+    bool IsOffsetsCurveInFlight() const;
+    bool IsZoomFactorCurveInFlight(const winrt::float2& centerPoint) const;
+    void ResetRetargetingCurves(int requestId);
     int GetNextViewChangeId();
 
     bool IsInertiaFromImpulse() const;
@@ -772,6 +788,7 @@ private:
 
     static winrt::AnimationMode GetComputedAnimationMode(
         winrt::AnimationMode const& animationMode);
+    static double GetRetargetingCurveTime(const std::chrono::steady_clock::time_point& startTime);
 
     static bool IsInteractionTrackerPointerWheelRedirectionEnabled();
     static bool IsVisualTranslationPropertyAvailable();
@@ -785,6 +802,17 @@ private:
     int m_latestViewChangeId{ 0 };
     int m_latestInteractionTrackerRequest{ 0 };
     InteractionTrackerAsyncOperationType m_lastInteractionTrackerAsyncOperationType{ InteractionTrackerAsyncOperationType::None };
+    // Trajectories of the last animations launched with AnimationMode::Retarget, in zoomed offsets and zoom factor.
+    // The m_offsetsCurveRequestId and m_zoomFactorCurveRequestId InteractionTracker request ids are 0 when those
+    // animations are no longer in flight.
+    ScrollerRetargetingCurve m_horizontalOffsetCurve{};
+    ScrollerRetargetingCurve m_verticalOffsetCurve{};
+    ScrollerRetargetingCurve m_zoomFactorCurve{};
+    winrt::float2 m_zoomFactorCurveCenterPoint{ 0.0f, 0.0f };
+    std::chrono::steady_clock::time_point m_offsetsCurveStartTime{};
+    std::chrono::steady_clock::time_point m_zoomFactorCurveStartTime{};
+    int m_offsetsCurveRequestId{ 0 };
+    int m_zoomFactorCurveRequestId{ 0 };
     winrt::float2 m_endOfInertiaPosition{ 0.0f, 0.0f };
     float m_animationRestartZoomFactor{ 1.0f };
     float m_endOfInertiaZoomFactor{ 1.0f };
@@ -797,6 +825,12 @@ private:
     double m_unzoomedExtentHeight{ 0.0 };
     double m_viewportWidth{ 0.0 };
     double m_viewportHeight{ 0.0 };
+
+    // Content alignment snapshot used by ComputeMinMaxPositions, refreshed lazily after a Content or alignment change
+    // so that the per-frame boundary evaluation does not need to query the Content.
+    ScrollerBoundaryGeometry m_boundaryGeometry{};
+    bool m_isBoundaryGeometryValid{ false };
+    winrt::Visual m_scrollerVisual{ nullptr };
     bool m_horizontalSnapPointsNeedViewportUpdates{ false }; // True when at least one horizontal snap point is not near aligned.
     bool m_verticalSnapPointsNeedViewportUpdates{ false }; // True when at least one vertical snap point is not near aligned.
     bool m_isAnchorElementDirty{ true }; // False when m_anchorElement is up-to-date, True otherwise.
@@ -55,7 +55,7 @@ void ScrollerAnchorRequestedEventArgs::SetAnchorCandidates(const std::vector<tra
 {
     winrt::IVector<winrt::UIElement> anchorCandidatesTmp = winrt::make<Vector<winrt::UIElement, MakeVectorParam<VectorFlag::DependencyObjectBase>()>>();
         
-    for (tracker_ref<winrt::UIElement> anchorCandidate : anchorCandidates)
+    for (const tracker_ref<winrt::UIElement>& anchorCandidate : anchorCandidates)
     {
         anchorCandidatesTmp.Append(anchorCandidate.get());
     }
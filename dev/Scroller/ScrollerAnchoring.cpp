@@ -388,7 +388,8 @@ void Scroller::EnsureAnchorElementSelection()
     }
     else
     {
-        for (tracker_ref<winrt::UIElement> anchorCandidateTracker : m_anchorCandidates)
+        // Iterate by reference: copying a tracker_ref creates, sets and deletes a tracker handle.
+        for (const tracker_ref<winrt::UIElement>& anchorCandidateTracker : m_anchorCandidates)
         {
             const winrt::UIElement anchorCandidate = anchorCandidateTracker.get();
 
@@ -0,0 +1,34 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "ScrollerAutomationNotificationPolicy.h"
+
+/* static */
+bool ScrollerAutomationNotificationPolicy::ShouldRaisePercentChanged(
+    double lastRaisedPercent,
+    double newPercent,
+    bool isViewChanging,
+    double percentChangeStep)
+{
+    if (newPercent == lastRaisedPercent)
+    {
+        return false;
+    }
+
+    if (!isViewChanging)
+    {
+        return true;
+    }
+
+    const double noScroll = winrt::ScrollPatternIdentifiers::NoScroll();
+
+    // Becoming scrollable or unscrollable, as well as reaching one end, is always worth a notification.
+    if (newPercent == noScroll || lastRaisedPercent == noScroll || newPercent <= 0.0 || newPercent >= 100.0)
+    {
+        return true;
+    }
+
+    return std::abs(newPercent - lastRaisedPercent) >= percentChangeStep;
+}
@@ -0,0 +1,19 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Decides which scroll pattern property changes ScrollerAutomationPeer raises to UIA clients.
+// While the view is changing (interaction, inertia or animation), a scroll percent or view size is
+// only raised once it moved by at least the given step away from the last raised value, or when it
+// reaches one end. Once the Scroller is idle again, any remaining difference is raised so that
+// clients end up with the exact final value.
+class ScrollerAutomationNotificationPolicy
+{
+public:
+    static bool ShouldRaisePercentChanged(
+        double lastRaisedPercent,
+        double newPercent,
+        bool isViewChanging,
+        double percentChangeStep);
+};
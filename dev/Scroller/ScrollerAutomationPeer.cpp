@@ -6,6 +6,8 @@
 #include "TypeLogging.h"
 #include "ScrollerTypeLogging.h"
 #include "ScrollerAutomationPeer.h"
+#include "ScrollerAutomationNotificationPolicy.h"
+#include "ScrollerTestHooksFactory.h"
 #include "ResourceAccessor.h"
 #include <UIAutomationCore.h>
 #include <UIAutomationCoreApi.h>
@@ -165,34 +167,28 @@ void ScrollerAutomationPeer::SetScrollPercent(double horizontalPercent, double v
     }
 }
 
+// The scroll percents and view sizes raised to UIA clients are throttled while the view changes,
+// so they are computed on demand rather than returned from the last raised values.
 double ScrollerAutomationPeer::HorizontalScrollPercent()
 {
-    MUX_ASSERT(m_horizontalScrollPercent == get_HorizontalScrollPercentImpl());
-
-    return m_horizontalScrollPercent;
+    return get_HorizontalScrollPercentImpl();
 }
 
 double ScrollerAutomationPeer::VerticalScrollPercent()
 {
-    MUX_ASSERT(m_verticalScrollPercent == get_VerticalScrollPercentImpl());
-
-    return m_verticalScrollPercent;
+    return get_VerticalScrollPercentImpl();
 }
 
 // Returns the horizontal percentage of the entire extent that is currently viewed.
 double ScrollerAutomationPeer::HorizontalViewSize()
 {
-    MUX_ASSERT(m_horizontalViewSize == get_HorizontalViewSizeImpl());
-
-    return m_horizontalViewSize;
+    return get_HorizontalViewSizeImpl();
 }
 
 // Returns the vertical percentage of the entire extent that is currently viewed.
 double ScrollerAutomationPeer::VerticalViewSize()
 {
-    MUX_ASSERT(m_verticalViewSize == get_VerticalViewSizeImpl());
-
-    return m_verticalViewSize;
+    return get_VerticalViewSizeImpl();
 }
 
 bool ScrollerAutomationPeer::HorizontallyScrollable()
@@ -214,6 +210,16 @@ void ScrollerAutomationPeer::UpdateScrollPatternProperties()
 {
     SCROLLER_TRACE_VERBOSE(Owner(), TRACE_MSG_METH, METH_NAME, this);
 
+    // While the view changes, percents are only raised when they moved by a noticeable step. The Scroller
+    // calls this method again when it becomes idle, at which point the exact values are raised.
+    const bool isViewChanging = GetScroller().State() != winrt::InteractionState::Idle;
+    double percentChangeStep = s_percentChangeStepDuringViewChange;
+
+    if (auto globalTestHooks = ScrollerTestHooks::GetGlobalTestHooks())
+    {
+        percentChangeStep = globalTestHooks->AutomationPercentChangeStep();
+    }
+
     double newHorizontalScrollPercent = get_HorizontalScrollPercentImpl();
     double newVerticalScrollPercent = get_VerticalScrollPercentImpl();
     double newHorizontalViewSize = get_HorizontalViewSizeImpl();
@@ -236,12 +242,12 @@ void ScrollerAutomationPeer::UpdateScrollPatternProperties()
         bool oldVerticallyScrollable = m_verticallyScrollable;
         m_verticallyScrollable = newVerticallyScrollable;
         RaisePropertyChangedEvent(
-            winrt::ScrollPatternIdentifiers::HorizontallyScrollableProperty(),
+            winrt::ScrollPatternIdentifiers::VerticallyScrollableProperty(),
             box_value(oldVerticallyScrollable).as<winrt::IReference<bool>>(),
             box_value(newVerticallyScrollable).as<winrt::IReference<bool>>());
     }
 
-    if (newHorizontalViewSize != m_horizontalViewSize)
+    if (ScrollerAutomationNotificationPolicy::ShouldRaisePercentChanged(m_horizontalViewSize, newHorizontalViewSize, isViewChanging, percentChangeStep))
     {
         double oldHorizontalViewSize = m_horizontalViewSize;
         m_horizontalViewSize = newHorizontalViewSize;
@@ -251,7 +257,7 @@ void ScrollerAutomationPeer::UpdateScrollPatternProperties()
             box_value(newHorizontalViewSize).as<winrt::IReference<double>>());
     }
 
-    if (newVerticalViewSize != m_verticalViewSize)
+    if (ScrollerAutomationNotificationPolicy::ShouldRaisePercentChanged(m_verticalViewSize, newVerticalViewSize, isViewChanging, percentChangeStep))
     {
         double oldVerticalViewSize = m_verticalViewSize;
         m_verticalViewSize = newVerticalViewSize;
@@ -261,7 +267,7 @@ void ScrollerAutomationPeer::UpdateScrollPatternProperties()
             box_value(newVerticalViewSize).as<winrt::IReference<double>>());
     }
 
-    if (newHorizontalScrollPercent != m_horizontalScrollPercent)
+    if (ScrollerAutomationNotificationPolicy::ShouldRaisePercentChanged(m_horizontalScrollPercent, newHorizontalScrollPercent, isViewChanging, percentChangeStep))
     {
         double oldHorizontalScrollPercent = m_horizontalScrollPercent;
         m_horizontalScrollPercent = newHorizontalScrollPercent;
@@ -271,7 +277,7 @@ void ScrollerAutomationPeer::UpdateScrollPatternProperties()
             box_value(newHorizontalScrollPercent).as<winrt::IReference<double>>());
     }
 
-    if (newVerticalScrollPercent != m_verticalScrollPercent)
+    if (ScrollerAutomationNotificationPolicy::ShouldRaisePercentChanged(m_verticalScrollPercent, newVerticalScrollPercent, isViewChanging, percentChangeStep))
     {
         double oldVerticalScrollPercent = m_verticalScrollPercent;
         m_verticalScrollPercent = newVerticalScrollPercent;
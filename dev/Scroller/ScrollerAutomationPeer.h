@@ -34,6 +34,9 @@ public:
 
     void UpdateScrollPatternProperties();
 
+    // Minimum change, in percent, of the scroll percents and view sizes raised while the view is changing.
+    static constexpr double s_percentChangeStepDuringViewChange{ 1.0 };
+
 private:
     double get_HorizontalScrollPercentImpl();
     double get_VerticalScrollPercentImpl();
@@ -49,6 +52,7 @@ private:
     static double GetScrollPercent(double zoomedExtent, double viewport, double offset);
 
 private:
+    // Last values raised to UIA clients.
     double m_horizontalScrollPercent{ winrt::ScrollPatternIdentifiers::NoScroll() };
     double m_verticalScrollPercent{ winrt::ScrollPatternIdentifiers::NoScroll() };
     double m_horizontalViewSize{ s_maximumPercent };
@@ -0,0 +1,124 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "ScrollerBoundaryGeometry.h"
+
+ScrollerBoundaryGeometry::ScrollerBoundaryGeometry(
+    ScrollerBoundaryAlignment horizontalAlignment,
+    ScrollerBoundaryAlignment verticalAlignment) :
+    m_horizontalAlignment(horizontalAlignment),
+    m_verticalAlignment(verticalAlignment),
+    m_hasContent(true)
+{
+}
+
+/* static */
+ScrollerBoundaryAlignment ScrollerBoundaryGeometry::AlignmentFrom(winrt::HorizontalAlignment horizontalAlignment)
+{
+    switch (horizontalAlignment)
+    {
+    case winrt::HorizontalAlignment::Left:
+        return ScrollerBoundaryAlignment::Near;
+    case winrt::HorizontalAlignment::Right:
+        return ScrollerBoundaryAlignment::Far;
+    default:
+        return ScrollerBoundaryAlignment::Center;
+    }
+}
+
+/* static */
+ScrollerBoundaryAlignment ScrollerBoundaryGeometry::AlignmentFrom(winrt::VerticalAlignment verticalAlignment)
+{
+    switch (verticalAlignment)
+    {
+    case winrt::VerticalAlignment::Top:
+        return ScrollerBoundaryAlignment::Near;
+    case winrt::VerticalAlignment::Bottom:
+        return ScrollerBoundaryAlignment::Far;
+    default:
+        return ScrollerBoundaryAlignment::Center;
+    }
+}
+
+void ScrollerBoundaryGeometry::ComputeMinMaxPositions(
+    const winrt::float2& unzoomedExtent,
+    const winrt::float2& viewport,
+    float zoomFactor,
+    const winrt::float2& contentLayoutOffset,
+    _Out_opt_ winrt::float2* minPosition,
+    _Out_opt_ winrt::float2* maxPosition) const
+{
+    MUX_ASSERT(minPosition || maxPosition);
+
+    if (!m_hasContent)
+    {
+        if (minPosition)
+        {
+            *minPosition = winrt::float2::zero();
+        }
+
+        if (maxPosition)
+        {
+            *maxPosition = winrt::float2::zero();
+        }
+        return;
+    }
+
+    float minPosX = 0.0f;
+    float minPosY = 0.0f;
+    float maxPosX = 0.0f;
+    float maxPosY = 0.0f;
+
+    ComputeMinMaxPosition(m_horizontalAlignment, unzoomedExtent.x, viewport.x, zoomFactor, minPosX, maxPosX);
+    ComputeMinMaxPosition(m_verticalAlignment, unzoomedExtent.y, viewport.y, zoomFactor, minPosY, maxPosY);
+
+    if (minPosition)
+    {
+        *minPosition = winrt::float2(minPosX + contentLayoutOffset.x, minPosY + contentLayoutOffset.y);
+    }
+
+    if (maxPosition)
+    {
+        *maxPosition = winrt::float2(maxPosX + contentLayoutOffset.x, maxPosY + contentLayoutOffset.y);
+    }
+}
+
+/* static */
+void ScrollerBoundaryGeometry::ComputeMinMaxPosition(
+    ScrollerBoundaryAlignment alignment,
+    float unzoomedExtent,
+    float viewport,
+    float zoomFactor,
+    float& minPosition,
+    float& maxPosition)
+{
+    minPosition = 0.0f;
+    maxPosition = 0.0f;
+
+    if (alignment == ScrollerBoundaryAlignment::Near)
+    {
+        return;
+    }
+
+    const float scrollableSize = unzoomedExtent * zoomFactor - viewport;
+
+    if (alignment == ScrollerBoundaryAlignment::Center)
+    {
+        // When the zoomed content is smaller than the viewport, scrollableSize < 0, both boundaries are scrollableSize / 2 so it is centered at idle.
+        // When the zoomed content is larger than the viewport, scrollableSize > 0, the boundaries are 0 and scrollableSize.
+        minPosition = std::min(0.0f, scrollableSize / 2.0f);
+        maxPosition = scrollableSize < 0.0f ? scrollableSize / 2.0f : scrollableSize;
+    }
+    else
+    {
+        MUX_ASSERT(alignment == ScrollerBoundaryAlignment::Far);
+
+        // When the zoomed content is smaller than the viewport, scrollableSize < 0, minPosition is scrollableSize and maxPosition
+        // is -scrollableSize so it is right/bottom-aligned at idle.
+        // When the zoomed content is larger than the viewport, scrollableSize > 0, the boundaries are 0 and scrollableSize.
+        minPosition = std::min(0.0f, scrollableSize);
+        maxPosition = scrollableSize < 0.0f ? -scrollableSize : scrollableSize;
+    }
+}
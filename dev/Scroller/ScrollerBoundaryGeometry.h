@@ -0,0 +1,55 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Alignment of the Scroller.Content within the viewport, as far as the InteractionTracker boundaries are concerned.
+// Stretch behaves like Center since a stretched content smaller than the viewport is centered once zoomed out.
+enum class ScrollerBoundaryAlignment
+{
+    Near,
+    Center,
+    Far
+};
+
+// Snapshot of the Scroller.Content properties that the InteractionTracker MinPosition and MaxPosition depend on.
+// The snapshot only changes when the Content or its alignment changes, so the per-frame boundary evaluation
+// is a pure function of the snapshot and of the current extent, viewport, zoom factor and content layout offsets.
+class ScrollerBoundaryGeometry
+{
+public:
+    // A default constructed geometry represents the absence of a FrameworkElement content: both boundaries are (0, 0).
+    ScrollerBoundaryGeometry() = default;
+    ScrollerBoundaryGeometry(
+        ScrollerBoundaryAlignment horizontalAlignment,
+        ScrollerBoundaryAlignment verticalAlignment);
+
+    static ScrollerBoundaryAlignment AlignmentFrom(winrt::HorizontalAlignment horizontalAlignment);
+    static ScrollerBoundaryAlignment AlignmentFrom(winrt::VerticalAlignment verticalAlignment);
+
+    bool HasContent() const { return m_hasContent; }
+    ScrollerBoundaryAlignment HorizontalAlignment() const { return m_horizontalAlignment; }
+    ScrollerBoundaryAlignment VerticalAlignment() const { return m_verticalAlignment; }
+
+    // Returns zoomed vectors corresponding to InteractionTracker.MinPosition and InteractionTracker.MaxPosition.
+    void ComputeMinMaxPositions(
+        const winrt::float2& unzoomedExtent,
+        const winrt::float2& viewport,
+        float zoomFactor,
+        const winrt::float2& contentLayoutOffset,
+        _Out_opt_ winrt::float2* minPosition,
+        _Out_opt_ winrt::float2* maxPosition) const;
+
+private:
+    static void ComputeMinMaxPosition(
+        ScrollerBoundaryAlignment alignment,
+        float unzoomedExtent,
+        float viewport,
+        float zoomFactor,
+        float& minPosition,
+        float& maxPosition);
+
+    ScrollerBoundaryAlignment m_horizontalAlignment{ ScrollerBoundaryAlignment::Near };
+    ScrollerBoundaryAlignment m_verticalAlignment{ ScrollerBoundaryAlignment::Near };
+    bool m_hasContent{ false };
+};
@@ -0,0 +1,100 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "ScrollerRetargetingCurve.h"
+
+ScrollerRetargetingCurve::ScrollerRetargetingCurve(
+    double startValue,
+    double startVelocity,
+    double endValue,
+    double duration) :
+    m_startValue(startValue),
+    m_startVelocity(startVelocity),
+    m_endValue(endValue),
+    m_duration(std::max(0.0, duration))
+{
+    if (m_duration > 0.0)
+    {
+        // Cubic Hermite segment with a null end velocity:
+        // value(t) = startValue + startVelocity * t + quadraticCoefficient * t^2 + cubicCoefficient * t^3
+        const double distance = m_endValue - m_startValue;
+
+        m_quadraticCoefficient = (3.0 * distance - 2.0 * m_startVelocity * m_duration) / (m_duration * m_duration);
+        m_cubicCoefficient = (m_startVelocity * m_duration - 2.0 * distance) / (m_duration * m_duration * m_duration);
+    }
+    else
+    {
+        m_startValue = m_endValue;
+        m_startVelocity = 0.0;
+    }
+}
+
+/* static */
+double ScrollerRetargetingCurve::ComputeDuration(
+    double startValue,
+    double startVelocity,
+    double endValue,
+    double proposedDuration)
+{
+    const double distance = endValue - startValue;
+
+    // When moving towards endValue, the cubic only stays monotonic while startVelocity * duration <= 3 * distance.
+    if (distance * startVelocity > 0.0 && startVelocity * proposedDuration > 3.0 * distance)
+    {
+        return 3.0 * distance / startVelocity;
+    }
+    return proposedDuration;
+}
+
+ScrollerRetargetingCurve ScrollerRetargetingCurve::Retarget(
+    double time,
+    double endValue,
+    double duration) const
+{
+    return ScrollerRetargetingCurve(ValueAt(time), VelocityAt(time), endValue, duration);
+}
+
+double ScrollerRetargetingCurve::ValueAt(double time) const
+{
+    if (IsAtRest(time))
+    {
+        return m_endValue;
+    }
+
+    time = std::max(0.0, time);
+    return m_startValue + time * (m_startVelocity + time * (m_quadraticCoefficient + time * m_cubicCoefficient));
+}
+
+double ScrollerRetargetingCurve::VelocityAt(double time) const
+{
+    if (IsAtRest(time))
+    {
+        return 0.0;
+    }
+
+    time = std::max(0.0, time);
+    return m_startVelocity + time * (2.0 * m_quadraticCoefficient + time * 3.0 * m_cubicCoefficient);
+}
+
+double ScrollerRetargetingCurve::AccelerationAt(double time) const
+{
+    if (IsAtRest(time))
+    {
+        return 0.0;
+    }
+
+    time = std::max(0.0, time);
+    return 2.0 * m_quadraticCoefficient + time * 6.0 * m_cubicCoefficient;
+}
+
+double ScrollerRetargetingCurve::JerkAt(double time) const
+{
+    if (IsAtRest(time))
+    {
+        return 0.0;
+    }
+
+    return 6.0 * m_cubicCoefficient;
+}
@@ -0,0 +1,57 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// One-dimensional trajectory used by animated view changes launched with AnimationMode::Retarget.
+// The curve is a cubic that starts at StartValue with StartVelocity and comes to rest at EndValue after Duration.
+// Retargeting an in-flight curve starts the new curve at the current value and velocity of the old one, so
+// the velocity stays continuous across consecutive requests. Times are in milliseconds, velocities in units per millisecond.
+// This type has no dependency on the InteractionTracker or on any XAML object.
+class ScrollerRetargetingCurve
+{
+public:
+    // A default constructed curve is at rest at 0.
+    ScrollerRetargetingCurve() = default;
+    ScrollerRetargetingCurve(
+        double startValue,
+        double startVelocity,
+        double endValue,
+        double duration);
+
+    // Returns the proposed duration, shortened when needed so that a curve starting at startVelocity
+    // towards endValue does not overshoot it.
+    static double ComputeDuration(
+        double startValue,
+        double startVelocity,
+        double endValue,
+        double proposedDuration);
+
+    // Returns a curve starting at this curve's value and velocity at the provided time, and coming to rest at endValue.
+    ScrollerRetargetingCurve Retarget(
+        double time,
+        double endValue,
+        double duration) const;
+
+    double StartValue() const { return m_startValue; }
+    double StartVelocity() const { return m_startVelocity; }
+    double EndValue() const { return m_endValue; }
+    double Duration() const { return m_duration; }
+
+    // Times before 0 are evaluated at 0. From Duration on, the curve is at rest at EndValue.
+    double ValueAt(double time) const;
+    double VelocityAt(double time) const;
+    double AccelerationAt(double time) const;
+    double JerkAt(double time) const;
+
+private:
+    bool IsAtRest(double time) const { return time >= m_duration; }
+
+    double m_startValue{};
+    double m_startVelocity{};
+    double m_endValue{};
+    double m_duration{};
+    // Coefficients of the t^2 and t^3 terms.
+    double m_quadraticCoefficient{};
+    double m_cubicCoefficient{};
+};
@@ -5,6 +5,9 @@
 #include "common.h"
 #include "ScrollerTestHooksFactory.h"
 #include "Vector.h"
+#include "ScrollerAutomationNotificationPolicy.h"
+#include "ScrollerBoundaryGeometry.h"
+#include "ScrollerRetargetingCurve.h"
 
 com_ptr<ScrollerTestHooks> ScrollerTestHooks::s_testHooks{};
 
@@ -130,6 +133,23 @@ void ScrollerTestHooks::MouseWheelInertiaDecayRate(float mouseWheelInertiaDecayR
     hooks->m_mouseWheelInertiaDecayRate = mouseWheelInertiaDecayRate;
 }
 
+double ScrollerTestHooks::AutomationPercentChangeStep()
+{
+    auto hooks = EnsureGlobalTestHooks();
+    return hooks->m_automationPercentChangeStep;
+}
+
+void ScrollerTestHooks::AutomationPercentChangeStep(double automationPercentChangeStep)
+{
+    auto hooks = EnsureGlobalTestHooks();
+    hooks->m_automationPercentChangeStep = automationPercentChangeStep;
+}
+
+bool ScrollerTestHooks::ShouldRaiseAutomationPercentChanged(double lastRaisedPercent, double newPercent, bool isViewChanging, double percentChangeStep)
+{
+    return ScrollerAutomationNotificationPolicy::ShouldRaisePercentChanged(lastRaisedPercent, newPercent, isViewChanging, percentChangeStep);
+}
+
 void ScrollerTestHooks::GetOffsetsChangeVelocityParameters(int& millisecondsPerUnit, int& minMilliseconds, int& maxMilliseconds)
 {
     auto hooks = EnsureGlobalTestHooks();
@@ -229,6 +249,51 @@ winrt::float2 ScrollerTestHooks::GetMaxPosition(const winrt::Scroller& scroller)
     return winrt::float2{ 0.0f, 0.0f };
 }
 
+void ScrollerTestHooks::ComputeBoundaryPositions(
+    const winrt::HorizontalAlignment& horizontalAlignment,
+    const winrt::VerticalAlignment& verticalAlignment,
+    const winrt::float2& unzoomedExtent,
+    const winrt::float2& viewport,
+    float zoomFactor,
+    const winrt::float2& contentLayoutOffset,
+    winrt::float2& minPosition,
+    winrt::float2& maxPosition)
+{
+    const ScrollerBoundaryGeometry boundaryGeometry{
+        ScrollerBoundaryGeometry::AlignmentFrom(horizontalAlignment),
+        ScrollerBoundaryGeometry::AlignmentFrom(verticalAlignment) };
+
+    boundaryGeometry.ComputeMinMaxPositions(unzoomedExtent, viewport, zoomFactor, contentLayoutOffset, &minPosition, &maxPosition);
+}
+
+double ScrollerTestHooks::ComputeRetargetingCurveDuration(
+    double startValue,
+    double startVelocity,
+    double endValue,
+    double proposedDuration)
+{
+    return ScrollerRetargetingCurve::ComputeDuration(startValue, startVelocity, endValue, proposedDuration);
+}
+
+void ScrollerTestHooks::EvaluateRetargetingCurve(
+    double startValue,
+    double startVelocity,
+    double endValue,
+    double duration,
+    double time,
+    double& value,
+    double& velocity,
+    double& acceleration,
+    double& jerk)
+{
+    const ScrollerRetargetingCurve curve{ startValue, startVelocity, endValue, duration };
+
+    value = curve.ValueAt(time);
+    velocity = curve.VelocityAt(time);
+    acceleration = curve.AccelerationAt(time);
+    jerk = curve.JerkAt(time);
+}
+
 winrt::ScrollerViewChangeResult ScrollerTestHooks::GetScrollCompletedResult(const winrt::ScrollCompletedEventArgs& scrollCompletedEventArgs)
 {
     if (scrollCompletedEventArgs)
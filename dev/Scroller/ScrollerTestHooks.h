@@ -4,6 +4,7 @@
 #pragma once
 
 #include "Scroller.h"
+#include "ScrollerAutomationPeer.h"
 #include "ScrollerTestHooksAnchorEvaluatedEventArgs.h"
 #include "ScrollerTestHooksInteractionSourcesChangedEventArgs.h"
 #include "ScrollerTestHooksExpressionAnimationStatusChangedEventArgs.h"
@@ -41,6 +42,9 @@ public:
     static void MouseWheelScrollChars(int mouseWheelScrollChars);
     static float MouseWheelInertiaDecayRate();
     static void MouseWheelInertiaDecayRate(float mouseWheelInertiaDecayRate);
+    static double AutomationPercentChangeStep();
+    static void AutomationPercentChangeStep(double automationPercentChangeStep);
+    static bool ShouldRaiseAutomationPercentChanged(double lastRaisedPercent, double newPercent, bool isViewChanging, double percentChangeStep);
     static void GetOffsetsChangeVelocityParameters(int& millisecondsPerUnit, int& minMilliseconds, int& maxMilliseconds);
     static void SetOffsetsChangeVelocityParameters(int millisecondsPerUnit, int minMilliseconds, int maxMilliseconds);
     static void GetZoomFactorChangeVelocityParameters(int& millisecondsPerUnit, int& minMilliseconds, int& maxMilliseconds);
@@ -52,6 +56,30 @@ public:
     static winrt::float2 GetArrangeRenderSizesDelta(const winrt::Scroller& scroller);
     static winrt::float2 GetMinPosition(const winrt::Scroller& scroller);
     static winrt::float2 GetMaxPosition(const winrt::Scroller& scroller);
+    static void ComputeBoundaryPositions(
+        const winrt::HorizontalAlignment& horizontalAlignment,
+        const winrt::VerticalAlignment& verticalAlignment,
+        const winrt::float2& unzoomedExtent,
+        const winrt::float2& viewport,
+        float zoomFactor,
+        const winrt::float2& contentLayoutOffset,
+        winrt::float2& minPosition,
+        winrt::float2& maxPosition);
+    static double ComputeRetargetingCurveDuration(
+        double startValue,
+        double startVelocity,
+        double endValue,
+        double proposedDuration);
+    static void EvaluateRetargetingCurve(
+        double startValue,
+        double startVelocity,
+        double endValue,
+        double duration,
+        double time,
+        double& value,
+        double& velocity,
+        double& acceleration,
+        double& jerk);
     static winrt::ScrollerViewChangeResult GetScrollCompletedResult(const winrt::ScrollCompletedEventArgs& scrollCompletedEventArgs);
     static winrt::ScrollerViewChangeResult GetZoomCompletedResult(const winrt::ZoomCompletedEventArgs& zoomCompletedEventArgs);
 
@@ -123,4 +151,5 @@ private:
     int m_mouseWheelScrollLines{ RegUtil::s_defaultMouseWheelScrollLines };
     int m_mouseWheelScrollChars{ RegUtil::s_defaultMouseWheelScrollChars };
     float m_mouseWheelInertiaDecayRate{ 0.0f };
+    double m_automationPercentChangeStep{ ScrollerAutomationPeer::s_percentChangeStepDuringViewChange };
 };
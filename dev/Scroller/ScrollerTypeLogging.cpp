@@ -117,6 +117,8 @@ winrt::hstring AnimationModeToString(const winrt::AnimationMode& animationMode)
         return L"Enabled";
     case winrt::AnimationMode::Auto:
         return L"Auto";
+    case winrt::AnimationMode::Retarget:
+        return L"Retarget";
     default:
         MUX_ASSERT(false);
         return L"";
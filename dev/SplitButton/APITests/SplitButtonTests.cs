@@ -6,6 +6,9 @@ using System.Windows.Input;
 
 using MUXControlsTestApp.Utilities;
 
+using Windows.UI.Xaml.Automation;
+using Windows.UI.Xaml.Automation.Peers;
+using Windows.UI.Xaml.Automation.Provider;
 using Windows.UI.Xaml.Controls;
 using Common;
 
@@ -19,6 +22,7 @@ using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
 #endif
 
 using SplitButton = Microsoft.UI.Xaml.Controls.SplitButton;
+using SplitButtonTestApi = Microsoft.UI.Private.Controls.SplitButtonTestApi;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
 {
@@ -70,6 +74,82 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
                 Verify.AreEqual(splitButton.CommandParameter, parameter);
             });
         }
+
+        [TestMethod]
+        [Description("Verifies the event subscriptions SplitButton holds on itself, its template and its flyout.")]
+        public void VerifyEventSubscriptionCount()
+        {
+            SplitButton splitButton = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                splitButton = new SplitButton();
+
+                // Key down, key up and pointer entered on the control itself.
+                Verify.AreEqual(3, SplitButtonTestApi.GetEventSubscriptionCount(splitButton));
+
+                // Opened and Closed on the flyout.
+                splitButton.Flyout = new Flyout() { Content = new TextBlock() { Text = "flyout" } };
+                Verify.AreEqual(5, SplitButtonTestApi.GetEventSubscriptionCount(splitButton));
+
+                MUXControlsTestApp.App.TestContentRoot = splitButton;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                // Click, IsPressed and IsPointerOver on each of the two template buttons.
+                Verify.AreEqual(11, SplitButtonTestApi.GetEventSubscriptionCount(splitButton));
+
+                splitButton.Flyout = new Flyout();
+                Verify.AreEqual(11, SplitButtonTestApi.GetEventSubscriptionCount(splitButton));
+
+                splitButton.Flyout = null;
+                Verify.AreEqual(9, SplitButtonTestApi.GetEventSubscriptionCount(splitButton));
+            });
+        }
+
+        [TestMethod]
+        [Description("Verifies SplitButton tracks its flyout when the app shows it.")]
+        public void VerifyFlyoutShownByAppIsTracked()
+        {
+            SplitButton splitButton = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                splitButton = new SplitButton();
+                splitButton.Flyout = new Flyout() { Content = new TextBlock() { Text = "flyout" } };
+                MUXControlsTestApp.App.TestContentRoot = splitButton;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                splitButton.Flyout.ShowAt(splitButton);
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                var peer = FrameworkElementAutomationPeer.CreatePeerForElement(splitButton);
+                var expandCollapseProvider = (IExpandCollapseProvider)peer.GetPattern(PatternInterface.ExpandCollapse);
+                Verify.AreEqual(ExpandCollapseState.Expanded, expandCollapseProvider.ExpandCollapseState);
+
+                splitButton.Flyout.Hide();
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                var peer = FrameworkElementAutomationPeer.CreatePeerForElement(splitButton);
+                var expandCollapseProvider = (IExpandCollapseProvider)peer.GetPattern(PatternInterface.ExpandCollapse);
+                Verify.AreEqual(ExpandCollapseState.Collapsed, expandCollapseProvider.ExpandCollapseState);
+            });
+        }
     }
 
     // CanExecuteChanged is never used -- that's ok, disable the compiler warning.
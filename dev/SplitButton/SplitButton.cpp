@@ -18,6 +18,14 @@ SplitButton::SplitButton()
 
     m_keyDownRevoker = KeyDown(winrt::auto_revoke, { this, &SplitButton::OnSplitButtonKeyDown });
     m_keyUpRevoker = KeyUp(winrt::auto_revoke, { this, &SplitButton::OnSplitButtonKeyUp });
+
+    // Every interaction with the buttons starts with the pointer entering the control, so this is the
+    // only place the last used pointer type needs to be captured. Handled events are included because
+    // the template's buttons may mark them as handled before they bubble up here.
+    m_pointerEnteredRevoker = AddRoutedEventHandler<RoutedEventType::PointerEntered>(
+        *this,
+        { this, &SplitButton::OnSplitButtonPointerEntered },
+        true /*handledEventsToo*/);
 }
 
 void SplitButton::OnApplyTemplate()
@@ -34,14 +42,6 @@ void SplitButton::OnApplyTemplate()
 
         m_pressedPrimaryRevoker = RegisterPropertyChanged(primaryButton, winrt::ButtonBase::IsPressedProperty(), { this, &SplitButton::OnVisualPropertyChanged });
         m_pointerOverPrimaryRevoker = RegisterPropertyChanged(primaryButton, winrt::ButtonBase::IsPointerOverProperty(), { this, &SplitButton::OnVisualPropertyChanged });
-
-        // Register for pointer events so we can keep track of the last used pointer type
-        m_pointerEnteredPrimaryRevoker = primaryButton.PointerEntered(winrt::auto_revoke, { this, &SplitButton::OnPointerEvent });
-        m_pointerExitedPrimaryRevoker = primaryButton.PointerExited(winrt::auto_revoke, { this, &SplitButton::OnPointerEvent });
-        m_pointerPressedPrimaryRevoker = primaryButton.PointerPressed(winrt::auto_revoke, { this, &SplitButton::OnPointerEvent });
-        m_pointerReleasedPrimaryRevoker = primaryButton.PointerReleased(winrt::auto_revoke, { this, &SplitButton::OnPointerEvent });
-        m_pointerCanceledPrimaryRevoker = primaryButton.PointerCanceled(winrt::auto_revoke, { this, &SplitButton::OnPointerEvent });
-        m_pointerCaptureLostPrimaryRevoker = primaryButton.PointerCaptureLost(winrt::auto_revoke, { this, &SplitButton::OnPointerEvent });
     }
 
     if (auto secondaryButton = m_secondaryButton.get())
@@ -54,19 +54,11 @@ void SplitButton::OnApplyTemplate()
 
         m_pressedSecondaryRevoker = RegisterPropertyChanged(secondaryButton, winrt::ButtonBase::IsPressedProperty(), { this, &SplitButton::OnVisualPropertyChanged });
         m_pointerOverSecondaryRevoker = RegisterPropertyChanged(secondaryButton, winrt::ButtonBase::IsPointerOverProperty(), { this, &SplitButton::OnVisualPropertyChanged });
-
-        // Register for pointer events so we can keep track of the last used pointer type
-        m_pointerEnteredSecondaryRevoker = secondaryButton.PointerEntered(winrt::auto_revoke, { this, &SplitButton::OnPointerEvent });
-        m_pointerExitedSecondaryRevoker = secondaryButton.PointerExited(winrt::auto_revoke, { this, &SplitButton::OnPointerEvent });
-        m_pointerPressedSecondaryRevoker = secondaryButton.PointerPressed(winrt::auto_revoke, { this, &SplitButton::OnPointerEvent });
-        m_pointerReleasedSecondaryRevoker = secondaryButton.PointerReleased(winrt::auto_revoke, { this, &SplitButton::OnPointerEvent });
-        m_pointerCanceledSecondaryRevoker = secondaryButton.PointerCanceled(winrt::auto_revoke, { this, &SplitButton::OnPointerEvent });
-        m_pointerCaptureLostSecondaryRevoker = secondaryButton.PointerCaptureLost(winrt::auto_revoke, { this, &SplitButton::OnPointerEvent });
     }
 
-    // Register events on flyout
-    RegisterFlyoutEvents();
-
+    // The new template starts out in its default states.
+    m_lastLayoutState = nullptr;
+    m_lastCommonState = nullptr;
     UpdateVisualStates();
 
     m_hasLoaded = true;
@@ -87,6 +79,25 @@ winrt::AutomationPeer SplitButton::OnCreateAutomationPeer()
     return winrt::make<SplitButtonAutomationPeer>(*this);
 }
 
+int SplitButton::GetEventSubscriptionCount()
+{
+    const bool subscriptions[] = {
+        static_cast<bool>(m_keyDownRevoker),
+        static_cast<bool>(m_keyUpRevoker),
+        static_cast<bool>(m_pointerEnteredRevoker),
+        static_cast<bool>(m_clickPrimaryRevoker),
+        static_cast<bool>(m_pressedPrimaryRevoker),
+        static_cast<bool>(m_pointerOverPrimaryRevoker),
+        static_cast<bool>(m_clickSecondaryRevoker),
+        static_cast<bool>(m_pressedSecondaryRevoker),
+        static_cast<bool>(m_pointerOverSecondaryRevoker),
+        static_cast<bool>(m_flyoutOpenedRevoker),
+        static_cast<bool>(m_flyoutClosedRevoker),
+    };
+
+    return static_cast<int>(std::count(std::begin(subscriptions), std::end(subscriptions), true));
+}
+
 void SplitButton::OnFlyoutChanged()
 {
     RegisterFlyoutEvents();
@@ -98,15 +109,13 @@ void SplitButton::RegisterFlyoutEvents()
 {
     m_flyoutOpenedRevoker.revoke();
     m_flyoutClosedRevoker.revoke();
-    m_flyoutPlacementChangedRevoker.revoke();
 
-    if (Flyout())
+    // The flyout can also be shown by the app, so it is hooked up as soon as it is set
+    // rather than when the SplitButton first shows it.
+    if (auto flyout = Flyout())
     {
-        m_flyoutOpenedRevoker = Flyout().Opened(winrt::auto_revoke, { this, &SplitButton::OnFlyoutOpened });
-
-        m_flyoutClosedRevoker = Flyout().Closed(winrt::auto_revoke, { this, &SplitButton::OnFlyoutClosed });
-
-        m_flyoutPlacementChangedRevoker = RegisterPropertyChanged(Flyout(), winrt::FlyoutBase::PlacementProperty(), { this, &SplitButton::OnFlyoutPlacementChanged });
+        m_flyoutOpenedRevoker = flyout.Opened(winrt::auto_revoke, { this, &SplitButton::OnFlyoutOpened });
+        m_flyoutClosedRevoker = flyout.Closed(winrt::auto_revoke, { this, &SplitButton::OnFlyoutClosed });
     }
 }
 
@@ -120,11 +129,11 @@ void SplitButton::UpdateVisualStates(bool useTransitions)
     // place the secondary button
     if (m_lastPointerDeviceType == winrt::PointerDeviceType::Touch || m_isKeyDown)
     {
-        winrt::VisualStateManager::GoToState(*this, L"SecondaryButtonSpan", useTransitions);
+        GoToState(L"SecondaryButtonSpan", m_lastLayoutState, useTransitions);
     }
     else
     {
-        winrt::VisualStateManager::GoToState(*this, L"SecondaryButtonRight", useTransitions);
+        GoToState(L"SecondaryButtonRight", m_lastLayoutState, useTransitions);
     }
 
     // change visual state
@@ -134,7 +143,7 @@ void SplitButton::UpdateVisualStates(bool useTransitions)
     {
         if (m_isFlyoutOpen)
         {
-            winrt::VisualStateManager::GoToState(*this, L"FlyoutOpen", useTransitions);
+            GoToState(L"FlyoutOpen", m_lastCommonState, useTransitions);
         }
         // SplitButton and ToggleSplitButton share a template -- this section is driving the checked states for ToggleSplitButton.
         else if (InternalIsChecked())
@@ -143,32 +152,32 @@ void SplitButton::UpdateVisualStates(bool useTransitions)
             {
                 if (primaryButton.IsPressed() || secondaryButton.IsPressed() || m_isKeyDown)
                 {
-                    winrt::VisualStateManager::GoToState(*this, L"CheckedTouchPressed", useTransitions);
+                    GoToState(L"CheckedTouchPressed", m_lastCommonState, useTransitions);
                 }
                 else
                 {
-                    winrt::VisualStateManager::GoToState(*this, L"Checked", useTransitions);
+                    GoToState(L"Checked", m_lastCommonState, useTransitions);
                 }
             }
             else if (primaryButton.IsPressed())
             {
-                winrt::VisualStateManager::GoToState(*this, L"CheckedPrimaryPressed", useTransitions);
+                GoToState(L"CheckedPrimaryPressed", m_lastCommonState, useTransitions);
             }
             else if (primaryButton.IsPointerOver())
             {
-                winrt::VisualStateManager::GoToState(*this, L"CheckedPrimaryPointerOver", useTransitions);
+                GoToState(L"CheckedPrimaryPointerOver", m_lastCommonState, useTransitions);
             }
             else if (secondaryButton.IsPressed())
             {
-                winrt::VisualStateManager::GoToState(*this, L"CheckedSecondaryPressed", useTransitions);
+                GoToState(L"CheckedSecondaryPressed", m_lastCommonState, useTransitions);
             }
             else if (secondaryButton.IsPointerOver())
             {
-                winrt::VisualStateManager::GoToState(*this, L"CheckedSecondaryPointerOver", useTransitions);
+                GoToState(L"CheckedSecondaryPointerOver", m_lastCommonState, useTransitions);
             }
             else
             {
-                winrt::VisualStateManager::GoToState(*this, L"Checked", useTransitions);
+                GoToState(L"Checked", m_lastCommonState, useTransitions);
             }
         }
         else
@@ -177,37 +186,46 @@ void SplitButton::UpdateVisualStates(bool useTransitions)
             {
                 if (primaryButton.IsPressed() || secondaryButton.IsPressed() || m_isKeyDown)
                 {
-                    winrt::VisualStateManager::GoToState(*this, L"TouchPressed", useTransitions);
+                    GoToState(L"TouchPressed", m_lastCommonState, useTransitions);
                 }
                 else
                 {
-                    winrt::VisualStateManager::GoToState(*this, L"Normal", useTransitions);
+                    GoToState(L"Normal", m_lastCommonState, useTransitions);
                 }
             }
             else if (primaryButton.IsPressed())
             {
-                winrt::VisualStateManager::GoToState(*this, L"PrimaryPressed", useTransitions);
+                GoToState(L"PrimaryPressed", m_lastCommonState, useTransitions);
             }
             else if (primaryButton.IsPointerOver())
             {
-                winrt::VisualStateManager::GoToState(*this, L"PrimaryPointerOver", useTransitions);
+                GoToState(L"PrimaryPointerOver", m_lastCommonState, useTransitions);
             }
             else if (secondaryButton.IsPressed())
             {
-                winrt::VisualStateManager::GoToState(*this, L"SecondaryPressed", useTransitions);
+                GoToState(L"SecondaryPressed", m_lastCommonState, useTransitions);
             }
             else if (secondaryButton.IsPointerOver())
             {
-                winrt::VisualStateManager::GoToState(*this, L"SecondaryPointerOver", useTransitions);
+                GoToState(L"SecondaryPointerOver", m_lastCommonState, useTransitions);
             }
             else
             {
-                winrt::VisualStateManager::GoToState(*this, L"Normal", useTransitions);
+                GoToState(L"Normal", m_lastCommonState, useTransitions);
             }
         }
     }
 }
 
+void SplitButton::GoToState(const wchar_t* state, const wchar_t*& lastState, bool useTransitions)
+{
+    if (!lastState || std::wcscmp(state, lastState) != 0)
+    {
+        winrt::VisualStateManager::GoToState(*this, state, useTransitions);
+        lastState = state;
+    }
+}
+
 void SplitButton::OpenFlyout()
 {
     if (auto flyout = Flyout())
@@ -247,11 +265,6 @@ void SplitButton::OnFlyoutClosed(const winrt::IInspectable& sender, const winrt:
     SharedHelpers::RaiseAutomationPropertyChangedEvent(*this, winrt::ExpandCollapseState::Expanded, winrt::ExpandCollapseState::Collapsed);
 }
 
-void SplitButton::OnFlyoutPlacementChanged(const winrt::DependencyObject& sender, const winrt::DependencyProperty& args)
-{
-    UpdateVisualStates();
-}
-
 void SplitButton::OnClickPrimary(const winrt::IInspectable& sender, const winrt::RoutedEventArgs& args)
 {
     auto eventArgs = winrt::make_self<SplitButtonClickEventArgs>();
@@ -268,7 +281,7 @@ void SplitButton::OnClickSecondary(const winrt::IInspectable& sender, const winr
     OpenFlyout();
 }
 
-void SplitButton::OnPointerEvent(const winrt::IInspectable& sender, const winrt::PointerRoutedEventArgs& args)
+void SplitButton::OnSplitButtonPointerEntered(const winrt::IInspectable& sender, const winrt::PointerRoutedEventArgs& args)
 {
     winrt::PointerDeviceType pointerDeviceType = args.Pointer().PointerDeviceType();
 
@@ -339,21 +352,7 @@ void SplitButton::UnregisterEvents()
     m_pressedPrimaryRevoker.revoke();
     m_pointerOverPrimaryRevoker.revoke();
 
-    m_pointerEnteredPrimaryRevoker.revoke();
-    m_pointerExitedPrimaryRevoker.revoke();
-    m_pointerPressedPrimaryRevoker.revoke();
-    m_pointerReleasedPrimaryRevoker.revoke();
-    m_pointerCanceledPrimaryRevoker.revoke();
-    m_pointerCaptureLostPrimaryRevoker.revoke();
-
     m_clickSecondaryRevoker.revoke();
     m_pressedSecondaryRevoker.revoke();
     m_pointerOverSecondaryRevoker.revoke();
-
-    m_pointerEnteredSecondaryRevoker.revoke();
-    m_pointerExitedSecondaryRevoker.revoke();
-    m_pointerPressedSecondaryRevoker.revoke();
-    m_pointerReleasedSecondaryRevoker.revoke();
-    m_pointerCanceledSecondaryRevoker.revoke();
-    m_pointerCaptureLostSecondaryRevoker.revoke();
 }
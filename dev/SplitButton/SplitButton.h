@@ -34,6 +34,9 @@ public:
 
     void OnPropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args);
 
+    // Number of live event and property changed subscriptions held by this instance. Used by tests.
+    int GetEventSubscriptionCount();
+
 private:
 
     void OnVisualPropertyChanged(const winrt::DependencyObject& sender, const winrt::DependencyProperty& args);
@@ -50,14 +53,15 @@ private:
     void OnFlyoutChanged();
     void OnFlyoutOpened(const winrt::IInspectable& sender, const winrt::IInspectable& args);
     void OnFlyoutClosed(const winrt::IInspectable& sender, const winrt::IInspectable& args);
-    void OnFlyoutPlacementChanged(const winrt::DependencyObject& sender, const winrt::DependencyProperty& args);
 
-    void OnPointerEvent(const winrt::IInspectable& sender, const winrt::PointerRoutedEventArgs& args);
+    void OnSplitButtonPointerEntered(const winrt::IInspectable& sender, const winrt::PointerRoutedEventArgs& args);
     void OnSplitButtonKeyDown(const winrt::IInspectable& sender, const winrt::KeyRoutedEventArgs& args);
     void OnSplitButtonKeyUp(const winrt::IInspectable& sender, const winrt::KeyRoutedEventArgs& args);
 
     void RegisterFlyoutEvents();
 
+    void GoToState(const wchar_t* state, const wchar_t*& lastState, bool useTransitions);
+
     tracker_ref<winrt::Button> m_primaryButton{ this };
     tracker_ref<winrt::Button> m_secondaryButton{ this };
 
@@ -65,32 +69,23 @@ private:
     winrt::PointerDeviceType m_lastPointerDeviceType{ winrt::PointerDeviceType::Mouse };
     bool m_isKeyDown{ false };
 
+    // Last states applied by UpdateVisualStates, so that input which doesn't change the outcome
+    // doesn't go back through the VisualStateManager. Reset when a new template is applied.
+    const wchar_t* m_lastLayoutState{ nullptr };
+    const wchar_t* m_lastCommonState{ nullptr };
+
     winrt::UIElement::KeyDown_revoker m_keyDownRevoker{};
     winrt::UIElement::KeyUp_revoker m_keyUpRevoker{};
+    RoutedEventHandler_revoker m_pointerEnteredRevoker{};
 
     winrt::ButtonBase::Click_revoker m_clickPrimaryRevoker{};
     PropertyChanged_revoker m_pressedPrimaryRevoker{};
     PropertyChanged_revoker m_pointerOverPrimaryRevoker{};
 
-    winrt::UIElement::PointerEntered_revoker m_pointerEnteredPrimaryRevoker{};
-    winrt::UIElement::PointerExited_revoker m_pointerExitedPrimaryRevoker{};
-    winrt::UIElement::PointerPressed_revoker m_pointerPressedPrimaryRevoker{};
-    winrt::UIElement::PointerReleased_revoker m_pointerReleasedPrimaryRevoker{};
-    winrt::UIElement::PointerCanceled_revoker m_pointerCanceledPrimaryRevoker{};
-    winrt::UIElement::PointerCaptureLost_revoker m_pointerCaptureLostPrimaryRevoker{};
-
     winrt::ButtonBase::Click_revoker m_clickSecondaryRevoker{};
     PropertyChanged_revoker m_pressedSecondaryRevoker{};
     PropertyChanged_revoker m_pointerOverSecondaryRevoker{};
 
-    winrt::UIElement::PointerEntered_revoker m_pointerEnteredSecondaryRevoker{};
-    winrt::UIElement::PointerExited_revoker m_pointerExitedSecondaryRevoker{};
-    winrt::UIElement::PointerPressed_revoker m_pointerPressedSecondaryRevoker{};
-    winrt::UIElement::PointerReleased_revoker m_pointerReleasedSecondaryRevoker{};
-    winrt::UIElement::PointerCanceled_revoker m_pointerCanceledSecondaryRevoker{};
-    winrt::UIElement::PointerCaptureLost_revoker m_pointerCaptureLostSecondaryRevoker{};
-
     winrt::FlyoutBase::Opened_revoker m_flyoutOpenedRevoker{};
     winrt::FlyoutBase::Closed_revoker m_flyoutClosedRevoker{};
-    PropertyChanged_revoker m_flyoutPlacementChangedRevoker{};
 };
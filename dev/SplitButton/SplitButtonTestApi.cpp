@@ -5,6 +5,7 @@
 #include "common.h"
 #include "SplitButtonTestHelper.h"
 #include "SplitButtonTestApi.h"
+#include "SplitButton.h"
 
 bool SplitButtonTestApi::SimulateTouch()
 {
@@ -15,3 +16,12 @@ void SplitButtonTestApi::SimulateTouch(bool value)
 {
     SplitButtonTestHelper::SimulateTouch(value);
 }
+
+int SplitButtonTestApi::GetEventSubscriptionCount(const winrt::SplitButton& splitButton)
+{
+    if (splitButton)
+    {
+        return winrt::get_self<SplitButton>(splitButton)->GetEventSubscriptionCount();
+    }
+    return 0;
+}
@@ -11,6 +11,7 @@ class SplitButtonTestApi :
 public:
     static bool SimulateTouch();
     static void SimulateTouch(bool value);
+    static int GetEventSubscriptionCount(const winrt::SplitButton& splitButton);
 };
 
 CppWinRTActivatableClassWithBasicFactory(SplitButtonTestApi);
\ No newline at end of file
@@ -24,6 +24,11 @@ SwipeControl::SwipeControl()
 {
     __RP_Marker_ClassById(RuntimeProfiler::ProfId_SwipeControl);
     SetDefaultStyleKey(this);
+
+    if (winrt::IFrameworkElement6 frameworkElement6 = *this)
+    {
+        m_actualThemeChangedRevoker = frameworkElement6.ActualThemeChanged(winrt::auto_revoke, { this, &SwipeControl::OnActualThemeChanged });
+    }
 }
 
 SwipeControl::~SwipeControl()
@@ -388,6 +393,19 @@ bool SwipeControl::GetIsIdle()
 {
     return m_isIdle;
 }
+
+// Goes through the same path as ValuesChanged does when the tracker crosses zero during a gesture.
+void SwipeControl::SimulateSwipeDirectionChange(bool toNearContent)
+{
+    if (m_isHorizontal)
+    {
+        toNearContent ? CreateLeftContent() : CreateRightContent();
+    }
+    else
+    {
+        toNearContent ? CreateTopContent() : CreateBottomContent();
+    }
+}
 #pragma endregion
 
 void SwipeControl::OnLeftItemsCollectionChanged(const winrt::DependencyPropertyChangedEventArgs& args)
@@ -413,6 +431,7 @@ void SwipeControl::OnLeftItemsCollectionChanged(const winrt::DependencyPropertyC
         m_interactionTracker.get().Properties().InsertBoolean(s_hasLeftContentPropertyName, args.NewValue() && args.NewValue().try_as<winrt::IVector<winrt::SwipeItem>>().Size() > 0);
     }
 
+    InvalidateSwipeItemVisuals(CreatedContent::Left);
     if (m_createdContent == CreatedContent::Left)
     {
         CreateLeftContent();
@@ -442,6 +461,7 @@ void SwipeControl::OnRightItemsCollectionChanged(const winrt::DependencyProperty
         m_interactionTracker.get().Properties().InsertBoolean(s_hasRightContentPropertyName, args.NewValue() && args.NewValue().try_as<winrt::IVector<winrt::SwipeItem>>().Size() > 0);
     }
 
+    InvalidateSwipeItemVisuals(CreatedContent::Right);
     if (m_createdContent == CreatedContent::Right)
     {
         CreateRightContent();
@@ -471,6 +491,7 @@ void SwipeControl::OnTopItemsCollectionChanged(const winrt::DependencyPropertyCh
         m_interactionTracker.get().Properties().InsertBoolean(s_hasTopContentPropertyName, args.NewValue() && args.NewValue().try_as<winrt::IVector<winrt::SwipeItem>>().Size() > 0);
     }
 
+    InvalidateSwipeItemVisuals(CreatedContent::Top);
     if (m_createdContent == CreatedContent::Top)
     {
         CreateTopContent();
@@ -500,6 +521,7 @@ void SwipeControl::OnBottomItemsCollectionChanged(const winrt::DependencyPropert
         m_interactionTracker.get().Properties().InsertBoolean(s_hasBottomContentPropertyName, args.NewValue() && args.NewValue().try_as<winrt::IVector<winrt::SwipeItem>>().Size() > 0);
     }
 
+    InvalidateSwipeItemVisuals(CreatedContent::Bottom);
     if (m_createdContent == CreatedContent::Bottom)
     {
         CreateBottomContent();
@@ -591,22 +613,7 @@ void SwipeControl::OnSizeChanged(const winrt::IInspectable& /*sender*/, const wi
         winrt::AppBarButton appBarButton = uiElement.try_as<winrt::AppBarButton>();
         if (appBarButton)
         {
-            if (m_isHorizontal)
-            {
-                appBarButton.Height(ActualHeight());
-                if (m_currentItems && m_currentItems.get().Mode() == winrt::SwipeMode::Execute)
-                {
-                    appBarButton.Width(ActualWidth());
-                }
-            }
-            else
-            {
-                appBarButton.Width(ActualWidth());
-                if (m_currentItems && m_currentItems.get().Mode() == winrt::SwipeMode::Execute)
-                {
-                    appBarButton.Height(ActualHeight());
-                }
-            }
+            UpdateSwipeItemButtonSize(appBarButton);
         }
     }
 }
@@ -788,6 +795,14 @@ void SwipeControl::DismissSwipeOnAnExternalTap(winrt::Point const& tapPoint)
 
 void SwipeControl::GetTemplateParts()
 {
+    // The kept swipe item buttons are parented to the old template's stack panel and styled with the old
+    // swipe item style, so they are detached and regenerated for the new template.
+    if (auto oldSwipeContentStackPanel = m_swipeContentStackPanel.get())
+    {
+        oldSwipeContentStackPanel.Children().Clear();
+    }
+    InvalidateAllSwipeItemVisuals();
+
     winrt::IControlProtected thisAsControlProtected = *this;
     m_rootGrid.set(GetTemplateChildT<winrt::Grid>(s_rootGridName, thisAsControlProtected));
     m_inputEater.set(GetTemplateChildT<winrt::Grid>(s_inputEaterName, thisAsControlProtected));
@@ -1171,14 +1186,90 @@ void SwipeControl::PopulateContentItems()
 {
     SWIPECONTROL_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
 
-    for (winrt::SwipeItem swipeItem : m_currentItems.get())
+    auto& itemVisuals = GetSwipeItemVisuals(m_createdContent);
+    auto const items = m_currentItems.get();
+
+    if (AreSwipeItemVisualsValid(itemVisuals, items))
     {
-        m_swipeContentStackPanel.get().Children().Append(GetSwipeItemButton(swipeItem));
+        // The size of the control may have changed while these buttons were out of the tree.
+        for (auto const& button : itemVisuals.buttons.get())
+        {
+            UpdateSwipeItemButtonSize(button.as<winrt::AppBarButton>());
+        }
+    }
+    else
+    {
+        auto buttons = winrt::make<Vector<winrt::UIElement>>();
+        itemVisuals.itemVersions.clear();
+        for (winrt::SwipeItem swipeItem : items)
+        {
+            buttons.Append(GetSwipeItemButton(swipeItem));
+            itemVisuals.itemVersions.push_back(winrt::get_self<SwipeItem>(swipeItem)->VisualVersion());
+        }
+        itemVisuals.buttons.set(buttons);
+        itemVisuals.mode = items.Mode();
+    }
+
+    auto children = m_swipeContentStackPanel.get().Children();
+    for (auto const& button : itemVisuals.buttons.get())
+    {
+        children.Append(button);
     }
 
     TryGetSwipeVisuals();
 }
 
+SwipeControl::SwipeItemVisuals& SwipeControl::GetSwipeItemVisuals(CreatedContent createdContent)
+{
+    switch (createdContent)
+    {
+    case CreatedContent::Left:
+        return m_leftItemVisuals;
+    case CreatedContent::Top:
+        return m_topItemVisuals;
+    case CreatedContent::Bottom:
+        return m_bottomItemVisuals;
+    case CreatedContent::Right:
+        return m_rightItemVisuals;
+    default:
+        assert(false);
+        return m_leftItemVisuals;
+    }
+}
+
+bool SwipeControl::AreSwipeItemVisualsValid(const SwipeItemVisuals& itemVisuals, const winrt::SwipeItems& items)
+{
+    if (!itemVisuals.buttons || itemVisuals.mode != items.Mode() || itemVisuals.itemVersions.size() != items.Size())
+    {
+        return false;
+    }
+
+    uint32_t index = 0;
+    for (winrt::SwipeItem swipeItem : items)
+    {
+        if (winrt::get_self<SwipeItem>(swipeItem)->VisualVersion() != itemVisuals.itemVersions[index++])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SwipeControl::InvalidateSwipeItemVisuals(CreatedContent createdContent)
+{
+    auto& itemVisuals = GetSwipeItemVisuals(createdContent);
+    itemVisuals.buttons.set(nullptr);
+    itemVisuals.itemVersions.clear();
+}
+
+void SwipeControl::InvalidateAllSwipeItemVisuals()
+{
+    InvalidateSwipeItemVisuals(CreatedContent::Left);
+    InvalidateSwipeItemVisuals(CreatedContent::Top);
+    InvalidateSwipeItemVisuals(CreatedContent::Bottom);
+    InvalidateSwipeItemVisuals(CreatedContent::Right);
+}
+
 void SwipeControl::SetupExecuteExpressionAnimation()
 {
     SWIPECONTROL_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
@@ -1259,41 +1350,84 @@ winrt::AppBarButton SwipeControl::GetSwipeItemButton(const winrt::SwipeItem& swi
 {
     winrt::AppBarButton itemAsButton;
     winrt::get_self<SwipeItem>(swipeItem)->GenerateControl(itemAsButton, m_swipeItemStyle.get());
-    auto resources = winrt::Application::Current().Resources();
+    EnsureThemeBrushes();
+
+    const bool isReveal = m_currentItems.get().Mode() == winrt::SwipeMode::Reveal;
 
     if (!swipeItem.Background())
     {
-        if (auto lookedUpBrush = SharedHelpers::FindResource(m_currentItems.get().Mode() == winrt::SwipeMode::Reveal ? s_swipeItemBackgroundResourceName : m_thresholdReached ? s_executeSwipeItemPostThresholdBackgroundResourceName : s_executeSwipeItemPreThresholdBackgroundResourceName, resources))
+        if (auto brush = isReveal ? m_swipeItemBackgroundBrush.get() : m_thresholdReached ? m_executeSwipeItemPostThresholdBackgroundBrush.get() : m_executeSwipeItemPreThresholdBackgroundBrush.get())
         {
-            itemAsButton.Background(lookedUpBrush.try_as<winrt::Brush>());
+            itemAsButton.Background(brush);
         }
     }
 
     if (!swipeItem.Foreground())
     {
-        if (auto lookedUpBrush = SharedHelpers::FindResource(m_currentItems.get().Mode() == winrt::SwipeMode::Reveal ? s_swipeItemForegroundResourceName : m_thresholdReached ? s_executeSwipeItemPostThresholdForegroundResourceName : s_executeSwipeItemPreThresholdForegroundResourceName, resources))
+        if (auto brush = isReveal ? m_swipeItemForegroundBrush.get() : m_thresholdReached ? m_executeSwipeItemPostThresholdForegroundBrush.get() : m_executeSwipeItemPreThresholdForegroundBrush.get())
         {
-            itemAsButton.Foreground(lookedUpBrush.try_as<winrt::Brush>());
+            itemAsButton.Foreground(brush);
         }
     }
 
+    UpdateSwipeItemButtonSize(itemAsButton);
+    return itemAsButton;
+}
+
+void SwipeControl::UpdateSwipeItemButtonSize(const winrt::AppBarButton& appBarButton)
+{
     if (m_isHorizontal)
     {
-        itemAsButton.Height(ActualHeight());
-        if (m_currentItems.get().Mode() == winrt::SwipeMode::Execute)
+        appBarButton.Height(ActualHeight());
+        if (m_currentItems && m_currentItems.get().Mode() == winrt::SwipeMode::Execute)
         {
-            itemAsButton.Width(ActualWidth());
+            appBarButton.Width(ActualWidth());
         }
     }
     else
     {
-        itemAsButton.Width(ActualWidth());
-        if (m_currentItems.get().Mode() == winrt::SwipeMode::Execute)
+        appBarButton.Width(ActualWidth());
+        if (m_currentItems && m_currentItems.get().Mode() == winrt::SwipeMode::Execute)
         {
-            itemAsButton.Height(ActualHeight());
+            appBarButton.Height(ActualHeight());
         }
     }
-    return itemAsButton;
+}
+
+void SwipeControl::EnsureThemeBrushes()
+{
+    // Without ActualThemeChanged there is no way to know when the looked up brushes go stale,
+    // so they are looked up every time as they always have been.
+    if (m_areThemeBrushesResolved && m_actualThemeChangedRevoker)
+    {
+        return;
+    }
+
+    auto resources = winrt::Application::Current().Resources();
+    auto lookUpBrush = [&resources](wstring_view resourceName) -> winrt::Brush
+    {
+        if (auto lookedUpBrush = SharedHelpers::FindResource(resourceName, resources))
+        {
+            return lookedUpBrush.try_as<winrt::Brush>();
+        }
+        return nullptr;
+    };
+
+    m_swipeItemBackgroundBrush.set(lookUpBrush(s_swipeItemBackgroundResourceName));
+    m_swipeItemForegroundBrush.set(lookUpBrush(s_swipeItemForegroundResourceName));
+    m_executeSwipeItemPreThresholdBackgroundBrush.set(lookUpBrush(s_executeSwipeItemPreThresholdBackgroundResourceName));
+    m_executeSwipeItemPostThresholdBackgroundBrush.set(lookUpBrush(s_executeSwipeItemPostThresholdBackgroundResourceName));
+    m_executeSwipeItemPreThresholdForegroundBrush.set(lookUpBrush(s_executeSwipeItemPreThresholdForegroundResourceName));
+    m_executeSwipeItemPostThresholdForegroundBrush.set(lookUpBrush(s_executeSwipeItemPostThresholdForegroundResourceName));
+    m_areThemeBrushesResolved = true;
+}
+
+void SwipeControl::OnActualThemeChanged(const winrt::FrameworkElement& /*sender*/, const winrt::IInspectable& /*args*/)
+{
+    m_areThemeBrushesResolved = false;
+
+    // The buttons kept for each side carry brushes of the previous theme.
+    InvalidateAllSwipeItemVisuals();
 }
 
 void SwipeControl::UpdateColorsIfExecuteItem()
@@ -1318,23 +1452,8 @@ void SwipeControl::UpdateExecuteBackgroundColor(const winrt::SwipeItem& swipeIte
 {
     SWIPECONTROL_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
 
-    auto resources = winrt::Application::Current().Resources();
-    winrt::Brush background = nullptr;
-
-    if (!m_thresholdReached)
-    {
-        if (auto lookedUpBackgroundBrush = SharedHelpers::FindResource(s_executeSwipeItemPreThresholdBackgroundResourceName, resources))
-        {
-            background = lookedUpBackgroundBrush.try_as<winrt::Brush>();
-        }
-    }
-    else
-    {
-        if (auto lookedUpBackgroundBrush = SharedHelpers::FindResource(s_executeSwipeItemPostThresholdBackgroundResourceName, resources))
-        {
-            background = lookedUpBackgroundBrush.try_as<winrt::Brush>();
-        }
-    }
+    EnsureThemeBrushes();
+    winrt::Brush background = m_thresholdReached ? m_executeSwipeItemPostThresholdBackgroundBrush.get() : m_executeSwipeItemPreThresholdBackgroundBrush.get();
 
     if (swipeItem && swipeItem.Background())
     {
@@ -1353,23 +1472,8 @@ void SwipeControl::UpdateExecuteForegroundColor(const winrt::SwipeItem& swipeIte
     {
         if (auto appBarButton = m_swipeContentStackPanel.get().Children().GetAt(0).as<winrt::AppBarButton>())
         {
-            winrt::Brush foreground = nullptr;
-            auto resources = winrt::Application::Current().Resources();
-
-            if (!m_thresholdReached)
-            {
-                if (auto lookedUpForegroundBrush = SharedHelpers::FindResource(s_executeSwipeItemPreThresholdForegroundResourceName, resources))
-                {
-                    foreground = lookedUpForegroundBrush.try_as<winrt::Brush>();
-                }
-            }
-            else
-            {
-                if (auto lookedUpForegroundBrush = SharedHelpers::FindResource(s_executeSwipeItemPostThresholdForegroundResourceName, resources))
-                {
-                    foreground = lookedUpForegroundBrush.try_as<winrt::Brush>();
-                }
-            }
+            EnsureThemeBrushes();
+            winrt::Brush foreground = m_thresholdReached ? m_executeSwipeItemPostThresholdForegroundBrush.get() : m_executeSwipeItemPreThresholdForegroundBrush.get();
 
             if (swipeItem && swipeItem.Foreground())
             {
@@ -1391,12 +1495,9 @@ void SwipeControl::UpdateColorsIfRevealItems()
         return;
     }
 
-    winrt::Brush rootGridBackground = nullptr;
+    EnsureThemeBrushes();
+    winrt::Brush rootGridBackground = m_swipeItemBackgroundBrush.get();
 
-    if (auto lookedUpBrush = SharedHelpers::FindResource(s_swipeItemBackgroundResourceName, winrt::Application::Current().Resources()))
-    {
-        rootGridBackground = lookedUpBrush.try_as<winrt::Brush>();
-    }
     if (m_currentItems.get().Size() > 0)
     {
         switch (m_createdContent)
@@ -1442,6 +1543,7 @@ void SwipeControl::OnLeftItemsChanged(const winrt::IObservableVector<winrt::Swip
     ThrowIfHasVerticalAndHorizontalContent();
     m_interactionTracker.get().Properties().InsertBoolean(s_hasLeftContentPropertyName, sender.Size() > 0);
 
+    InvalidateSwipeItemVisuals(CreatedContent::Left);
     if (m_createdContent == CreatedContent::Left)
     {
         CreateLeftContent();
@@ -1455,6 +1557,7 @@ void SwipeControl::OnRightItemsChanged(const winrt::IObservableVector<winrt::Swi
     ThrowIfHasVerticalAndHorizontalContent();
     m_interactionTracker.get().Properties().InsertBoolean(s_hasRightContentPropertyName, sender.Size() > 0);
 
+    InvalidateSwipeItemVisuals(CreatedContent::Right);
     if (m_createdContent == CreatedContent::Right)
     {
         CreateRightContent();
@@ -1468,6 +1571,7 @@ void SwipeControl::OnTopItemsChanged(const winrt::IObservableVector<winrt::Swipe
     ThrowIfHasVerticalAndHorizontalContent();
     m_interactionTracker.get().Properties().InsertBoolean(s_hasTopContentPropertyName, sender.Size() > 0);
 
+    InvalidateSwipeItemVisuals(CreatedContent::Top);
     if (m_createdContent == CreatedContent::Top)
     {
         CreateTopContent();
@@ -1481,6 +1585,7 @@ void SwipeControl::OnBottomItemsChanged(const winrt::IObservableVector<winrt::Sw
     ThrowIfHasVerticalAndHorizontalContent();
     m_interactionTracker.get().Properties().InsertBoolean(s_hasBottomContentPropertyName, sender.Size() > 0);
 
+    InvalidateSwipeItemVisuals(CreatedContent::Bottom);
     if (m_createdContent == CreatedContent::Bottom)
     {
         CreateBottomContent();
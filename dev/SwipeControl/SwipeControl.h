@@ -64,6 +64,7 @@ public:
     static winrt::SwipeControl GetLastInteractedWithSwipeControl();
     bool GetIsOpen();
     bool GetIsIdle();
+    void SimulateSwipeDirectionChange(bool toNearContent);
 #pragma endregion
 
 private:
@@ -113,6 +114,22 @@ private:
     void CreateBottomContent();
     void CreateContent(const winrt::SwipeItems& items);
 
+    // Swipe item buttons generated for one side. They survive direction changes and closing, and are
+    // only generated again once the side's items, their mode, their visual properties or the theme change.
+    struct SwipeItemVisuals
+    {
+        explicit SwipeItemVisuals(const ITrackerHandleManager* owner) : buttons(owner) {}
+
+        tracker_ref<winrt::IVector<winrt::UIElement>> buttons;
+        winrt::SwipeMode mode{ winrt::SwipeMode::Reveal };
+        std::vector<uint32_t> itemVersions{};
+    };
+
+    SwipeItemVisuals& GetSwipeItemVisuals(CreatedContent createdContent);
+    bool AreSwipeItemVisualsValid(const SwipeItemVisuals& itemVisuals, const winrt::SwipeItems& items);
+    void InvalidateSwipeItemVisuals(CreatedContent createdContent);
+    void InvalidateAllSwipeItemVisuals();
+
     void AlignStackPanel();
     void PopulateContentItems();
     void SetupExecuteExpressionAnimation();
@@ -120,6 +137,9 @@ private:
     void UpdateColors();
 
     winrt::AppBarButton GetSwipeItemButton(const winrt::SwipeItem& swipeItem);
+    void UpdateSwipeItemButtonSize(const winrt::AppBarButton& appBarButton);
+    void EnsureThemeBrushes();
+    void OnActualThemeChanged(const winrt::FrameworkElement& sender, const winrt::IInspectable& args);
     void UpdateColorsIfExecuteItem();
     void UpdateColorsIfRevealItems();
     void UpdateExecuteForegroundColor(const winrt::SwipeItem& swipeItem);
@@ -163,6 +183,20 @@ private:
 
     tracker_ref<winrt::Style> m_swipeItemStyle{ this };
 
+    // Theme brushes looked up in the application resources, refreshed when the theme changes.
+    tracker_ref<winrt::Brush> m_swipeItemBackgroundBrush{ this };
+    tracker_ref<winrt::Brush> m_swipeItemForegroundBrush{ this };
+    tracker_ref<winrt::Brush> m_executeSwipeItemPreThresholdBackgroundBrush{ this };
+    tracker_ref<winrt::Brush> m_executeSwipeItemPostThresholdBackgroundBrush{ this };
+    tracker_ref<winrt::Brush> m_executeSwipeItemPreThresholdForegroundBrush{ this };
+    tracker_ref<winrt::Brush> m_executeSwipeItemPostThresholdForegroundBrush{ this };
+    bool m_areThemeBrushesResolved{ false };
+
+    SwipeItemVisuals m_leftItemVisuals{ this };
+    SwipeItemVisuals m_rightItemVisuals{ this };
+    SwipeItemVisuals m_topItemVisuals{ this };
+    SwipeItemVisuals m_bottomItemVisuals{ this };
+
     // Cache the current content object to minimize work if there are multiple swipes in the same direction.
     tracker_ref<winrt::SwipeItems> m_currentItems{ this };
 
@@ -190,6 +224,8 @@ private:
 
     winrt::CoreAcceleratorKeys::AcceleratorKeyActivated_revoker m_acceleratorKeyActivatedRevoker;
 
+    winrt::FrameworkElement::ActualThemeChanged_revoker m_actualThemeChangedRevoker{};
+
     bool m_hasInitialLoadedEventFired{ false };
 
     bool m_lastActionWasClosing{ false };
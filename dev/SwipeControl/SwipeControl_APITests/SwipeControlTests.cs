@@ -4,7 +4,9 @@
 using MUXControlsTestApp.Utilities;
 using System;
 using System.Threading;
+using Windows.Foundation.Metadata;
 using Windows.UI.Xaml;
+using Windows.UI.Xaml.Input;
 using Windows.UI.Xaml.Markup;
 using Windows.UI.Xaml.Controls;
 using Windows.UI.Xaml.Media;
@@ -24,6 +26,7 @@ using SwipeItem = Microsoft.UI.Xaml.Controls.SwipeItem;
 using SwipeItems = Microsoft.UI.Xaml.Controls.SwipeItems;
 using SwipeControl = Microsoft.UI.Xaml.Controls.SwipeControl;
 using FontIconSource = Microsoft.UI.Xaml.Controls.FontIconSource;
+using SwipeTestHooks = Microsoft.UI.Private.Controls.SwipeTestHooks;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
 {
@@ -123,6 +126,91 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        public void SwipeItemVisualsAreKeptAcrossDirectionChanges()
+        {
+            var resetEvent = new AutoResetEvent(false);
+            SwipeControl swipeControl = null;
+            SwipeItem leftItem = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                swipeControl = new SwipeControl() { Width = 200, Height = 50 };
+                leftItem = new SwipeItem() { Text = "Left 1" };
+                swipeControl.LeftItems = new SwipeItems() { leftItem, new SwipeItem() { Text = "Left 2" } };
+                swipeControl.RightItems = new SwipeItems() { Mode = SwipeMode.Execute };
+                swipeControl.RightItems.Add(new SwipeItem() { Text = "Right" });
+                swipeControl.Loaded += (object sender, RoutedEventArgs args) => { resetEvent.Set(); };
+                MUXControlsTestApp.App.TestContentRoot = swipeControl;
+            });
+
+            IdleSynchronizer.Wait();
+            resetEvent.WaitOne();
+
+            RunOnUIThread.Execute(() =>
+            {
+                int initialCount = SwipeTestHooks.GetSwipeItemGenerateControlCount();
+
+                for (int i = 0; i < 5; i++)
+                {
+                    SwipeTestHooks.SimulateSwipeDirectionChange(swipeControl, true /*toNearContent*/);
+                    SwipeTestHooks.SimulateSwipeDirectionChange(swipeControl, false /*toNearContent*/);
+                }
+
+                Log.Comment("Each side generates its items once, no matter how often the direction is reversed.");
+                Verify.AreEqual(initialCount + 3, SwipeTestHooks.GetSwipeItemGenerateControlCount());
+
+                Log.Comment("Changing a property shown by the item's button regenerates that side only.");
+                leftItem.Text = "Left 1 updated";
+                SwipeTestHooks.SimulateSwipeDirectionChange(swipeControl, true /*toNearContent*/);
+                SwipeTestHooks.SimulateSwipeDirectionChange(swipeControl, false /*toNearContent*/);
+                Verify.AreEqual(initialCount + 5, SwipeTestHooks.GetSwipeItemGenerateControlCount());
+
+                Log.Comment("Changing the collection regenerates that side only.");
+                swipeControl.LeftItems.Add(new SwipeItem() { Text = "Left 3" });
+                SwipeTestHooks.SimulateSwipeDirectionChange(swipeControl, true /*toNearContent*/);
+                SwipeTestHooks.SimulateSwipeDirectionChange(swipeControl, false /*toNearContent*/);
+                Verify.AreEqual(initialCount + 8, SwipeTestHooks.GetSwipeItemGenerateControlCount());
+
+                swipeControl.Close();
+            });
+        }
+
+        [TestMethod]
+        public void SwipeItemFollowsReplacedUICommand()
+        {
+            if (!ApiInformation.IsTypePresent("Windows.UI.Xaml.Input.XamlUICommand"))
+            {
+                Log.Warning("Test is disabled because UICommand doesn't exist as a type on this build.");
+                return;
+            }
+
+            RunOnUIThread.Execute(() =>
+            {
+                var commandA = new XamlUICommand() { Label = "Command A", IconSource = new Windows.UI.Xaml.Controls.SymbolIconSource() { Symbol = Symbol.Cut } };
+                var commandB = new XamlUICommand() { Label = "Command B", IconSource = new Windows.UI.Xaml.Controls.SymbolIconSource() { Symbol = Symbol.Copy } };
+                var swipeItem = new SwipeItem();
+
+                swipeItem.Command = commandA;
+                Verify.AreEqual("Command A", swipeItem.Text);
+
+                Log.Comment("Replacing the command takes the new command's label and icon.");
+                swipeItem.Command = commandB;
+                Verify.AreEqual("Command B", swipeItem.Text);
+                Verify.AreEqual(Symbol.Copy, ((Microsoft.UI.Xaml.Controls.SymbolIconSource)swipeItem.IconSource).Symbol);
+
+                Log.Comment("Changes to the old command no longer reach the SwipeItem.");
+                commandA.Label = "Command A updated";
+                commandA.IconSource = new Windows.UI.Xaml.Controls.SymbolIconSource() { Symbol = Symbol.Delete };
+                Verify.AreEqual("Command B", swipeItem.Text);
+                Verify.AreEqual(Symbol.Copy, ((Microsoft.UI.Xaml.Controls.SymbolIconSource)swipeItem.IconSource).Symbol);
+
+                Log.Comment("Changes to the new command still do.");
+                commandB.Label = "Command B updated";
+                Verify.AreEqual("Command B updated", swipeItem.Text);
+            });
+        }
+
         [TestMethod]
         public void SwipeControlCanOnlyBeHorizontalOrVertical()
         {
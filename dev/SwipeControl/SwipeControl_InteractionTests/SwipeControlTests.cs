@@ -1574,6 +1574,21 @@ namespace Windows.UI.Xaml.Tests.MUXControls.InteractionTests
                 Verify.AreEqual(ToggleState.On, SwipeItem10IdleCheckBox.ToggleState);
                 Verify.AreEqual("UICommand Label", textblock.DocumentText);
 
+                Log.Comment("Changes to the UICommand should propagate to the SwipeItem");
+                FindElement.ByName<Button>("ChangeUICommandLabelButton").InvokeAndWait();
+                DismissRevealedSwipe(false);
+                PerformSwipe(SwipeControl10, Direction.East);
+                WaitForChecked(SwipeItem10OpenCheckBox);
+                WaitForChecked(SwipeItem10IdleCheckBox);
+                TapItem("Changed UICommand Label");
+                Verify.AreEqual("Changed UICommand Label", textblock.DocumentText);
+
+                Log.Comment("Measure the cost of propagating the UICommand to many SwipeItems");
+                FindElement.ByName<Button>("MeasureUICommandPropagationButton").InvokeAndWait();
+                var propagationTextBlock = new TextBlock(FindElement.ByName("UICommandPropagationTextBlock"));
+                Verify.AreNotEqual("Missing label", propagationTextBlock.DocumentText);
+                Log.Comment("Propagated the UICommand to 1000 SwipeItems in " + propagationTextBlock.DocumentText + " ms");
+
                 Log.Comment("Returning to the main Swipe test page");
                 TestSetupHelper.GoBack();
             }
@@ -3,6 +3,7 @@
 
 using System;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.Numerics;
 using Windows.Foundation.Metadata;
 using Windows.UI.Composition;
@@ -33,6 +34,7 @@ namespace MUXControlsTestApp
         List<string> fullLogs = new List<string>();
         FrameworkElement lastInteractedWithSwipeControlContentContainer;
         FrameworkElement lastInteractedWithSwipeControlContentRoot;
+        XamlUICommand uiCommand;
         SwipeItem pastSender;
         UIElement animatedSwipe;
         DispatcherTimer _dt;
@@ -49,7 +51,7 @@ namespace MUXControlsTestApp
 
             if (ApiInformation.IsTypePresent("Windows.UI.Xaml.Input.XamlUICommand"))
             {
-                XamlUICommand uiCommand = new XamlUICommand
+                uiCommand = new XamlUICommand
                 {
                     Label = "UICommand Label",
                     IconSource = new SymbolIconSource { Symbol = Symbol.Setting }
@@ -146,6 +148,33 @@ namespace MUXControlsTestApp
             TextBox.Text = "";
         }
 
+        private void OnChangeUICommandLabelClick(object sender, RoutedEventArgs args)
+        {
+            if (uiCommand != null)
+            {
+                uiCommand.Label = "Changed UICommand Label";
+            }
+        }
+
+        private void OnMeasureUICommandPropagationClick(object sender, RoutedEventArgs args)
+        {
+            if (uiCommand != null)
+            {
+                const int itemCount = 1000;
+                var items = new List<SwipeItem>(itemCount);
+
+                var stopwatch = Stopwatch.StartNew();
+                for (int i = 0; i < itemCount; i++)
+                {
+                    items.Add(new SwipeItem() { Command = uiCommand });
+                }
+                stopwatch.Stop();
+
+                bool allItemsHaveLabel = items.TrueForAll(item => item.Text == uiCommand.Label);
+                UICommandPropagationTextBlock.Text = allItemsHaveLabel ? stopwatch.ElapsedMilliseconds.ToString() : "Missing label";
+            }
+        }
+
         private void PrintGridWidth()
         {
             String newText = "";
@@ -7,6 +7,7 @@
 #include "SwipeItems.h"
 #include "SwipeItemInvokedEventArgs.h"
 #include "SwipeItem.h"
+#include "SwipeTestHooks.h"
 #include "RuntimeProfiler.h"
 #include "CommandingHelpers.h"
 
@@ -17,6 +18,8 @@
 static const double s_swipeItemWidth = 68.0;
 static const double s_swipeItemHeight = 60.0;
 
+thread_local int SwipeItem::s_generateControlCount{ 0 };
+
 SwipeItem::SwipeItem()
 {
     __RP_Marker_ClassById(RuntimeProfiler::ProfId_SwipeItem);
@@ -51,14 +54,31 @@ void SwipeItem::InvokeSwipe(const winrt::SwipeControl& swipeControl)
 
 void SwipeItem::OnPropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args)
 {
-    if (args.Property() == winrt::SwipeItem::CommandProperty())
+    auto const property = args.Property();
+
+    if (property == winrt::SwipeItem::CommandProperty())
     {
         OnCommandChanged(args.OldValue().as<winrt::ICommand>(), args.NewValue().as<winrt::ICommand>());
     }
+    else if (property == winrt::SwipeItem::TextProperty() ||
+        property == winrt::SwipeItem::IconSourceProperty() ||
+        property == winrt::SwipeItem::BackgroundProperty() ||
+        property == winrt::SwipeItem::ForegroundProperty())
+    {
+        m_visualVersion++;
+    }
 }
 
-void SwipeItem::OnCommandChanged(const winrt::ICommand& /*oldCommand*/, const winrt::ICommand& newCommand)
+void SwipeItem::OnCommandChanged(const winrt::ICommand& oldCommand, const winrt::ICommand& newCommand)
 {
+    // Values propagated from the old command are local values, which the IfUnset helpers below would
+    // mistake for app-set ones, so clear them and stop listening to the old command first.
+    if (auto oldUICommand = oldCommand.try_as<winrt::XamlUICommand>())
+    {
+        CommandingHelpers::ClearPropagatedValueIfSet(oldUICommand, *this, winrt::SwipeItem::TextProperty());
+        CommandingHelpers::ClearPropagatedValueIfSet(oldUICommand, *this, winrt::SwipeItem::IconSourceProperty());
+    }
+
     if (auto newUICommand = newCommand.try_as<winrt::XamlUICommand>())
     {
         CommandingHelpers::BindToLabelPropertyIfUnset(newUICommand, *this, winrt::SwipeItem::TextProperty());
@@ -68,6 +88,11 @@ void SwipeItem::OnCommandChanged(const winrt::ICommand& /*oldCommand*/, const wi
 
 void SwipeItem::GenerateControl(const winrt::AppBarButton& appBarButton, const winrt::Style& swipeItemStyle)
 {
+    if (SwipeTestHooks::GetGlobalTestHooks())
+    {
+        s_generateControlCount++;
+    }
+
     appBarButton.Style(swipeItemStyle);
     if (Background())
     {
@@ -17,6 +17,13 @@ public:
 
     void GenerateControl(const winrt::AppBarButton& appBarButton, const winrt::Style& swipeItemStyle);
 
+    // Incremented whenever a property that GenerateControl copies onto the button changes,
+    // so that SwipeControl knows when the visuals it keeps for this item are out of date.
+    uint32_t VisualVersion() const { return m_visualVersion; }
+
+    // Number of calls to GenerateControl on this thread once the SwipeTestHooks exist. Used by tests.
+    static int GenerateControlCount() { return s_generateControlCount; }
+
     void InvokeSwipe(const winrt::SwipeControl& content);
 
 private:
@@ -31,4 +38,8 @@ private:
     void OnCommandChanged(const winrt::ICommand& oldCommand, const winrt::ICommand& newCommand);
     
     void AttachEventHandlers(const winrt::AppBarButton& appBarButton);
+
+    uint32_t m_visualVersion{ 0 };
+
+    static thread_local int s_generateControlCount;
 };
@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "common.h"
 #include "SwipeTestHooksFactory.h"
+#include "SwipeItem.h"
 
 com_ptr<SwipeTestHooks> SwipeTestHooks::s_testHooks{};
 
@@ -53,6 +54,20 @@ bool SwipeTestHooks::GetIsIdle(const winrt::SwipeControl& swipeControl)
     }
 }
 
+void SwipeTestHooks::SimulateSwipeDirectionChange(const winrt::SwipeControl& swipeControl, bool toNearContent)
+{
+    if (swipeControl)
+    {
+        winrt::get_self<SwipeControl>(swipeControl)->SimulateSwipeDirectionChange(toNearContent);
+    }
+}
+
+int SwipeTestHooks::GetSwipeItemGenerateControlCount()
+{
+    EnsureGlobalTestHooks();
+    return SwipeItem::GenerateControlCount();
+}
+
 void SwipeTestHooks::NotifyLastInteractedWithSwipeControlChanged()
 {
     auto hooks = EnsureGlobalTestHooks();
@@ -21,6 +21,8 @@ public:
     static winrt::SwipeControl GetLastInteractedWithSwipeControl();
     static bool GetIsOpen(const winrt::SwipeControl& swipeControl);
     static bool GetIsIdle(const winrt::SwipeControl& swipeControl);
+    static void SimulateSwipeDirectionChange(const winrt::SwipeControl& swipeControl, bool toNearContent);
+    static int GetSwipeItemGenerateControlCount();
 
     static void NotifyLastInteractedWithSwipeControlChanged();
     static winrt::event_token LastInteractedWithSwipeControlChanged(winrt::TypedEventHandler<winrt::IInspectable, winrt::IInspectable> const& value);
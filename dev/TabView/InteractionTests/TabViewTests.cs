@@ -475,6 +475,86 @@ namespace Windows.UI.Xaml.Tests.MUXControls.InteractionTests
             }
         }
 
+        [TestMethod]
+        public void CachedTabContentTest()
+        {
+            using (var setup = new TestSetupHelper("TabView Tests"))
+            {
+                Log.Comment("Keep the content of the two most recently selected tabs alive.");
+                CheckBox cachedTabContentCheckBox = FindElement.ByName<CheckBox>("CachedTabContentCheckBox");
+                cachedTabContentCheckBox.Check();
+                Wait.ForIdle();
+
+                TextBlock cachedTabContentEvictedTextBlock = FindElement.ByName<TextBlock>("CachedTabContentEvictedTextBlock");
+
+                Log.Comment("Selecting a second tab should not evict anything.");
+                UIObject lastTab = FindElement.ByName("LastTab");
+                lastTab.Click();
+                Wait.ForIdle();
+                Verify.AreEqual(cachedTabContentEvictedTextBlock.DocumentText, "");
+
+                Log.Comment("Selecting a third tab should evict the least recently selected one.");
+                UIObject secondTab = FindElement.ByName("SecondTab");
+                secondTab.Click();
+                Wait.ForIdle();
+                Verify.AreEqual(cachedTabContentEvictedTextBlock.DocumentText, "Home");
+
+                Log.Comment("Verify content is displayed when going back to a cached tab.");
+                lastTab.Click();
+                Wait.ForIdle();
+                ElementCache.Refresh();
+                UIObject tabContent = FindElement.ByName("LastTabContent");
+                Verify.IsNotNull(tabContent);
+                Verify.AreEqual(cachedTabContentEvictedTextBlock.DocumentText, "Home");
+            }
+        }
+
+        [TestMethod]
+        public void ItemsSourceKeyboardTest()
+        {
+            using (var setup = new TestSetupHelper("TabView Tests"))
+            {
+                ComboBox dataBindingSourceComboBox = FindElement.ByName<ComboBox>("DataBindingSourceComboBox");
+                TextBlock selectedIndexTextBlock = FindElement.ByName<TextBlock>("DataBindingSelectedIndexTextBlock");
+
+                foreach (var source in new string[] { "Observable", "Vector", "Iterable" })
+                {
+                    Log.Comment("Use a TabItemsSource of kind " + source);
+                    dataBindingSourceComboBox.SelectItemByName(source);
+                    Wait.ForIdle();
+                    ElementCache.Refresh();
+
+                    VerifyKeyboardWrapsAroundDataBoundTabs(selectedIndexTextBlock, 5);
+                }
+
+                Log.Comment("Items added to an observable source should be accounted for.");
+                dataBindingSourceComboBox.SelectItemByName("Observable");
+                Wait.ForIdle();
+                FindElement.ByName<Button>("AddDataBindingItemButton").InvokeAndWait();
+                ElementCache.Refresh();
+
+                VerifyKeyboardWrapsAroundDataBoundTabs(selectedIndexTextBlock, 6);
+            }
+        }
+
+        void VerifyKeyboardWrapsAroundDataBoundTabs(TextBlock selectedIndexTextBlock, int itemCount)
+        {
+            UIObject firstTab = FindElement.ByName("Item 0");
+            firstTab.Click();
+            Wait.ForIdle();
+            Verify.AreEqual("0", selectedIndexTextBlock.DocumentText);
+
+            Log.Comment("Ctrl+Shift+Tab from the first tab should select the last one.");
+            KeyboardHelper.PressKey(Key.Tab, ModifierKey.Control | ModifierKey.Shift);
+            Wait.ForIdle();
+            Verify.AreEqual((itemCount - 1).ToString(), selectedIndexTextBlock.DocumentText);
+
+            Log.Comment("Ctrl+Tab from the last tab should select the first one.");
+            KeyboardHelper.PressKey(Key.Tab, ModifierKey.Control);
+            Wait.ForIdle();
+            Verify.AreEqual("0", selectedIndexTextBlock.DocumentText);
+        }
+
         public void PressButtonAndVerifyText(String buttonName, String textBlockName, String expectedText)
         {
             Button button = FindElement.ByName<Button>(buttonName);
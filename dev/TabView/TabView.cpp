@@ -5,6 +5,7 @@
 #include "common.h"
 #include "TabView.h"
 #include "TabViewItem.h"
+#include "TabViewListView.h"
 #include "TabViewAutomationPeer.h"
 #include "DoubleUtil.h"
 #include "RuntimeProfiler.h"
@@ -67,6 +68,18 @@ void TabView::OnApplyTemplate()
 {
     winrt::IControlProtected controlProtected{ *this };
 
+    // The content cache host can only live in one ContentPresenter, release it from the previous template.
+    if (auto oldTabContentPresenter = m_tabContentPresenter.get())
+    {
+        if (auto host = m_tabContentCacheHost.get())
+        {
+            if (oldTabContentPresenter.Content() == host)
+            {
+                oldTabContentPresenter.Content(nullptr);
+            }
+        }
+    }
+
     m_tabContentPresenter.set(GetTemplateChildT<winrt::ContentPresenter>(L"TabContentPresenter", controlProtected));
     m_rightContentPresenter.set(GetTemplateChildT<winrt::ContentPresenter>(L"RightContentPresenter", controlProtected));
     
@@ -81,6 +94,11 @@ void TabView::OnApplyTemplate()
         auto listView = GetTemplateChildT<winrt::ListView>(L"TabListView", controlProtected);
         if (listView)
         {
+            if (auto tabListView = listView.try_as<winrt::TabViewListView>())
+            {
+                winrt::get_self<TabViewListView>(tabListView)->SetTabViewParent(*this);
+            }
+
             m_listViewLoadedRevoker = listView.Loaded(winrt::auto_revoke, { this, &TabView::OnListViewLoaded });
             m_listViewSelectionChangedRevoker = listView.SelectionChanged(winrt::auto_revoke, { this, &TabView::OnListViewSelectionChanged });
 
@@ -192,6 +210,41 @@ void TabView::OnTabWidthModePropertyChanged(const winrt::DependencyPropertyChang
     UpdateTabWidths();
 }
 
+void TabView::OnTabItemsSourcePropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args)
+{
+    auto newValue = args.NewValue();
+    m_tabItemsSourceView = newValue ? winrt::ItemsSourceView(newValue) : nullptr;
+}
+
+void TabView::CoerceToGreaterThanOrEqualToZero(int& value)
+{
+    // Property coercion for CachedTabContentCount
+    value = std::max(value, 0);
+}
+
+void TabView::OnCachedTabContentCountPropertyChanged(const winrt::DependencyPropertyChangedEventArgs&)
+{
+    const int cachedTabContentCount = CachedTabContentCount();
+    TrimCachedTabContent(static_cast<size_t>(cachedTabContentCount));
+
+    if (cachedTabContentCount == 0)
+    {
+        if (auto host = m_tabContentCacheHost.get())
+        {
+            if (auto tabContentPresenter = m_tabContentPresenter.get())
+            {
+                if (tabContentPresenter.Content() == host)
+                {
+                    tabContentPresenter.Content(nullptr);
+                }
+            }
+            m_tabContentCacheHost.set(nullptr);
+        }
+    }
+
+    UpdateTabContent();
+}
+
 void TabView::OnAddButtonClick(const winrt::IInspectable&, const winrt::RoutedEventArgs& args)
 {
     m_addTabButtonClickEventSource(*this, args);
@@ -304,6 +357,11 @@ void TabView::OnItemsChanged(winrt::IInspectable const& item)
                 } while (index != startIndex);
             }
         }
+
+        if (args.CollectionChange() == winrt::CollectionChange::ItemRemoved || args.CollectionChange() == winrt::CollectionChange::Reset)
+        {
+            RemoveCachedTabContentForRemovedTabs();
+        }
     }
 
     UpdateTabWidths();
@@ -336,12 +394,12 @@ winrt::TabViewItem TabView::FindTabViewItemFromDragItem(const winrt::IInspectabl
 
     if (!tab)
     {
-        // This is a fallback scenario for tabs without a data context
-        auto numItems = static_cast<int>(TabItems().Size());
-        for (int i = 0; i < numItems; i++)
+        // This is a fallback scenario for tabs without a data context.
+        // Only realized containers can be dragged, so there is no need to look beyond them.
+        for (auto const& [containerItem, weakContainer] : m_containersByItem)
         {
-            auto tabItem = ContainerFromIndex(i).try_as<winrt::TabViewItem>();
-            if (tabItem.Content() == item)
+            auto tabItem = weakContainer.get();
+            if (tabItem && tabItem.Content() == item)
             {
                 tab = tabItem;
                 break;
@@ -391,11 +449,20 @@ void TabView::UpdateTabContent()
 {
     if (auto tabContentPresenter = m_tabContentPresenter.get())
     {
+        const bool isContentCacheEnabled = CachedTabContentCount() > 0;
+
         if (!SelectedItem())
         {
-            tabContentPresenter.Content(nullptr);
-            tabContentPresenter.ContentTemplate(nullptr);
-            tabContentPresenter.ContentTemplateSelector(nullptr);
+            if (isContentCacheEnabled)
+            {
+                ShowCachedTabContent(tabContentPresenter, nullptr);
+            }
+            else
+            {
+                tabContentPresenter.Content(nullptr);
+                tabContentPresenter.ContentTemplate(nullptr);
+                tabContentPresenter.ContentTemplateSelector(nullptr);
+            }
         }
         else
         {
@@ -417,13 +484,24 @@ void TabView::UpdateTabContent()
                     shouldMoveFocusToNewTab = true;
                 });
 
-                tabContentPresenter.Content(tvi.Content());
-                tabContentPresenter.ContentTemplate(tvi.ContentTemplate());
-                tabContentPresenter.ContentTemplateSelector(tvi.ContentTemplateSelector());
+                bool isContentRealized = false;
+                if (isContentCacheEnabled)
+                {
+                    isContentRealized = ShowCachedTabContent(tabContentPresenter, tvi);
+                }
+                else
+                {
+                    tabContentPresenter.Content(tvi.Content());
+                    tabContentPresenter.ContentTemplate(tvi.ContentTemplate());
+                    tabContentPresenter.ContentTemplateSelector(tvi.ContentTemplateSelector());
+                }
 
                 // It is not ideal to call UpdateLayout here, but it is necessary to ensure that the ContentPresenter has expanded its content
-                // into the live visual tree.
-                tabContentPresenter.UpdateLayout();
+                // into the live visual tree. Content that was kept alive by the cache is already in the tree.
+                if (!isContentRealized)
+                {
+                    tabContentPresenter.UpdateLayout();
+                }
 
                 if (shouldMoveFocusToNewTab)
                 {
@@ -444,6 +522,148 @@ void TabView::UpdateTabContent()
     }
 }
 
+// Makes the cached content of the given tab the visible one, creating it if needed, and returns
+// whether the content was already realized. Passing a null tab hides all the cached content.
+bool TabView::ShowCachedTabContent(const winrt::ContentPresenter& tabContentPresenter, const winrt::TabViewItem& tab)
+{
+    auto host = m_tabContentCacheHost.get();
+    if (!host)
+    {
+        host = winrt::Grid();
+        m_tabContentCacheHost.set(host);
+    }
+
+    if (tabContentPresenter.Content() != host)
+    {
+        tabContentPresenter.ContentTemplate(nullptr);
+        tabContentPresenter.ContentTemplateSelector(nullptr);
+        tabContentPresenter.Content(host);
+    }
+
+    bool isContentRealized = false;
+    if (tab)
+    {
+        auto it = std::find_if(m_cachedTabContent.begin(), m_cachedTabContent.end(), [&tab](const CachedTabContent& entry) { return entry.tab.get() == tab; });
+        if (it != m_cachedTabContent.end())
+        {
+            // Most recently selected tab goes first.
+            std::rotate(m_cachedTabContent.begin(), it, it + 1);
+
+            auto presenter = m_cachedTabContent.front().presenter.get();
+            isContentRealized = presenter.Content() == tab.Content() &&
+                presenter.ContentTemplate() == tab.ContentTemplate() &&
+                presenter.ContentTemplateSelector() == tab.ContentTemplateSelector();
+        }
+        else
+        {
+            winrt::ContentPresenter presenter;
+            host.Children().Append(presenter);
+            m_cachedTabContent.emplace(m_cachedTabContent.begin(), this, tab, presenter);
+        }
+
+        if (!isContentRealized)
+        {
+            auto presenter = m_cachedTabContent.front().presenter.get();
+            presenter.Content(tab.Content());
+            presenter.ContentTemplate(tab.ContentTemplate());
+            presenter.ContentTemplateSelector(tab.ContentTemplateSelector());
+        }
+    }
+
+    for (size_t i = 0; i < m_cachedTabContent.size(); i++)
+    {
+        m_cachedTabContent[i].presenter.get().Visibility(tab && i == 0 ? winrt::Visibility::Visible : winrt::Visibility::Collapsed);
+    }
+
+    TrimCachedTabContent(static_cast<size_t>(CachedTabContentCount()));
+
+    return isContentRealized;
+}
+
+void TabView::TrimCachedTabContent(size_t maxCount)
+{
+    std::vector<size_t> indices;
+    for (size_t i = maxCount; i < m_cachedTabContent.size(); i++)
+    {
+        indices.push_back(i);
+    }
+
+    EvictCachedTabContent(indices);
+}
+
+void TabView::RemoveCachedTabContentForRemovedTabs()
+{
+    if (auto listView = m_listView.get())
+    {
+        std::vector<size_t> indices;
+        for (size_t i = 0; i < m_cachedTabContent.size(); i++)
+        {
+            auto tab = m_cachedTabContent[i].tab.get();
+            if (!tab || listView.IndexFromContainer(tab) == -1)
+            {
+                indices.push_back(i);
+            }
+        }
+
+        EvictCachedTabContent(indices);
+    }
+}
+
+void TabView::ClearCachedTabContent()
+{
+    // The content of the displayed tab stays in the cache, it is still in use.
+    const bool isDisplayingCachedContent = !m_cachedTabContent.empty() &&
+        m_cachedTabContent.front().presenter.get().Visibility() == winrt::Visibility::Visible;
+
+    TrimCachedTabContent(isDisplayingCachedContent ? 1 : 0);
+}
+
+// Indices are expected in ascending order.
+void TabView::EvictCachedTabContent(std::vector<size_t> const& indices)
+{
+    if (indices.empty())
+    {
+        return;
+    }
+
+    std::vector<std::pair<winrt::TabViewItem, winrt::IInspectable>> evicted;
+    auto host = m_tabContentCacheHost.get();
+
+    for (auto it = indices.rbegin(); it != indices.rend(); ++it)
+    {
+        auto& entry = m_cachedTabContent[*it];
+        auto presenter = entry.presenter.get();
+        auto content = presenter.Content();
+
+        if (host)
+        {
+            uint32_t index{};
+            if (host.Children().IndexOf(presenter, index))
+            {
+                host.Children().RemoveAt(index);
+            }
+        }
+        presenter.Content(nullptr);
+        presenter.ContentTemplate(nullptr);
+        presenter.ContentTemplateSelector(nullptr);
+
+        evicted.emplace_back(entry.tab.get(), content);
+        m_cachedTabContent.erase(m_cachedTabContent.begin() + *it);
+    }
+
+    // Raise the events once the cache is in a consistent state, handlers are allowed to select tabs or change the cache.
+    for (auto const& [tab, content] : evicted)
+    {
+        winrt::IInspectable item{ nullptr };
+        if (tab)
+        {
+            item = ItemFromContainer(tab);
+        }
+        auto args = winrt::make_self<TabViewCachedTabContentEvictedEventArgs>(item, tab, content);
+        m_cachedTabContentEvictedEventSource(*this, *args);
+    }
+}
+
 void TabView::RequestCloseTab(winrt::TabViewItem const& container)
 {
     if (auto listView = m_listView.get())
@@ -596,8 +816,50 @@ void TabView::UpdateSelectedIndex()
     }
 }
 
+// Boxed values (strings, numbers...) get a new identity each time they are boxed, so they can't be found by identity.
+// ContainerFromItem leaves those to the ListView, which compares them by value.
+static bool IsItemKeyedByIdentity(winrt::IInspectable const& item)
+{
+    return item && !item.try_as<winrt::IPropertyValue>();
+}
+
+void TabView::OnContainerPrepared(winrt::DependencyObject const& container, winrt::IInspectable const& item)
+{
+    if (auto tab = container.try_as<winrt::TabViewItem>())
+    {
+        if (IsItemKeyedByIdentity(item))
+        {
+            m_containersByItem[item.as<winrt::IUnknown>()] = winrt::make_weak(tab);
+        }
+    }
+}
+
+void TabView::OnContainerCleared(winrt::DependencyObject const& container, winrt::IInspectable const& item)
+{
+    if (IsItemKeyedByIdentity(item))
+    {
+        auto it = m_containersByItem.find(item.as<winrt::IUnknown>());
+        if (it != m_containersByItem.end() && it->second.get() == container)
+        {
+            m_containersByItem.erase(it);
+        }
+    }
+}
+
 winrt::DependencyObject TabView::ContainerFromItem(winrt::IInspectable const& item)
 {
+    if (IsItemKeyedByIdentity(item))
+    {
+        auto it = m_containersByItem.find(item.as<winrt::IUnknown>());
+        if (it != m_containersByItem.end())
+        {
+            if (auto container = it->second.get())
+            {
+                return container;
+            }
+        }
+    }
+
     if (auto listView = m_listView.get())
     {
         return listView.ContainerFromItem(item);
@@ -625,19 +887,9 @@ winrt::IInspectable TabView::ItemFromContainer(winrt::DependencyObject const& co
 
 int TabView::GetItemCount()
 {
-    if (auto itemssource = TabItemsSource())
+    if (m_tabItemsSourceView)
     {
-        if (auto iterable = itemssource.try_as<winrt::IIterable<winrt::IInspectable>>())
-        {
-            int i = 1;
-            auto iter = iterable.First();
-            while (iter.MoveNext())
-            {
-                i++;
-            }
-            return i;
-        }
-        return 0;
+        return m_tabItemsSourceView.Count();
     }
     else
     {
@@ -12,6 +12,7 @@
 #include "TabViewTabDroppedOutsideEventArgs.g.h"
 #include "TabViewTabDragStartingEventArgs.g.h"
 #include "TabViewTabDragCompletedEventArgs.g.h"
+#include "TabViewCachedTabContentEvictedEventArgs.g.h"
 #include "DispatcherHelper.h"
 
 class TabViewTabCloseRequestedEventArgs :
@@ -76,6 +77,22 @@ private:
     winrt::TabViewItem m_tab{};
 };
 
+class TabViewCachedTabContentEvictedEventArgs :
+    public winrt::implementation::TabViewCachedTabContentEvictedEventArgsT<TabViewCachedTabContentEvictedEventArgs>
+{
+public:
+    TabViewCachedTabContentEvictedEventArgs(winrt::IInspectable const& item, winrt::TabViewItem tab, winrt::IInspectable const& content) : m_item(item), m_tab(tab), m_content(content) {}
+
+    winrt::IInspectable Item() { return m_item; }
+    winrt::TabViewItem Tab() { return m_tab; }
+    winrt::IInspectable Content() { return m_content; }
+
+private:
+    winrt::IInspectable m_item{};
+    winrt::TabViewItem m_tab{ nullptr };
+    winrt::IInspectable m_content{};
+};
+
 class TabView :
     public ReferenceTracker<TabView, winrt::implementation::TabViewT>,
     public TabViewProperties
@@ -100,6 +117,9 @@ public:
 
     // Internal
     void OnTabWidthModePropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args);
+    void OnCachedTabContentCountPropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args);
+    void CoerceToGreaterThanOrEqualToZero(int& value);
+    void OnTabItemsSourcePropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args);
     void OnSelectedIndexPropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args);
     void OnSelectedItemPropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args);
 
@@ -108,6 +128,11 @@ public:
 
     void RequestCloseTab(winrt::TabViewItem const& item);
 
+    void OnContainerPrepared(winrt::DependencyObject const& container, winrt::IInspectable const& item);
+    void OnContainerCleared(winrt::DependencyObject const& container, winrt::IInspectable const& item);
+
+    void ClearCachedTabContent();
+
 private:
     void OnLoaded(const winrt::IInspectable& sender, const winrt::RoutedEventArgs& args);
     void OnScrollViewerLoaded(const winrt::IInspectable& sender, const winrt::RoutedEventArgs& args);
@@ -142,6 +167,11 @@ private:
 
     winrt::TabViewItem FindTabViewItemFromDragItem(const winrt::IInspectable& item);
 
+    bool ShowCachedTabContent(const winrt::ContentPresenter& tabContentPresenter, const winrt::TabViewItem& tab);
+    void TrimCachedTabContent(size_t maxCount);
+    void RemoveCachedTabContentForRemovedTabs();
+    void EvictCachedTabContent(std::vector<size_t> const& indices);
+
     tracker_ref<winrt::ColumnDefinition> m_leftContentColumn{ this };
     tracker_ref<winrt::ColumnDefinition> m_tabColumn{ this };
     tracker_ref<winrt::ColumnDefinition> m_addButtonColumn{ this };
@@ -154,6 +184,26 @@ private:
     tracker_ref<winrt::FxScrollViewer> m_scrollViewer{ this };
     tracker_ref<winrt::Button> m_addButton{ this };
 
+    // When CachedTabContentCount is set, the content of the most recently selected tabs is kept alive
+    // in m_tabContentCacheHost, each in its own ContentPresenter, ordered from most to least recently selected.
+    struct CachedTabContent
+    {
+        CachedTabContent(const ITrackerHandleManager* owner, const winrt::TabViewItem& tab, const winrt::ContentPresenter& presenter) :
+            tab(winrt::make_weak(tab)), presenter(owner, presenter) {}
+
+        winrt::weak_ref<winrt::TabViewItem> tab;
+        tracker_ref<winrt::ContentPresenter> presenter;
+    };
+
+    tracker_ref<winrt::Grid> m_tabContentCacheHost{ this };
+    std::vector<CachedTabContent> m_cachedTabContent;
+
+    // Gives constant time access to the size of TabItemsSource, whatever kind of collection it is.
+    winrt::ItemsSourceView m_tabItemsSourceView{ nullptr };
+
+    // Realized containers by item identity, kept up to date as the ListView prepares and clears its containers.
+    std::unordered_map<winrt::IUnknown, winrt::weak_ref<winrt::TabViewItem>> m_containersByItem;
+
     winrt::ListView::Loaded_revoker m_listViewLoadedRevoker{};
     winrt::Selector::SelectionChanged_revoker m_listViewSelectionChangedRevoker{};
     winrt::UIElement::GettingFocus_revoker m_listViewGettingFocusRevoker{};
@@ -40,16 +40,43 @@ void TabViewListView::OnItemsChanged(winrt::IInspectable const& item)
 {
     __super::OnItemsChanged(item);
 
-    if (auto tabView = SharedHelpers::GetAncestorOfType<winrt::TabView>(winrt::VisualTreeHelper::GetParent(*this)))
+    if (auto tabView = m_tabView.get())
     {
         auto internalTabView = winrt::get_self<TabView>(tabView);
         internalTabView->OnItemsChanged(item);
     }
 }
 
+void TabViewListView::PrepareContainerForItemOverride(winrt::DependencyObject const& element, winrt::IInspectable const& item)
+{
+    __super::PrepareContainerForItemOverride(element, item);
+
+    if (auto tabView = m_tabView.get())
+    {
+        auto internalTabView = winrt::get_self<TabView>(tabView);
+        internalTabView->OnContainerPrepared(element, item);
+    }
+}
+
+void TabViewListView::ClearContainerForItemOverride(winrt::DependencyObject const& element, winrt::IInspectable const& item)
+{
+    if (auto tabView = m_tabView.get())
+    {
+        auto internalTabView = winrt::get_self<TabView>(tabView);
+        internalTabView->OnContainerCleared(element, item);
+    }
+
+    __super::ClearContainerForItemOverride(element, item);
+}
+
+void TabViewListView::SetTabViewParent(winrt::TabView const& tabView)
+{
+    m_tabView = winrt::make_weak(tabView);
+}
+
 void TabViewListView::OnContainerContentChanging(const winrt::IInspectable& sender, const winrt::Windows::UI::Xaml::Controls::ContainerContentChangingEventArgs& args)
 {
-    if (auto tabView = SharedHelpers::GetAncestorOfType<winrt::TabView>(winrt::VisualTreeHelper::GetParent(*this)))
+    if (auto tabView = m_tabView.get())
     {
         auto internalTabView = winrt::get_self<TabView>(tabView);
         internalTabView->UpdateTabContent();
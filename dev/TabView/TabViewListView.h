@@ -14,8 +14,15 @@ public:
     winrt::DependencyObject GetContainerForItemOverride();
     bool IsItemItsOwnContainerOverride(winrt::IInspectable const& item);
     void OnItemsChanged(winrt::IInspectable const& item);
+    void PrepareContainerForItemOverride(winrt::DependencyObject const& element, winrt::IInspectable const& item);
+    void ClearContainerForItemOverride(winrt::DependencyObject const& element, winrt::IInspectable const& item);
+
+    void SetTabViewParent(winrt::TabView const& tabView);
 
 private:
     void OnContainerContentChanging(const winrt::IInspectable& sender, const winrt::ContainerContentChangingEventArgs& args);
+
+    // Set by the TabView when it applies its template, so that container notifications don't have to look it up in the visual tree.
+    winrt::weak_ref<winrt::TabView> m_tabView{};
 };
 
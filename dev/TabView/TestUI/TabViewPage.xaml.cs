@@ -2,6 +2,7 @@
 // Licensed under the MIT License. See LICENSE in the project root for license information.
 
 using System;
+using System.Collections.Generic;
 using Windows.UI.Xaml;
 using Windows.UI.Xaml.Controls;
 using Windows.UI.Xaml.Controls.Primitives;
@@ -44,16 +45,50 @@ namespace MUXControlsTestApp
             _iconSource = new SymbolIconSource();
             _iconSource.Symbol = Symbol.Placeholder;
 
-            ObservableCollection<TabDataItem> itemSource = new ObservableCollection<TabDataItem>();
-            for (int i = 0; i < 5; i++)
+            DataBindingTabView.TabItemsSource = new ObservableCollection<TabDataItem>(CreateTabDataItems(5));
+        }
+
+        private IEnumerable<TabDataItem> CreateTabDataItems(int count)
+        {
+            for (int i = 0; i < count; i++)
             {
                 var item = new TabDataItem();
                 item.IconSource = _iconSource;
                 item.Header = "Item " + i;
                 item.Content = "This is tab " + i + ".";
-                itemSource.Add(item);
+                yield return item;
+            }
+        }
+
+        private void DataBindingSourceComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (DataBindingTabView != null)
+            {
+                switch (DataBindingSourceComboBox.SelectedIndex)
+                {
+                    case 0: DataBindingTabView.TabItemsSource = new ObservableCollection<TabDataItem>(CreateTabDataItems(5)); break;
+                    case 1: DataBindingTabView.TabItemsSource = new List<TabDataItem>(CreateTabDataItems(5)); break;
+                    // Only exposes IIterable
+                    case 2: DataBindingTabView.TabItemsSource = CreateTabDataItems(5); break;
+                }
+            }
+        }
+
+        private void AddDataBindingItemButton_Click(object sender, RoutedEventArgs e)
+        {
+            if (DataBindingTabView.TabItemsSource is ObservableCollection<TabDataItem> items)
+            {
+                var item = new TabDataItem();
+                item.IconSource = _iconSource;
+                item.Header = "Item " + items.Count;
+                item.Content = "This is tab " + items.Count + ".";
+                items.Add(item);
             }
-            DataBindingTabView.TabItemsSource = itemSource;
+        }
+
+        private void DataBindingTabViewSelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            DataBindingSelectedIndexTextBlock.Text = DataBindingTabView.SelectedIndex.ToString();
         }
 
         public void IsClosableCheckBox_CheckChanged(object sender, RoutedEventArgs e)
@@ -64,6 +99,14 @@ namespace MUXControlsTestApp
             }
         }
 
+        public void CachedTabContentCheckBox_CheckChanged(object sender, RoutedEventArgs e)
+        {
+            if (Tabs != null)
+            {
+                Tabs.CachedTabContentCount = (bool)CachedTabContentCheckBox.IsChecked ? 2 : 0;
+            }
+        }
+
         public void AddButtonClick(object sender, object e)
         {
             if (Tabs != null)
@@ -202,6 +245,15 @@ namespace MUXControlsTestApp
             }
         }
 
+        private void TabViewCachedTabContentEvicted(TabView sender, TabViewCachedTabContentEvictedEventArgs e)
+        {
+            TabViewItem tab = e.Tab;
+            if (tab != null)
+            {
+                CachedTabContentEvictedTextBlock.Text = tab.Header.ToString();
+            }
+        }
+
         // Drag/drop stuff
 
         private const string DataIdentifier = "MyTabItem";
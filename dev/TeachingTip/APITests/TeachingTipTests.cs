@@ -128,6 +128,63 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        [TestProperty("TestPass:IncludeOnlyOn", "Desktop")] // TeachingTip doesn't appear to show up correctly in OneCore.
+        public void TeachingTipsShareAnimations()
+        {
+            const int tipCount = 10;
+            var teachingTips = new List<TeachingTip>();
+            int animationObjectCount = 0;
+            RunOnUIThread.Execute(() =>
+            {
+                Grid root = new Grid();
+                for (int i = 0; i < tipCount; i++)
+                {
+                    var teachingTip = new TeachingTip();
+                    root.Resources.Add("TeachingTip" + i, teachingTip);
+                    teachingTips.Add(teachingTip);
+                }
+
+                MUXControlsTestApp.App.TestContentRoot = root;
+                teachingTips[0].IsOpen = true;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                animationObjectCount = TeachingTipTestHooks.GetCreatedAnimationObjectCount();
+                Log.Comment("Animation objects created after opening the first tip: " + animationObjectCount);
+                for (int i = 1; i < tipCount; i++)
+                {
+                    teachingTips[i].IsOpen = true;
+                }
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual(animationObjectCount, TeachingTipTestHooks.GetCreatedAnimationObjectCount(), "Other tips reuse the same animations");
+
+                Log.Comment("A tip with a custom easing function gets its own expand animations.");
+                TeachingTipTestHooks.SetExpandEasingFunction(teachingTips[0], Window.Current.Compositor.CreateLinearEasingFunction());
+                Verify.AreEqual(animationObjectCount + 2, TeachingTipTestHooks.GetCreatedAnimationObjectCount());
+
+                foreach (var teachingTip in teachingTips)
+                {
+                    teachingTip.IsOpen = false;
+                }
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                MUXControlsTestApp.App.TestContentRoot = null;
+            });
+        }
+
         [TestMethod]
         public void TeachingTipWithContentAndWithoutHeroContentDoesNotCrash()
         {
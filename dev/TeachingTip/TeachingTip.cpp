@@ -984,7 +984,7 @@ void TeachingTip::OnHeroContentPlacementChanged()
     }
 }
 
-void TeachingTip::OnContentSizeChanged(const winrt::IInspectable&, const winrt::SizeChangedEventArgs& args)
+void TeachingTip::OnContentSizeChanged(const winrt::IInspectable&, const winrt::SizeChangedEventArgs&)
 {
     UpdateSizeBasedTemplateSettings();
     // Reset the currentEffectivePlacementMode so that the tail will be updated for the new size as well.
@@ -994,16 +994,6 @@ void TeachingTip::OnContentSizeChanged(const winrt::IInspectable&, const winrt::
     {
         PositionPopup();
     }
-    if (auto&& expandAnimation = m_expandAnimation.get())
-    {
-        expandAnimation.SetScalarParameter(L"Width", args.NewSize().Width);
-        expandAnimation.SetScalarParameter(L"Height", args.NewSize().Height);
-    }
-    if (auto&& contractAnimation = m_contractAnimation.get())
-    {
-        contractAnimation.SetScalarParameter(L"Width", args.NewSize().Width);
-        contractAnimation.SetScalarParameter(L"Height", args.NewSize().Height);
-    }
 }
 
 void TeachingTip::OnF6AcceleratorKeyClicked(const winrt::CoreDispatcher&, const winrt::AcceleratorKeyEventArgs& args)
@@ -1406,93 +1396,62 @@ void TeachingTip::CreateExpandAnimation()
 {
     auto const compositor = winrt::Window::Current().Compositor();
 
-    auto&& expandEasingFunction = [this, compositor]()
-    {
-        if (!m_expandEasingFunction)
-        {
-            auto const easingFunction = compositor.CreateCubicBezierEasingFunction(s_expandAnimationEasingCurveControlPoint1, s_expandAnimationEasingCurveControlPoint2);
-            m_expandEasingFunction.set(easingFunction);
-            return static_cast<winrt::CompositionEasingFunction>(easingFunction);
-        }
-        return m_expandEasingFunction.get();
-    }();
-
-    m_expandAnimation.set([this, compositor, expandEasingFunction]()
+    if (auto&& expandEasingFunction = m_expandEasingFunction.get())
     {
-        auto const expandAnimation = compositor.CreateVector3KeyFrameAnimation();
-        if (auto&& tailOcclusionGrid = m_tailOcclusionGrid.get())
-        {
-            expandAnimation.SetScalarParameter(L"Width", static_cast<float>(tailOcclusionGrid.ActualWidth()));
-            expandAnimation.SetScalarParameter(L"Height", static_cast<float>(tailOcclusionGrid.ActualHeight()));
-        }
-        else
-        {
-            expandAnimation.SetScalarParameter(L"Width", s_defaultTipHeightAndWidth);
-            expandAnimation.SetScalarParameter(L"Height", s_defaultTipHeightAndWidth);
-        }
-
-        expandAnimation.InsertExpressionKeyFrame(0.0f, L"Vector3(Min(0.01, 20.0 / Width), Min(0.01, 20.0 / Height), 1.0)");
-        expandAnimation.InsertKeyFrame(1.0f, { 1.0f, 1.0f, 1.0f }, expandEasingFunction);
-        expandAnimation.Duration(m_expandAnimationDuration);
-        expandAnimation.Target(s_scaleTargetName);
-        return expandAnimation;
-    }());
-
-    m_expandElevationAnimation.set([this, compositor, expandEasingFunction]()
+        // A custom easing function was provided through the test hooks so this tip cannot use the shared animations.
+        m_expandAnimation.set(TeachingTipAnimations::CreateExpandAnimation(compositor, expandEasingFunction));
+        m_expandElevationAnimation.set(TeachingTipAnimations::CreateExpandElevationAnimation(compositor, expandEasingFunction));
+    }
+    else
     {
-        auto const expandElevationAnimation = compositor.CreateVector3KeyFrameAnimation();
-        expandElevationAnimation.InsertExpressionKeyFrame(1.0f, L"Vector3(this.Target.Translation.X, this.Target.Translation.Y, contentElevation)", expandEasingFunction);
-        expandElevationAnimation.SetScalarParameter(L"contentElevation", m_contentElevation);
-        expandElevationAnimation.Duration(m_expandAnimationDuration);
-        expandElevationAnimation.Target(s_translationTargetName);
-        return expandElevationAnimation;
-    }());
+        auto&& sharedAnimations = EnsureSharedAnimations(compositor);
+        m_expandAnimation.set(sharedAnimations->ExpandAnimation());
+        m_expandElevationAnimation.set(sharedAnimations->ExpandElevationAnimation());
+    }
 }
 
 void TeachingTip::CreateContractAnimation()
 {
     auto const compositor = winrt::Window::Current().Compositor();
 
-    auto&& contractEasingFunction = [this, compositor]()
+    if (auto&& contractEasingFunction = m_contractEasingFunction.get())
     {
-        if (!m_contractEasingFunction)
-        {
-            auto const easingFunction = compositor.CreateCubicBezierEasingFunction(s_contractAnimationEasingCurveControlPoint1, s_contractAnimationEasingCurveControlPoint2);
-            m_contractEasingFunction.set(easingFunction);
-            return static_cast<winrt::CompositionEasingFunction>(easingFunction);
-        }
-        return m_contractEasingFunction.get();
-    }();
-
-    m_contractAnimation.set([this, compositor, contractEasingFunction]()
+        // A custom easing function was provided through the test hooks so this tip cannot use the shared animations.
+        m_contractAnimation.set(TeachingTipAnimations::CreateContractAnimation(compositor, contractEasingFunction));
+        m_contractElevationAnimation.set(TeachingTipAnimations::CreateContractElevationAnimation(compositor, contractEasingFunction));
+    }
+    else
     {
-        auto const contractAnimation = compositor.CreateVector3KeyFrameAnimation();
-        if (auto&& tailOcclusionGrid = m_tailOcclusionGrid.get())
-        {
-            contractAnimation.SetScalarParameter(L"Width", static_cast<float>(tailOcclusionGrid.ActualWidth()));
-            contractAnimation.SetScalarParameter(L"Height", static_cast<float>(tailOcclusionGrid.ActualHeight()));
-        }
-        else
-        {
-            contractAnimation.SetScalarParameter(L"Width", s_defaultTipHeightAndWidth);
-            contractAnimation.SetScalarParameter(L"Height", s_defaultTipHeightAndWidth);
-        }
+        auto&& sharedAnimations = EnsureSharedAnimations(compositor);
+        m_contractAnimation.set(sharedAnimations->ContractAnimation());
+        m_contractElevationAnimation.set(sharedAnimations->ContractElevationAnimation());
+    }
+}
 
-        contractAnimation.InsertKeyFrame(0.0f, { 1.0f, 1.0f, 1.0f });
-        contractAnimation.InsertExpressionKeyFrame(1.0f, L"Vector3(20.0 / Width, 20.0 / Height, 1.0)", contractEasingFunction);
-        contractAnimation.Duration(m_contractAnimationDuration);
-        contractAnimation.Target(s_scaleTargetName);
-        return contractAnimation;
-    }());
+const std::shared_ptr<TeachingTipAnimations>& TeachingTip::EnsureSharedAnimations(const winrt::Compositor& compositor)
+{
+    if (!m_sharedAnimations || m_sharedAnimations->Compositor() != compositor)
+    {
+        m_sharedAnimations = TeachingTipAnimations::GetForCompositor(compositor);
+    }
+    return m_sharedAnimations;
+}
 
-    m_contractElevationAnimation.set([this, compositor, contractEasingFunction]()
+// The animations can be shared with other tips, so the parameters specific to this tip are set
+// right before the animation gets started. Composition takes a copy of the animation at that point.
+void TeachingTip::SetScaleAnimationParameters(const winrt::KeyFrameAnimation& animation, const winrt::TimeSpan& duration)
+{
+    if (auto&& tailOcclusionGrid = m_tailOcclusionGrid.get())
     {
-        auto const contractElevationAnimation = compositor.CreateVector3KeyFrameAnimation();
-        contractElevationAnimation.InsertExpressionKeyFrame(1.0f, L"Vector3(this.Target.Translation.X, this.Target.Translation.Y, 0.0f)", contractEasingFunction);
-        contractElevationAnimation.Duration(m_contractAnimationDuration);
-        contractElevationAnimation.Target(s_translationTargetName);
-        return contractElevationAnimation;
-    }());
+        animation.SetScalarParameter(TeachingTipAnimations::s_widthParameterName, static_cast<float>(tailOcclusionGrid.ActualWidth()));
+        animation.SetScalarParameter(TeachingTipAnimations::s_heightParameterName, static_cast<float>(tailOcclusionGrid.ActualHeight()));
+    }
+    else
+    {
+        animation.SetScalarParameter(TeachingTipAnimations::s_widthParameterName, s_defaultTipHeightAndWidth);
+        animation.SetScalarParameter(TeachingTipAnimations::s_heightParameterName, s_defaultTipHeightAndWidth);
+    }
+    animation.Duration(duration);
 }
 
 void TeachingTip::StartExpandToOpen()
@@ -1509,6 +1468,7 @@ void TeachingTip::StartExpandToOpen()
 
         if (auto&& expandAnimation = m_expandAnimation.get())
         {
+            SetScaleAnimationParameters(expandAnimation, m_expandAnimationDuration);
             if (auto&& tailOcclusionGrid = m_tailOcclusionGrid.get())
             {
                 tailOcclusionGrid.StartAnimation(expandAnimation);
@@ -1522,6 +1482,8 @@ void TeachingTip::StartExpandToOpen()
         }
         if (auto&& expandElevationAnimation = m_expandElevationAnimation.get())
         {
+            expandElevationAnimation.SetScalarParameter(TeachingTipAnimations::s_contentElevationParameterName, m_contentElevation);
+            expandElevationAnimation.Duration(m_expandAnimationDuration);
             if (auto&& contentRootGrid = m_contentRootGrid.get())
             {
                 contentRootGrid.StartAnimation(expandElevationAnimation);
@@ -1561,6 +1523,7 @@ void TeachingTip::StartContractToClose()
         auto const scopedBatch = winrt::Window::Current().Compositor().CreateScopedBatch(winrt::CompositionBatchTypes::Animation);
         if (auto&& contractAnimation = m_contractAnimation.get())
         {
+            SetScaleAnimationParameters(contractAnimation, m_contractAnimationDuration);
             if (auto&& tailOcclusionGrid = m_tailOcclusionGrid.get())
             {
                 tailOcclusionGrid.StartAnimation(contractAnimation);
@@ -1574,6 +1537,7 @@ void TeachingTip::StartContractToClose()
         }
         if (auto&& contractElevationAnimation = m_contractElevationAnimation.get())
         {
+            contractElevationAnimation.Duration(m_contractAnimationDuration);
             if (auto&& contentRootGrid = m_contentRootGrid.get())
             {
                 contentRootGrid.StartAnimation(contractElevationAnimation);
@@ -2161,10 +2125,6 @@ void TeachingTip::SetContentElevation(float elevation)
             auto const contentRootGridTranslation = contentRootGrid.Translation();
             m_contentRootGrid.get().Translation({ contentRootGridTranslation.x, contentRootGridTranslation.y, m_contentElevation });
         }
-        if (m_expandElevationAnimation)
-        {
-            m_expandElevationAnimation.get().SetScalarParameter(L"contentElevation", m_contentElevation);
-        }
     }
 }
 
@@ -2228,27 +2188,11 @@ void TeachingTip::SetReturnTopForOutOfWindowPlacement(bool returnTopForOutOfWind
 void TeachingTip::SetExpandAnimationDuration(const winrt::TimeSpan& expandAnimationDuration)
 {
     m_expandAnimationDuration = expandAnimationDuration;
-    if (auto&& expandAnimation = m_expandAnimation.get())
-    {
-        expandAnimation.Duration(m_expandAnimationDuration);
-    }
-    if (auto&& expandElevationAnimation = m_expandElevationAnimation.get())
-    {
-        expandElevationAnimation.Duration(m_expandAnimationDuration);
-    }
 }
 
 void TeachingTip::SetContractAnimationDuration(const winrt::TimeSpan& contractAnimationDuration)
 {
     m_contractAnimationDuration = contractAnimationDuration;
-    if (auto&& contractAnimation = m_contractAnimation.get())
-    {
-        contractAnimation.Duration(m_contractAnimationDuration);
-    }
-    if (auto&& contractElevationAnimation = m_contractElevationAnimation.get())
-    {
-        contractElevationAnimation.Duration(m_contractAnimationDuration);
-    }
 }
 
 bool TeachingTip::GetIsIdle()
@@ -4,6 +4,7 @@
 #include "common.h"
 
 #include "TeachingTipTemplateSettings.h"
+#include "TeachingTipAnimations.h"
 
 #include "TeachingTip.g.h"
 #include "TeachingTip.properties.h"
@@ -128,6 +129,8 @@ private:
 
     void CreateExpandAnimation();
     void CreateContractAnimation();
+    const std::shared_ptr<TeachingTipAnimations>& EnsureSharedAnimations(const winrt::Compositor& compositor);
+    void SetScaleAnimationParameters(const winrt::KeyFrameAnimation& animation, const winrt::TimeSpan& duration);
 
     void StartExpandToOpen();
     void StartContractToClose();
@@ -179,6 +182,7 @@ private:
     tracker_ref<winrt::KeyFrameAnimation> m_contractElevationAnimation{ this };
     tracker_ref<winrt::CompositionEasingFunction> m_expandEasingFunction{ this };
     tracker_ref<winrt::CompositionEasingFunction> m_contractEasingFunction{ this };
+    std::shared_ptr<TeachingTipAnimations> m_sharedAnimations{ nullptr };
 
     winrt::TeachingTipPlacementMode m_currentEffectiveTipPlacementMode{ winrt::TeachingTipPlacementMode::Auto };
     winrt::TeachingTipPlacementMode m_currentEffectiveTailPlacementMode{ winrt::TeachingTipPlacementMode::Auto };
@@ -255,9 +259,6 @@ private:
     static inline double UntargetedTipCenterPlacementOffset(float nearWindowCoordinateInCoreWindowSpace, float farWindowCoordinateInCoreWindowSpace, double tipSize, double nearOffset, double farOffset) { return ((nearWindowCoordinateInCoreWindowSpace + farWindowCoordinateInCoreWindowSpace) / 2)  - (tipSize / 2) + nearOffset - farOffset; }
     static inline double UntargetedTipNearPlacementOffset(float nearWindowCoordinateInCoreWindowSpace, double offset) { return s_untargetedTipWindowEdgeMargin + nearWindowCoordinateInCoreWindowSpace + offset; }
 
-    static constexpr wstring_view s_scaleTargetName{ L"Scale"sv };
-    static constexpr wstring_view s_translationTargetName{ L"Translation"sv };
-
     static constexpr wstring_view s_containerName{ L"Container"sv };
     static constexpr wstring_view s_popupName{ L"Popup"sv };
     static constexpr wstring_view s_tailOcclusionGridName{ L"TailOcclusionGrid"sv };
@@ -282,11 +283,6 @@ private:
     static constexpr wstring_view s_accentButtonStyleName{ L"AccentButtonStyle" };
     static constexpr wstring_view s_teachingTipTopHighlightBrushName{ L"TeachingTipTopHighlightBrush" };
 
-    static constexpr winrt::float2 s_expandAnimationEasingCurveControlPoint1{ 0.1f, 0.9f };
-    static constexpr winrt::float2 s_expandAnimationEasingCurveControlPoint2{ 0.2f, 1.0f };
-    static constexpr winrt::float2 s_contractAnimationEasingCurveControlPoint1{ 0.7f, 0.0f };
-    static constexpr winrt::float2 s_contractAnimationEasingCurveControlPoint2{ 1.0f, 0.5f };
-
     //It is possible this should be exposed as a property, but you can adjust what it does with margin.
     static constexpr float s_untargetedTipWindowEdgeMargin = 24;
     static constexpr float s_defaultTipHeightAndWidth = 320;
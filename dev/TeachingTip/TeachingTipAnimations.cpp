@@ -0,0 +1,91 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "TeachingTipAnimations.h"
+
+thread_local int TeachingTipAnimations::s_createdAnimationObjectCount{ 0 };
+
+// Only a weak reference is kept so that the animations go away with the last TeachingTip using them.
+static thread_local std::weak_ptr<TeachingTipAnimations> s_animations;
+
+TeachingTipAnimations::TeachingTipAnimations(const winrt::Compositor& compositor) :
+    m_compositor(compositor)
+{
+    auto const expandEasingFunction = CreateExpandEasingFunction(compositor);
+    m_expandAnimation = CreateExpandAnimation(compositor, expandEasingFunction);
+    m_expandElevationAnimation = CreateExpandElevationAnimation(compositor, expandEasingFunction);
+
+    auto const contractEasingFunction = CreateContractEasingFunction(compositor);
+    m_contractAnimation = CreateContractAnimation(compositor, contractEasingFunction);
+    m_contractElevationAnimation = CreateContractElevationAnimation(compositor, contractEasingFunction);
+}
+
+/* static */
+std::shared_ptr<TeachingTipAnimations> TeachingTipAnimations::GetForCompositor(const winrt::Compositor& compositor)
+{
+    auto animations = s_animations.lock();
+    if (!animations || animations->Compositor() != compositor)
+    {
+        animations = std::make_shared<TeachingTipAnimations>(compositor);
+        s_animations = animations;
+    }
+    return animations;
+}
+
+/* static */
+winrt::CompositionEasingFunction TeachingTipAnimations::CreateExpandEasingFunction(const winrt::Compositor& compositor)
+{
+    s_createdAnimationObjectCount++;
+    return compositor.CreateCubicBezierEasingFunction(s_expandAnimationEasingCurveControlPoint1, s_expandAnimationEasingCurveControlPoint2);
+}
+
+/* static */
+winrt::CompositionEasingFunction TeachingTipAnimations::CreateContractEasingFunction(const winrt::Compositor& compositor)
+{
+    s_createdAnimationObjectCount++;
+    return compositor.CreateCubicBezierEasingFunction(s_contractAnimationEasingCurveControlPoint1, s_contractAnimationEasingCurveControlPoint2);
+}
+
+/* static */
+winrt::KeyFrameAnimation TeachingTipAnimations::CreateExpandAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& easingFunction)
+{
+    s_createdAnimationObjectCount++;
+    auto const expandAnimation = compositor.CreateVector3KeyFrameAnimation();
+    expandAnimation.InsertExpressionKeyFrame(0.0f, L"Vector3(Min(0.01, 20.0 / Width), Min(0.01, 20.0 / Height), 1.0)");
+    expandAnimation.InsertKeyFrame(1.0f, { 1.0f, 1.0f, 1.0f }, easingFunction);
+    expandAnimation.Target(s_scaleTargetName);
+    return expandAnimation;
+}
+
+/* static */
+winrt::KeyFrameAnimation TeachingTipAnimations::CreateExpandElevationAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& easingFunction)
+{
+    s_createdAnimationObjectCount++;
+    auto const expandElevationAnimation = compositor.CreateVector3KeyFrameAnimation();
+    expandElevationAnimation.InsertExpressionKeyFrame(1.0f, L"Vector3(this.Target.Translation.X, this.Target.Translation.Y, contentElevation)", easingFunction);
+    expandElevationAnimation.Target(s_translationTargetName);
+    return expandElevationAnimation;
+}
+
+/* static */
+winrt::KeyFrameAnimation TeachingTipAnimations::CreateContractAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& easingFunction)
+{
+    s_createdAnimationObjectCount++;
+    auto const contractAnimation = compositor.CreateVector3KeyFrameAnimation();
+    contractAnimation.InsertKeyFrame(0.0f, { 1.0f, 1.0f, 1.0f });
+    contractAnimation.InsertExpressionKeyFrame(1.0f, L"Vector3(20.0 / Width, 20.0 / Height, 1.0)", easingFunction);
+    contractAnimation.Target(s_scaleTargetName);
+    return contractAnimation;
+}
+
+/* static */
+winrt::KeyFrameAnimation TeachingTipAnimations::CreateContractElevationAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& easingFunction)
+{
+    s_createdAnimationObjectCount++;
+    auto const contractElevationAnimation = compositor.CreateVector3KeyFrameAnimation();
+    contractElevationAnimation.InsertExpressionKeyFrame(1.0f, L"Vector3(this.Target.Translation.X, this.Target.Translation.Y, 0.0f)", easingFunction);
+    contractElevationAnimation.Target(s_translationTargetName);
+    return contractElevationAnimation;
+}
@@ -0,0 +1,53 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// The expand and contract animations of TeachingTip only differ between instances by their parameters
+// (the size of the tip, its elevation and the durations the test hooks can change). Composition copies an
+// animation when it is started, so all the tips of a compositor share one set of animations and easing
+// functions and set their own parameters right before starting them.
+class TeachingTipAnimations
+{
+public:
+    explicit TeachingTipAnimations(const winrt::Compositor& compositor);
+
+    static std::shared_ptr<TeachingTipAnimations> GetForCompositor(const winrt::Compositor& compositor);
+
+    // Number of composition animations and easing functions created for TeachingTips on this thread.
+    static int CreatedAnimationObjectCount() { return s_createdAnimationObjectCount; }
+
+    static winrt::CompositionEasingFunction CreateExpandEasingFunction(const winrt::Compositor& compositor);
+    static winrt::CompositionEasingFunction CreateContractEasingFunction(const winrt::Compositor& compositor);
+    static winrt::KeyFrameAnimation CreateExpandAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& easingFunction);
+    static winrt::KeyFrameAnimation CreateExpandElevationAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& easingFunction);
+    static winrt::KeyFrameAnimation CreateContractAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& easingFunction);
+    static winrt::KeyFrameAnimation CreateContractElevationAnimation(const winrt::Compositor& compositor, const winrt::CompositionEasingFunction& easingFunction);
+
+    winrt::Compositor Compositor() const { return m_compositor; }
+    winrt::KeyFrameAnimation ExpandAnimation() const { return m_expandAnimation; }
+    winrt::KeyFrameAnimation ExpandElevationAnimation() const { return m_expandElevationAnimation; }
+    winrt::KeyFrameAnimation ContractAnimation() const { return m_contractAnimation; }
+    winrt::KeyFrameAnimation ContractElevationAnimation() const { return m_contractElevationAnimation; }
+
+    static constexpr wstring_view s_widthParameterName{ L"Width"sv };
+    static constexpr wstring_view s_heightParameterName{ L"Height"sv };
+    static constexpr wstring_view s_contentElevationParameterName{ L"contentElevation"sv };
+
+private:
+    winrt::Compositor m_compositor{ nullptr };
+    winrt::KeyFrameAnimation m_expandAnimation{ nullptr };
+    winrt::KeyFrameAnimation m_expandElevationAnimation{ nullptr };
+    winrt::KeyFrameAnimation m_contractAnimation{ nullptr };
+    winrt::KeyFrameAnimation m_contractElevationAnimation{ nullptr };
+
+    static thread_local int s_createdAnimationObjectCount;
+
+    static constexpr wstring_view s_scaleTargetName{ L"Scale"sv };
+    static constexpr wstring_view s_translationTargetName{ L"Translation"sv };
+
+    static constexpr winrt::float2 s_expandAnimationEasingCurveControlPoint1{ 0.1f, 0.9f };
+    static constexpr winrt::float2 s_expandAnimationEasingCurveControlPoint2{ 0.2f, 1.0f };
+    static constexpr winrt::float2 s_contractAnimationEasingCurveControlPoint1{ 0.7f, 0.0f };
+    static constexpr winrt::float2 s_contractAnimationEasingCurveControlPoint2{ 1.0f, 0.5f };
+};
@@ -276,3 +276,8 @@ winrt::Popup TeachingTipTestHooks::GetPopup(const winrt::TeachingTip& teachingTi
     }
     return nullptr;
 }
+
+int TeachingTipTestHooks::GetCreatedAnimationObjectCount()
+{
+    return TeachingTipAnimations::CreatedAnimationObjectCount();
+}
@@ -56,6 +56,7 @@ public:
     static void OffsetChanged(winrt::event_token const& token);
 
     static winrt::Popup GetPopup(const winrt::TeachingTip& teachingTip);
+    static int GetCreatedAnimationObjectCount();
 
 private:
     static com_ptr<TeachingTipTestHooks> s_testHooks;
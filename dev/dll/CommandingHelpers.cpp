@@ -118,7 +118,11 @@ void CommandingHelpers::BindToIconSourcePropertyIfUnset(
 
     if (!localIconSource)
     {
-        SharedHelpers::SetBinding(uiCommand, L"IconSource", target, iconSourceProperty, WUXIconSourceToMUXIconSourceConverter());
+        PropertyPropagator::GetForSource(uiCommand)->AddTarget(winrt::XamlUICommand::IconSourceProperty(), target, iconSourceProperty,
+            [](winrt::IInspectable const& value)
+            {
+                return WUXIconSourceToMUXIconSourceConverter().Convert(value, {}, nullptr, {});
+            });
     }
 }
 
@@ -129,7 +133,12 @@ void CommandingHelpers::BindToIconPropertyIfUnset(
 {
     if (!target.ReadLocalValue(iconProperty).try_as<winrt::IconElement>())
     {
-        SharedHelpers::SetBinding(uiCommand, L"Icon", target, iconProperty, IconSourceToIconSourceElementConverter());
+        PropertyPropagator::GetForSource(uiCommand)->AddTarget(winrt::XamlUICommand::IconSourceProperty(), target, iconProperty,
+            [](winrt::IInspectable const& value)
+            {
+                auto iconSource = WUXIconSourceToMUXIconSourceConverter().Convert(value, {}, nullptr, {});
+                return IconSourceToIconSourceElementConverter().Convert(iconSource, {}, nullptr, {});
+            });
     }
 }
 
@@ -144,12 +153,10 @@ void CommandingHelpers::BindToLabelPropertyIfUnset(
 
     if (!labelReference || labelReference.Value().empty())
     {
-        SharedHelpers::SetBinding(uiCommand, L"Label", target, labelProperty);
+        PropertyPropagator::GetForSource(uiCommand)->AddTarget(winrt::XamlUICommand::LabelProperty(), target, labelProperty);
     }
 }
 
-
-
 void CommandingHelpers::BindToKeyboardAcceleratorsIfUnset(
     winrt::XamlUICommand const& uiCommand,
     winrt::UIElement const& target)
@@ -157,17 +164,18 @@ void CommandingHelpers::BindToKeyboardAcceleratorsIfUnset(
     if (target.KeyboardAccelerators().Size() == 0)
     {
         // Keyboard accelerators can't have two parents, so we'll need to copy them
-        // and bind to the original properties instead of assigning them.
-        // We set up bindings so that modifications to the app-defined accelerators
+        // and propagate the original properties instead of assigning them.
+        // That way modifications to the app-defined accelerators
         // will propagate to the accelerators that are used by the framework.
         for (winrt::KeyboardAccelerator keyboardAccelerator : uiCommand.KeyboardAccelerators())
         {
             winrt::KeyboardAccelerator keyboardAcceleratorCopy;
 
-            SharedHelpers::SetBinding(keyboardAccelerator, L"IsEnabled", keyboardAcceleratorCopy, winrt::KeyboardAccelerator::IsEnabledProperty());
-            SharedHelpers::SetBinding(keyboardAccelerator, L"Key", keyboardAcceleratorCopy, winrt::KeyboardAccelerator::KeyProperty());
-            SharedHelpers::SetBinding(keyboardAccelerator, L"Modifiers", keyboardAcceleratorCopy, winrt::KeyboardAccelerator::ModifiersProperty());
-            SharedHelpers::SetBinding(keyboardAccelerator, L"ScopeOwner", keyboardAcceleratorCopy, winrt::KeyboardAccelerator::ScopeOwnerProperty());
+            auto propagator = PropertyPropagator::GetForSource(keyboardAccelerator);
+            propagator->AddTarget(winrt::KeyboardAccelerator::IsEnabledProperty(), keyboardAcceleratorCopy, winrt::KeyboardAccelerator::IsEnabledProperty());
+            propagator->AddTarget(winrt::KeyboardAccelerator::KeyProperty(), keyboardAcceleratorCopy, winrt::KeyboardAccelerator::KeyProperty());
+            propagator->AddTarget(winrt::KeyboardAccelerator::ModifiersProperty(), keyboardAcceleratorCopy, winrt::KeyboardAccelerator::ModifiersProperty());
+            propagator->AddTarget(winrt::KeyboardAccelerator::ScopeOwnerProperty(), keyboardAcceleratorCopy, winrt::KeyboardAccelerator::ScopeOwnerProperty());
             target.KeyboardAccelerators().Append(keyboardAcceleratorCopy);
         }
     }
@@ -179,7 +187,7 @@ void CommandingHelpers::BindToAccessKeyIfUnset(
 {
     if (target.AccessKey().empty())
     {
-        SharedHelpers::SetBinding(uiCommand, L"AccessKey", target, winrt::UIElement::AccessKeyProperty());
+        PropertyPropagator::GetForSource(uiCommand)->AddTarget(winrt::XamlUICommand::AccessKeyProperty(), target, winrt::UIElement::AccessKeyProperty());
     }
 }
 
@@ -187,9 +195,11 @@ void CommandingHelpers::BindToDescriptionPropertiesIfUnset(
     winrt::XamlUICommand const& uiCommand,
     winrt::DependencyObject const& target)
 {
+    auto propagator = PropertyPropagator::GetForSource(uiCommand);
+
     if (winrt::AutomationProperties::GetHelpText(target).empty())
     {
-        SharedHelpers::SetBinding(uiCommand, L"Description", target, winrt::AutomationProperties::HelpTextProperty());
+        propagator->AddTarget(winrt::XamlUICommand::DescriptionProperty(), target, winrt::AutomationProperties::HelpTextProperty());
     }
 
     winrt::IInspectable localToolTipAsI = winrt::ToolTipService::GetToolTip(target);
@@ -197,7 +207,7 @@ void CommandingHelpers::BindToDescriptionPropertiesIfUnset(
 
     if ((!localToolTipAsString || localToolTipAsString.Value().empty()) && !localToolTipAsI.try_as<winrt::ToolTip>())
     {
-        SharedHelpers::SetBinding(uiCommand, L"Description", target, winrt::ToolTipService::ToolTipProperty());
+        propagator->AddTarget(winrt::XamlUICommand::DescriptionProperty(), target, winrt::ToolTipService::ToolTipProperty());
     }
 }
 
@@ -206,6 +216,11 @@ void CommandingHelpers::ClearBindingIfSet(
     winrt::FrameworkElement const& target,
     winrt::DependencyProperty const& targetProperty)
 {
+    if (ClearPropagatedValueIfSet(uiCommand, target, targetProperty))
+    {
+        return;
+    }
+
     if (auto bindingExpression = target.GetBindingExpression(targetProperty))
     {
         if (auto parentBinding = bindingExpression.ParentBinding())
@@ -220,3 +235,207 @@ void CommandingHelpers::ClearBindingIfSet(
         }
     }
 }
+
+bool CommandingHelpers::ClearPropagatedValueIfSet(
+    winrt::XamlUICommand const& uiCommand,
+    winrt::DependencyObject const& target,
+    winrt::DependencyProperty const& targetProperty)
+{
+    if (auto propagator = PropertyPropagator::TryGetForSource(uiCommand))
+    {
+        if (propagator->RemoveTarget(target, targetProperty))
+        {
+            target.ClearValue(targetProperty);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+CommandingHelpers::PropertyPropagator::PropertyPropagator(winrt::DependencyObject const& source) :
+    m_source(winrt::make_weak(source)),
+    m_dispatcherHelper(source)
+{
+}
+
+std::shared_ptr<CommandingHelpers::PropertyPropagator> CommandingHelpers::PropertyPropagator::GetForSource(winrt::DependencyObject const& source)
+{
+    return FindForSource(source, true /* create */);
+}
+
+std::shared_ptr<CommandingHelpers::PropertyPropagator> CommandingHelpers::PropertyPropagator::TryGetForSource(winrt::DependencyObject const& source)
+{
+    return FindForSource(source, false /* create */);
+}
+
+std::shared_ptr<CommandingHelpers::PropertyPropagator> CommandingHelpers::PropertyPropagator::FindForSource(winrt::DependencyObject const& source, bool create)
+{
+    // A propagator is kept alive by the property changed callbacks it registers on its source,
+    // this map only allows finding it again. It is keyed by the source's identity, the weak reference
+    // guards against a new source reusing the address of one that went away. Sources are UI thread objects.
+    struct Entry
+    {
+        winrt::weak_ref<winrt::DependencyObject> source;
+        std::weak_ptr<PropertyPropagator> propagator;
+    };
+    static thread_local std::unordered_map<void*, Entry> s_propagators;
+    static thread_local size_t s_sweepThreshold = 64;
+
+    void* identity = winrt::get_abi(source.as<winrt::IUnknown>());
+
+    auto it = s_propagators.find(identity);
+    if (it != s_propagators.end())
+    {
+        if (it->second.source.get() == source)
+        {
+            if (auto propagator = it->second.propagator.lock())
+            {
+                return propagator;
+            }
+        }
+
+        s_propagators.erase(it);
+    }
+
+    if (create)
+    {
+        // Propagators go away with their source, drop their entries once in a while so the map doesn't grow with dead ones.
+        if (s_propagators.size() >= s_sweepThreshold)
+        {
+            for (auto entryIt = s_propagators.begin(); entryIt != s_propagators.end();)
+            {
+                entryIt = entryIt->second.propagator.expired() ? s_propagators.erase(entryIt) : std::next(entryIt);
+            }
+            s_sweepThreshold = std::max<size_t>(64, s_propagators.size() * 2);
+        }
+
+        auto propagator = std::make_shared<PropertyPropagator>(source);
+        s_propagators[identity] = Entry{ winrt::make_weak(source), propagator };
+        return propagator;
+    }
+
+    return nullptr;
+}
+
+void CommandingHelpers::PropertyPropagator::AddTarget(
+    winrt::DependencyProperty const& sourceProperty,
+    winrt::DependencyObject const& target,
+    winrt::DependencyProperty const& targetProperty,
+    ValueConverter const& converter)
+{
+    if (auto source = m_source.get())
+    {
+        RemoveTarget(target, targetProperty);
+
+        if (std::find(m_observedSourceProperties.begin(), m_observedSourceProperties.end(), sourceProperty) == m_observedSourceProperties.end())
+        {
+            source.RegisterPropertyChangedCallback(sourceProperty,
+                [self = shared_from_this()](winrt::DependencyObject const& sender, winrt::DependencyProperty const& property)
+                {
+                    self->OnSourcePropertyChanged(sender, property);
+                });
+            m_observedSourceProperties.push_back(sourceProperty);
+        }
+
+        Target entry;
+        entry.sourceProperty = sourceProperty;
+        entry.target = winrt::make_weak(target);
+        entry.targetProperty = targetProperty;
+        entry.converter = converter;
+
+        PushValue(source, target, entry);
+
+        entry.targetPropertyChangedToken = target.RegisterPropertyChangedCallback(targetProperty,
+            [self = shared_from_this()](winrt::DependencyObject const& sender, winrt::DependencyProperty const& property)
+            {
+                self->OnTargetPropertyChanged(sender, property);
+            });
+
+        m_targets.push_back(std::move(entry));
+    }
+}
+
+bool CommandingHelpers::PropertyPropagator::RemoveTarget(
+    winrt::DependencyObject const& target,
+    winrt::DependencyProperty const& targetProperty)
+{
+    auto it = FindTarget(target, targetProperty);
+    if (it != m_targets.end())
+    {
+        target.UnregisterPropertyChangedCallback(targetProperty, it->targetPropertyChangedToken);
+        m_targets.erase(it);
+        return true;
+    }
+
+    return false;
+}
+
+void CommandingHelpers::PropertyPropagator::OnSourcePropertyChanged(winrt::DependencyObject const& sender, winrt::DependencyProperty const& sourceProperty)
+{
+    // Targets can be removed while values are pushed, so don't hold on to iterators.
+    for (size_t i = 0; i < m_targets.size(); i++)
+    {
+        if (m_targets[i].sourceProperty == sourceProperty)
+        {
+            if (auto target = m_targets[i].target.get())
+            {
+                PushValue(sender, target, m_targets[i]);
+            }
+        }
+    }
+
+    m_targets.erase(
+        std::remove_if(m_targets.begin(), m_targets.end(), [](Target const& entry) { return !entry.target.get(); }),
+        m_targets.end());
+}
+
+void CommandingHelpers::PropertyPropagator::OnTargetPropertyChanged(winrt::DependencyObject const& sender, winrt::DependencyProperty const& targetProperty)
+{
+    if (!m_isPushingValue)
+    {
+        // The app has set its own value, stop overriding it. We are inside of the callback we registered
+        // on the target, so revoke it once this notification is done rather than from within it.
+        auto it = FindTarget(sender, targetProperty);
+        if (it != m_targets.end())
+        {
+            m_dispatcherHelper.RunAsync(
+                [weakTarget = it->target, targetProperty, token = it->targetPropertyChangedToken]()
+                {
+                    if (auto target = weakTarget.get())
+                    {
+                        target.UnregisterPropertyChangedCallback(targetProperty, token);
+                    }
+                });
+
+            m_targets.erase(it);
+        }
+    }
+}
+
+void CommandingHelpers::PropertyPropagator::PushValue(winrt::DependencyObject const& source, winrt::DependencyObject const& target, Target const& entry)
+{
+    auto value = source.GetValue(entry.sourceProperty);
+    if (entry.converter)
+    {
+        value = entry.converter(value);
+    }
+
+    m_isPushingValue = true;
+    auto scopeGuard = gsl::finally([this]()
+    {
+        m_isPushingValue = false;
+    });
+
+    target.SetValue(entry.targetProperty, value);
+}
+
+std::vector<CommandingHelpers::PropertyPropagator::Target>::iterator CommandingHelpers::PropertyPropagator::FindTarget(
+    winrt::DependencyObject const& target,
+    winrt::DependencyProperty const& targetProperty)
+{
+    return std::find_if(m_targets.begin(), m_targets.end(), [&target, &targetProperty](Target const& entry)
+    {
+        return entry.targetProperty == targetProperty && entry.target.get() == target;
+    });
+}
@@ -173,6 +173,14 @@ bool SharedHelpers::IsIconSourceElementAvailable()
     return s_isAvailable;
 }
 
+bool SharedHelpers::IsBitmapIconShowAsMonochromeAvailable()
+{
+    static bool s_isAvailable =
+        IsRS4OrHigher() ||
+        winrt::ApiInformation::IsPropertyPresent(L"Windows.UI.Xaml.Controls.BitmapIcon", L"ShowAsMonochrome");
+    return s_isAvailable;
+}
+
 bool SharedHelpers::IsStandardUICommandAvailable()
 {
     static bool s_isAvailable =
@@ -484,65 +492,21 @@ bool SharedHelpers::IsAncestor(
 
 #ifdef ICONSOURCE_INCLUDED
 
+// Icon creation is dispatched to the IconSource implementation so that each kind of IconSource builds its
+// IconElement without probing every IconSource type first.
 winrt::IconElement SharedHelpers::MakeIconElementFrom(winrt::IconSource const& iconSource)
 {
-    if (auto fontIconSource = iconSource.try_as<winrt::FontIconSource>())
+    if (iconSource)
     {
-        winrt::FontIcon fontIcon;
-
-        fontIcon.Glyph(fontIconSource.Glyph());
-        fontIcon.FontSize(fontIconSource.FontSize());
-
-        if (fontIconSource.FontFamily())
+        // IconSource can be derived from by apps, so go through the interface rather than assuming this is one of our implementations.
+        if (auto iconSourcePrivate = iconSource.try_as<winrt::IIconSourcePrivate>())
         {
-            fontIcon.FontFamily(fontIconSource.FontFamily());
+            return iconSourcePrivate.CreateIconElement();
         }
-
-        fontIcon.FontWeight(fontIconSource.FontWeight());
-        fontIcon.FontStyle(fontIconSource.FontStyle());
-        fontIcon.IsTextScaleFactorEnabled(fontIconSource.IsTextScaleFactorEnabled());
-        fontIcon.MirroredWhenRightToLeft(fontIconSource.MirroredWhenRightToLeft());
-
-        return fontIcon;
-    }
-    else if (auto symbolIconSource = iconSource.try_as<winrt::SymbolIconSource>())
-    {
-        winrt::SymbolIcon symbolIcon;
-        symbolIcon.Symbol(symbolIconSource.Symbol());
-
-        return symbolIcon;
-    }
-    else if (auto bitmapIconSource = iconSource.try_as<winrt::BitmapIconSource>())
-    {
-        winrt::BitmapIcon bitmapIcon;
-
-        if (bitmapIconSource.UriSource())
-        {
-            bitmapIcon.UriSource(bitmapIconSource.UriSource());
-        }
-
-        if (winrt::ApiInformation::IsPropertyPresent(L"Windows.UI.Xaml.Controls.BitmapIcon", L"ShowAsMonochrome"))
-        {
-            bitmapIcon.ShowAsMonochrome(bitmapIconSource.ShowAsMonochrome());
-        }
-
-        return bitmapIcon;
-    }
-    else if (auto pathIconSource = iconSource.try_as<winrt::PathIconSource>())
-    {
-        winrt::PathIcon pathIcon;
-
-        if (pathIconSource.Data())
-        {
-            pathIcon.Data(pathIconSource.Data());
-        }
-
-        return pathIcon;
     }
 
     return nullptr;
 }
-
 #endif
 
 void SharedHelpers::SetBinding(
@@ -84,72 +84,95 @@ void XamlControlsResources::UpdateSource()
     Source(uri);
 }
 
-void SetDefaultStyleKeyWorker(winrt::IControlProtected const& controlProtected, std::wstring_view const& className) 
+// Which generic.xaml a control should use only depends on the OS version and on whether we are running in a
+// framework package, neither of which can change while the process is running. Uri is immutable, so all controls
+// created on a thread share the same instance instead of each parsing the string again.
+static winrt::Uri const& GetDefaultStyleResourceUri()
 {
-    controlProtected.DefaultStyleKey(box_value(className));
-
-    if (auto control5 = controlProtected.try_as<winrt::IControl5>())
-    {
-        winrt::Uri uri{
-            []() -> PCWSTR {
-            
-            // RS3 styles should be used on builds where ListViewItemPresenter's VSM integration works.
-            bool isRS3OrHigher = SharedHelpers::DoesListViewItemPresenterVSMWork();
-            bool isRS4OrHigher = SharedHelpers::IsRS4OrHigher();
-            bool isRS5OrHigher = SharedHelpers::IsRS5OrHigher() && SharedHelpers::IsControlCornerRadiusAvailable();
-            bool is19H1OrHigher = SharedHelpers::Is19H1OrHigher();
-
-            bool isInFrameworkPackage = SharedHelpers::IsInFrameworkPackage();
-            if (isInFrameworkPackage)
+    static thread_local winrt::Uri s_uri{
+        []() -> PCWSTR {
+        
+        // RS3 styles should be used on builds where ListViewItemPresenter's VSM integration works.
+        bool isRS3OrHigher = SharedHelpers::DoesListViewItemPresenterVSMWork();
+        bool isRS4OrHigher = SharedHelpers::IsRS4OrHigher();
+        bool isRS5OrHigher = SharedHelpers::IsRS5OrHigher() && SharedHelpers::IsControlCornerRadiusAvailable();
+        bool is19H1OrHigher = SharedHelpers::Is19H1OrHigher();
+
+        bool isInFrameworkPackage = SharedHelpers::IsInFrameworkPackage();
+        if (isInFrameworkPackage)
+        {
+            if (is19H1OrHigher)
             {
-                if (is19H1OrHigher)
-                {
-                    return L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/19h1_generic.xaml";
-                }
-                else if (isRS5OrHigher)
-                {
-                    return L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs5_generic.xaml";
-                }
-                else if (isRS4OrHigher)
-                {
-                    return L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs4_generic.xaml";
-                }
-                else if (isRS3OrHigher)
-                {
-                    return L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs3_generic.xaml";
-                }
-                else
-                {
-                    return L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs2_generic.xaml";
-                }
+                return L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/19h1_generic.xaml";
+            }
+            else if (isRS5OrHigher)
+            {
+                return L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs5_generic.xaml";
+            }
+            else if (isRS4OrHigher)
+            {
+                return L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs4_generic.xaml";
+            }
+            else if (isRS3OrHigher)
+            {
+                return L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs3_generic.xaml";
             }
             else
             {
-                if (is19H1OrHigher)
-                {
-                    return L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/19h1_generic.xaml";
-                }
-                else if (isRS5OrHigher)
-                {
-                    return L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs5_generic.xaml";
-                }
-                else if (isRS4OrHigher)
-                {
-                    return L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs4_generic.xaml";
-                }
-                else if (isRS3OrHigher)
-                {
-                    return L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs3_generic.xaml";
-                }
-                else
-                {
-                    return L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs2_generic.xaml";
-                }
+                return L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs2_generic.xaml";
             }
-        }()
-        };
+        }
+        else
+        {
+            if (is19H1OrHigher)
+            {
+                return L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/19h1_generic.xaml";
+            }
+            else if (isRS5OrHigher)
+            {
+                return L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs5_generic.xaml";
+            }
+            else if (isRS4OrHigher)
+            {
+                return L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs4_generic.xaml";
+            }
+            else if (isRS3OrHigher)
+            {
+                return L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs3_generic.xaml";
+            }
+            else
+            {
+                return L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/rs2_generic.xaml";
+            }
+        }
+    }()
+    };
+
+    return s_uri;
+}
+
+// Boxed DefaultStyleKey values, one per control type. The key is only ever compared by value so instances of the
+// same type can share a single box.
+static winrt::IInspectable const& GetBoxedDefaultStyleKey(std::wstring_view const& className)
+{
+    static thread_local std::map<std::wstring, winrt::IInspectable, std::less<>> s_boxedKeys;
+
+    auto it = s_boxedKeys.find(className);
+    if (it == s_boxedKeys.end())
+    {
+        it = s_boxedKeys.emplace(std::wstring{ className }, box_value(className)).first;
+    }
+    return it->second;
+}
+
+void SetDefaultStyleKeyWorker(winrt::IControlProtected const& controlProtected, std::wstring_view const& className) 
+{
+    controlProtected.DefaultStyleKey(GetBoxedDefaultStyleKey(className));
+
+    if (auto control5 = controlProtected.try_as<winrt::IControl5>())
+    {
         // Choose a default resource URI based on whether we're running in a framework package scenario or not.
-        control5.DefaultStyleResourceUri(uri);
+        control5.DefaultStyleResourceUri(GetDefaultStyleResourceUri());
     }
 }
 
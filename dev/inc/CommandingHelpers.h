@@ -3,8 +3,59 @@
 
 #pragma once
 
+#include "DispatcherHelper.h"
+
 namespace CommandingHelpers
 {
+    // Pushes the values of a source's properties (a XamlUICommand or one of its KeyboardAccelerators) to the
+    // target properties that take their value from it. There is one propagator per source, shared by all of
+    // its targets, which is much cheaper than a Binding per target property. Like a one way Binding, a target
+    // property stops receiving values once the app sets it.
+    class PropertyPropagator : public std::enable_shared_from_this<PropertyPropagator>
+    {
+    public:
+        using ValueConverter = std::function<winrt::IInspectable(winrt::IInspectable const&)>;
+
+        explicit PropertyPropagator(winrt::DependencyObject const& source);
+
+        static std::shared_ptr<PropertyPropagator> GetForSource(winrt::DependencyObject const& source);
+        static std::shared_ptr<PropertyPropagator> TryGetForSource(winrt::DependencyObject const& source);
+
+        void AddTarget(
+            winrt::DependencyProperty const& sourceProperty,
+            winrt::DependencyObject const& target,
+            winrt::DependencyProperty const& targetProperty,
+            ValueConverter const& converter = nullptr);
+
+        // Returns false if the target property was not receiving values from this source.
+        bool RemoveTarget(
+            winrt::DependencyObject const& target,
+            winrt::DependencyProperty const& targetProperty);
+
+    private:
+        struct Target
+        {
+            winrt::DependencyProperty sourceProperty{ nullptr };
+            winrt::weak_ref<winrt::DependencyObject> target;
+            winrt::DependencyProperty targetProperty{ nullptr };
+            ValueConverter converter;
+            int64_t targetPropertyChangedToken{};
+        };
+
+        static std::shared_ptr<PropertyPropagator> FindForSource(winrt::DependencyObject const& source, bool create);
+
+        void OnSourcePropertyChanged(winrt::DependencyObject const& sender, winrt::DependencyProperty const& sourceProperty);
+        void OnTargetPropertyChanged(winrt::DependencyObject const& sender, winrt::DependencyProperty const& targetProperty);
+        void PushValue(winrt::DependencyObject const& source, winrt::DependencyObject const& target, Target const& entry);
+        std::vector<Target>::iterator FindTarget(winrt::DependencyObject const& target, winrt::DependencyProperty const& targetProperty);
+
+        winrt::weak_ref<winrt::DependencyObject> m_source;
+        std::vector<winrt::DependencyProperty> m_observedSourceProperties;
+        std::vector<Target> m_targets;
+        DispatcherHelper m_dispatcherHelper;
+        bool m_isPushingValue{ false };
+    };
+
 #ifdef ICONSOURCE_INCLUDED
     class IconSourceToIconSourceElementConverter : public winrt::implements<IconSourceToIconSourceElementConverter, winrt::IValueConverter>
     {
@@ -77,4 +128,11 @@ namespace CommandingHelpers
         winrt::XamlUICommand const& uiCommand,
         winrt::FrameworkElement const& target,
         winrt::DependencyProperty const& targetProperty);
+
+    // Stops propagating the command's value to the target property and clears the value if it was
+    // still the propagated one. Returns false if the target wasn't registered with the command.
+    bool ClearPropagatedValueIfSet(
+        winrt::XamlUICommand const& uiCommand,
+        winrt::DependencyObject const& target,
+        winrt::DependencyProperty const& targetProperty);
 };
@@ -81,6 +81,7 @@ enum class RoutedEventType
     GettingFocus,
     LosingFocus,
     KeyDown,
+    PointerEntered,
     PointerPressed
 };
 
@@ -110,6 +111,13 @@ struct RoutedEventTraits<RoutedEventType::KeyDown>
     using HandlerT = winrt::KeyEventHandler;
 };
 
+template <>
+struct RoutedEventTraits<RoutedEventType::PointerEntered>
+{
+    static winrt::RoutedEvent Event() { return winrt::UIElement::PointerEnteredEvent(); }
+    using HandlerT = winrt::PointerEventHandler;
+};
+
 template <>
 struct RoutedEventTraits<RoutedEventType::PointerPressed>
 {
@@ -49,6 +49,8 @@ public:
 
     static bool IsIconSourceElementAvailable();
 
+    static bool IsBitmapIconShowAsMonochromeAvailable();
+
     static bool IsStandardUICommandAvailable();
 
     static bool IsDispatcherQueueAvailable();
@@ -186,6 +186,7 @@ namespace CustomTasks
                     NeedsPropChangedCallback = needsPropChangedCallback ?? false,
                     PropChangedCallbackMethodName = propertyChangedCallbackMethodName,
                     PropertyValidationCallback = propertyValidationCallback,
+                    IsCached = IsCachedProperty(dependencyProperty, instanceProperty),
                     DefaultValue = defaultValue
                 };
             }
@@ -283,11 +284,22 @@ namespace CustomTasks
             public string PropChangedCallbackMethodName;
             public bool NeedsDependencyPropertyField;
             public string PropertyValidationCallback;
+            public bool IsCached;
 
             public string GetClassFuncName()
             {
                 return $"On{Name}PropertyChanged";
             }
+
+            public string GetCachedFieldName()
+            {
+                return $"m_cached{Name}";
+            }
+
+            public bool NeedsStaticPropChangedCallback()
+            {
+                return NeedsPropChangedCallback || PropertyValidationCallback != null || IsCached;
+            }
         }
 
         private struct EventDefinition
@@ -458,6 +470,22 @@ namespace CustomTasks
             return GetAttributeValue<string>("MUXPropertyTypeAttribute", members);
         }
 
+        private bool IsCachedProperty(params MemberInfo[] members)
+        {
+            return HasAttribute("MUXPropertyCachedAttribute", members);
+        }
+
+        private string GetDefaultValueExpression(PropertyDefinition prop)
+        {
+            if (prop.PropertyType != null && prop.PropertyType.Name == "String" && !(prop.DefaultValue.StartsWith("\"") && prop.DefaultValue.EndsWith("\"")))
+            {
+                // Strings are special and need to be quoted, check first that the provided string is not quoted.
+                return String.Format("L\"{0}\"", prop.DefaultValue);
+            }
+
+            return prop.DefaultValue;
+        }
+
         private string WriteHeader(TypeDefinition typeDefinition)
         {
             var typeName = typeDefinition.Type.Name;
@@ -543,7 +571,7 @@ public:
     static void ClearProperties();
 ");
 
-            var needsPropertyChanged = props.Where(x => x.NeedsPropChangedCallback || x.PropertyValidationCallback != null);
+            var needsPropertyChanged = props.Where(x => x.NeedsStaticPropChangedCallback());
             foreach (var prop in needsPropertyChanged)
             {
                 sb.Append($@"
@@ -553,6 +581,18 @@ public:
 ");
             }
 
+            // Shadow fields for [MUX_PROPERTY_CACHED] properties, kept up to date by the property changed callback.
+            var cachedProps = props.Where(x => x.IsCached && x.InstanceProperty != null);
+            if (cachedProps.Any())
+            {
+                sb.AppendLine();
+                sb.AppendLine("private:");
+                foreach (var prop in cachedProps)
+                {
+                    sb.AppendLine(String.Format("    {0} {1}{{}};", prop.PropertyCppName, prop.GetCachedFieldName()));
+                }
+            }
+
             sb.AppendLine("};");
 
             return sb.ToString();
@@ -617,6 +657,10 @@ public:
             {
                 sb.AppendLine("    EnsureProperties();");
             }
+            foreach (var prop in props.Where(x => x.IsCached && x.InstanceProperty != null && x.DefaultValue != null))
+            {
+                sb.AppendLine(String.Format("    {0} = {1};", prop.GetCachedFieldName(), GetDefaultValueExpression(prop)));
+            }
             sb.AppendLine("}");
             sb.AppendLine();
 
@@ -661,7 +705,7 @@ public:
                     }
                     callback = String.Format("&{0}::{1}", ownerType.Name, prop.PropChangedCallbackMethodName);
                 }
-                else if (prop.NeedsPropChangedCallback || prop.PropertyValidationCallback != null)
+                else if (prop.NeedsStaticPropChangedCallback())
                 {
                     callback = $"winrt::PropertyChangedCallback(&On{prop.Name}PropertyChanged)";
                 }
@@ -695,11 +739,9 @@ public:
             }
             sb.AppendLine("}");
 
-            bool needsPropertyChanged = props.Any(x => x.NeedsPropChangedCallback);
-            bool hasValidationCallback = props.Any(x => x.PropertyValidationCallback != null);
-            if (needsPropertyChanged || hasValidationCallback)
+            if (props.Any(x => x.NeedsStaticPropChangedCallback()))
             {
-                foreach (var prop in props.Where(x => x.NeedsPropChangedCallback || x.PropertyValidationCallback != null))
+                foreach (var prop in props.Where(x => x.NeedsStaticPropChangedCallback()))
                 {
                     sb.AppendLine();
                     // PropertyChanged callback
@@ -730,6 +772,12 @@ $@"void {ownerType.Name}Properties::{prop.GetClassFuncName()}(
 ", ownerType.Name, prop.PropertyValidationCallback, propertyCppName, comparison));
                     }
 
+                    if (prop.IsCached)
+                    {
+                        sb.AppendLine(
+$@"    static_cast<{ownerType.Name}Properties*>(winrt::get_self<{ownerType.Name}>(owner))->{prop.GetCachedFieldName()} = ValueHelper<{prop.PropertyCppName}>::CastOrUnbox(args.NewValue());");
+                    }
+
                     if (prop.NeedsPropChangedCallback)
                     {
                         string ownerFuncName = prop.PropChangedCallbackMethodName ?? prop.GetClassFuncName();
@@ -759,11 +807,22 @@ $@"    winrt::get_self<{ownerType.Name}>(owner)->{ownerFuncName}(args);");
                     }
                     sb.AppendLine($@"    static_cast<{ownerType.Name}*>(this)->SetValue(s_{prop.Name}Property, ValueHelper<{prop.PropertyCppName}>::BoxValueIfNecessary({localName}));
 }}");
-                    sb.AppendLine(String.Format(@"
+                    if (prop.IsCached)
+                    {
+                        sb.AppendLine(String.Format(@"
+{0} {1}Properties::{2}()
+{{
+    return {3};
+}}", prop.PropertyCppName, ownerType.Name, prop.Name, prop.GetCachedFieldName()));
+                    }
+                    else
+                    {
+                        sb.AppendLine(String.Format(@"
 {0} {1}Properties::{2}()
 {{
     return ValueHelper<{0}>::CastOrUnbox(static_cast<{1}*>(this)->GetValue(s_{2}Property));
 }}", prop.PropertyCppName, ownerType.Name, prop.Name));
+                    }
                 }
                 else if (prop.AttachedPropertyTargetType != null)
                 {